@@ -13,37 +13,37 @@
  * Containment functions 
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION contained_point3D_lseg3D(point Point3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_point3D_lseg3D(point Point3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Point3D, RIGHTARG = Lseg3D, PROCEDURE = contained_point3D_lseg3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_point3D_line3D(point Point3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_point3D_line3D(point Point3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Point3D, RIGHTARG = Line3D, PROCEDURE = contained_point3D_line3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_point3D_box3D(point Point3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_point3D_box3D(point Point3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Point3D, RIGHTARG = Box3D, PROCEDURE = contained_point3D_box3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_point3D_path3D(point Point3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_point3D_path3D(point Point3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Point3D, RIGHTARG = Path3D, PROCEDURE = contained_point3D_path3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_point3D_poly3D(point Point3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_point3D_poly3D(point Point3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Point3D, RIGHTARG = Polygon3D, PROCEDURE = contained_point3D_poly3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_point3D_sphere(point Point3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_point3D_sphere(point Point3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Point3D, RIGHTARG = Sphere, PROCEDURE = contained_point3D_sphere,
 	COMMUTATOR = '@>',
@@ -52,13 +52,13 @@ CREATE OPERATOR <@ (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contain_lseg3D_point3D(lseg Lseg3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_lseg3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_lseg3D_point3D(lseg Lseg3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_lseg3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Lseg3D, RIGHTARG = Point3D, PROCEDURE = contain_lseg3D_point3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Lseg3D, RIGHTARG = Lseg3D, PROCEDURE = contain_lseg3D_lseg3D,
 	COMMUTATOR = '<@',
@@ -67,37 +67,37 @@ CREATE OPERATOR @> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contained_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Lseg3D, RIGHTARG = Lseg3D, PROCEDURE = contained_lseg3D_lseg3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Lseg3D, RIGHTARG = Line3D, PROCEDURE = contained_lseg3D_line3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Lseg3D, RIGHTARG = Box3D, PROCEDURE = contained_lseg3D_box3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Lseg3D, RIGHTARG = Path3D, PROCEDURE = contained_lseg3D_path3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Lseg3D, RIGHTARG = Polygon3D, PROCEDURE = contained_lseg3D_poly3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Lseg3D, RIGHTARG = Sphere, PROCEDURE = contained_lseg3D_sphere,
 	COMMUTATOR = '@>',
@@ -106,13 +106,13 @@ CREATE OPERATOR <@ (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contain_line3D_point3D(line Line3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_line3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_line3D_point3D(line Line3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_line3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Line3D, RIGHTARG = Point3D, PROCEDURE = contain_line3D_point3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Line3D, RIGHTARG = Lseg3D, PROCEDURE = contain_line3D_lseg3D,
 	COMMUTATOR = '<@',
@@ -121,37 +121,37 @@ CREATE OPERATOR @> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contain_box3D_point3D(box Box3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_box3D_point3D(box Box3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Box3D, RIGHTARG = Point3D, PROCEDURE = contain_box3D_point3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Box3D, RIGHTARG = Lseg3D, PROCEDURE = contain_box3D_lseg3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Box3D, RIGHTARG = Box3D, PROCEDURE = contain_box3D_box3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_box3D_path3D(box Box3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_box3D_path3D(box Box3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Box3D, RIGHTARG = Path3D, PROCEDURE = contain_box3D_path3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Box3D, RIGHTARG = Polygon3D, PROCEDURE = contain_box3D_poly3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Box3D, RIGHTARG = Sphere, PROCEDURE = contain_box3D_sphere,
 	COMMUTATOR = '<@',
@@ -160,13 +160,13 @@ CREATE OPERATOR @> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contained_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_box3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Box3D, RIGHTARG = Box3D, PROCEDURE = contained_box3D_box3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_box3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Box3D, RIGHTARG = Sphere, PROCEDURE = contained_box3D_sphere,
 	COMMUTATOR = '@>',
@@ -175,19 +175,19 @@ CREATE OPERATOR <@ (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contain_path3D_point3D(path Path3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_path3D_point3D(path Path3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Path3D, RIGHTARG = Point3D, PROCEDURE = contain_path3D_point3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Path3D, RIGHTARG = Lseg3D, PROCEDURE = contain_path3D_lseg3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Path3D, RIGHTARG = Path3D, PROCEDURE = contain_path3D_path3D,
 	COMMUTATOR = '<@',
@@ -196,25 +196,25 @@ CREATE OPERATOR @> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contained_path3D_box3D(path Path3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_path3D_box3D(path Path3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Path3D, RIGHTARG = Box3D, PROCEDURE = contained_path3D_box3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Path3D, RIGHTARG = Path3D, PROCEDURE = contained_path3D_path3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Path3D, RIGHTARG = Polygon3D, PROCEDURE = contained_path3D_poly3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_path3D_sphere(path Path3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_path3D_sphere(path Path3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Path3D, RIGHTARG = Sphere, PROCEDURE = contained_path3D_sphere,
 	COMMUTATOR = '@>',
@@ -224,28 +224,28 @@ CREATE OPERATOR <@ (
 /******************************************************************************/
 
 /*
-CREATE OR REPLACE FUNCTION contain_poly3D_point3D_new(poly Polygon3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_point3D_new' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_poly3D_point3D_new(poly Polygon3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_point3D_new' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 */
 
-CREATE OR REPLACE FUNCTION contain_poly3D_point3D(poly Polygon3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_poly3D_point3D(poly Polygon3D, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Polygon3D, RIGHTARG = Point3D, PROCEDURE = contain_poly3D_point3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Polygon3D, RIGHTARG = Lseg3D, PROCEDURE = contain_poly3D_lseg3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_poly3D_path3D(poly Polygon3D, pa Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_poly3D_path3D(poly Polygon3D, pa Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Polygon3D, RIGHTARG = Path3D, PROCEDURE = contain_poly3D_path3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_poly3D_poly3D(p1 Polygon3D, p2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_poly3D_poly3D(p1 Polygon3D, p2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Polygon3D, RIGHTARG = Polygon3D, PROCEDURE = contain_poly3D_poly3D,
 	COMMUTATOR = '<@',
@@ -254,19 +254,19 @@ CREATE OPERATOR @> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contained_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Polygon3D, RIGHTARG = Box3D, PROCEDURE = contained_poly3D_box3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_poly3D_poly3D(p1 Polygon3D, p2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_poly3D_poly3D(p1 Polygon3D, p2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Polygon3D, RIGHTARG = Polygon3D, PROCEDURE = contained_poly3D_poly3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Polygon3D, RIGHTARG = Sphere, PROCEDURE = contained_poly3D_sphere,
 	COMMUTATOR = '@>',
@@ -275,38 +275,38 @@ CREATE OPERATOR <@ (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contain_sphere_point3D(sphere Sphere, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_sphere_point3D(sphere Sphere, point Point3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Sphere, RIGHTARG = Point3D, PROCEDURE = contain_sphere_point3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Sphere, RIGHTARG = Lseg3D, PROCEDURE = contain_sphere_lseg3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_sphere_box3D(sphere Sphere, l Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_sphere_box3D(sphere Sphere, l Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Sphere, RIGHTARG = Box3D, PROCEDURE = contain_sphere_box3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_sphere_path3D(sphere Sphere, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_sphere_path3D(sphere Sphere, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Sphere, RIGHTARG = Path3D, PROCEDURE = contain_sphere_path3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contain_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contain_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Sphere, RIGHTARG = Polygon3D, PROCEDURE = contain_sphere_poly3D,
 	COMMUTATOR = '<@',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
 CREATE OR REPLACE FUNCTION contain_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS boolean AS 
-'MODULE_PATHNAME', 'contain_sphere_sphere' LANGUAGE C IMMUTABLE STRICT;
+'MODULE_PATHNAME', 'contain_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR @> (
 	LEFTARG = Sphere, RIGHTARG = Sphere, PROCEDURE = contain_sphere_sphere,
 	COMMUTATOR = '<@',
@@ -315,13 +315,13 @@ CREATE OPERATOR @> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION contained_sphere_box3D(sphere Sphere, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_sphere_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_sphere_box3D(sphere Sphere, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Sphere, RIGHTARG = Box3D, PROCEDURE = contained_sphere_box3D,
 	COMMUTATOR = '@>',
 	RESTRICT = contsel3D, JOIN = contjoinsel3D
 );
-CREATE OR REPLACE FUNCTION contained_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_sphere_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION contained_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <@ (
 	LEFTARG = Sphere, RIGHTARG = Sphere, PROCEDURE = contained_sphere_sphere,
 	COMMUTATOR = '@>',
@@ -332,14 +332,14 @@ CREATE OPERATOR <@ (
  * Overlap functions 
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION overlap_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Lseg3D, RIGHTARG = Lseg3D, PROCEDURE = overlap_lseg3D_lseg3D,
 	COMMUTATOR = '&&',
 	RESTRICT = areasel, JOIN = areajoinsel
 );
 
-CREATE OR REPLACE FUNCTION overlap_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Lseg3D, RIGHTARG = Line3D, PROCEDURE = overlap_lseg3D_line3D,
 	COMMUTATOR = '&&',
@@ -348,7 +348,7 @@ CREATE OPERATOR && (
  
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION overlap_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Line3D, RIGHTARG = Lseg3D, PROCEDURE = overlap_line3D_lseg3D,
 	COMMUTATOR = '&&',
@@ -357,19 +357,19 @@ CREATE OPERATOR && (
  
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION overlap_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_box3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Box3D, RIGHTARG = Box3D, PROCEDURE = overlap_box3D_box3D,
 	COMMUTATOR = '&&',
 	RESTRICT = areasel, JOIN = areajoinsel
 );
-CREATE OR REPLACE FUNCTION overlap_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Box3D, RIGHTARG = Polygon3D, PROCEDURE = overlap_box3D_poly3D,
 	COMMUTATOR = '&&',
 	RESTRICT = areasel, JOIN = areajoinsel
 );
-CREATE OR REPLACE FUNCTION overlap_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_box3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Box3D, RIGHTARG = Sphere, PROCEDURE = overlap_box3D_sphere,
 	COMMUTATOR = '&&',
@@ -378,20 +378,20 @@ CREATE OPERATOR && (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION overlap_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Polygon3D, RIGHTARG = Box3D, PROCEDURE = overlap_poly3D_box3D,
 	COMMUTATOR = '&&',
 	RESTRICT = areasel, JOIN = areajoinsel
 );
-CREATE OR REPLACE FUNCTION overlap_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Polygon3D, RIGHTARG = Polygon3D, PROCEDURE = overlap_poly3D_poly3D,
 	COMMUTATOR = '&&',
 	RESTRICT = areasel, JOIN = areajoinsel
 );
 /*
-CREATE OR REPLACE FUNCTION overlap_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Polygon3D, RIGHTARG = Sphere, PROCEDURE = overlap_poly3D_sphere,
 	COMMUTATOR = '&&',
@@ -401,21 +401,21 @@ CREATE OPERATOR && (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION overlap_sphere_box3D(sphere Sphere, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_sphere_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_sphere_box3D(sphere Sphere, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Sphere, RIGHTARG = Box3D, PROCEDURE = overlap_sphere_box3D,
 	COMMUTATOR = '&&',
 	RESTRICT = areasel, JOIN = areajoinsel
 );
 /*
-CREATE OR REPLACE FUNCTION overlap_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Sphere, RIGHTARG = Polygon3D, PROCEDURE = overlap_sphere_poly3D,
 	COMMUTATOR = '&&',
 	RESTRICT = areasel, JOIN = areajoinsel
 );
 */
-CREATE OR REPLACE FUNCTION overlap_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_sphere_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION overlap_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR && (
 	LEFTARG = Sphere, RIGHTARG = Sphere, PROCEDURE = overlap_sphere_sphere,
 	COMMUTATOR = '&&',
@@ -426,32 +426,32 @@ CREATE OPERATOR && (
  * Intersect functions
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION intersect_lseg3D_lseg3D(s1 Lseg3D, s2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_lseg3D_lseg3D(s1 Lseg3D, s2 Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Lseg3D, RIGHTARG = Lseg3D, PROCEDURE = intersect_lseg3D_lseg3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Lseg3D, RIGHTARG = Line3D, PROCEDURE = intersect_lseg3D_line3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Lseg3D, RIGHTARG = Box3D, PROCEDURE = intersect_lseg3D_box3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Lseg3D, RIGHTARG = Path3D, PROCEDURE = intersect_lseg3D_path3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Lseg3D, RIGHTARG = Polygon3D, PROCEDURE = intersect_lseg3D_poly3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Lseg3D, RIGHTARG = Sphere, PROCEDURE = intersect_lseg3D_sphere,
 	COMMUTATOR = ?#
@@ -459,32 +459,32 @@ CREATE OPERATOR ?# (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION intersect_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Line3D, RIGHTARG = Lseg3D, PROCEDURE = intersect_line3D_lseg3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Line3D, RIGHTARG = Line3D, PROCEDURE = intersect_line3D_line3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_line3D_box3D(line Line3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_line3D_box3D(line Line3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Line3D, RIGHTARG = Box3D, PROCEDURE = intersect_line3D_box3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_line3D_path3D(line Line3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_line3D_path3D(line Line3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Line3D, RIGHTARG = Path3D, PROCEDURE = intersect_line3D_path3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Line3D, RIGHTARG = Polygon3D, PROCEDURE = intersect_line3D_poly3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_line3D_sphere(line Line3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_line3D_sphere(line Line3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_line3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Line3D, RIGHTARG = Sphere, PROCEDURE = intersect_line3D_sphere,
 	COMMUTATOR = ?#
@@ -492,32 +492,32 @@ CREATE OPERATOR ?# (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION intersect_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Box3D, RIGHTARG = Lseg3D, PROCEDURE = intersect_box3D_lseg3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_box3D_line3D(box Box3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_box3D_line3D(box Box3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Box3D, RIGHTARG = Line3D, PROCEDURE = intersect_box3D_line3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Box3D, RIGHTARG = Box3D, PROCEDURE = intersect_box3D_box3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_box3D_path3D(box Box3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_box3D_path3D(box Box3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Box3D, RIGHTARG = Path3D, PROCEDURE = intersect_box3D_path3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Box3D, RIGHTARG = Polygon3D, PROCEDURE = intersect_box3D_poly3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_box3D_sphere(box Box3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Box3D, RIGHTARG = Sphere, PROCEDURE = intersect_box3D_sphere,
 	COMMUTATOR = ?#
@@ -525,32 +525,32 @@ CREATE OPERATOR ?# (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION intersect_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Path3D, RIGHTARG = Lseg3D, PROCEDURE = intersect_path3D_lseg3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_path3D_line3D(path Path3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_path3D_line3D(path Path3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Path3D, RIGHTARG = Line3D, PROCEDURE = intersect_path3D_line3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_path3D_box3D(path Path3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_path3D_box3D(path Path3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Path3D, RIGHTARG = Box3D, PROCEDURE = intersect_path3D_box3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Path3D, RIGHTARG = Path3D, PROCEDURE = intersect_path3D_path3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Path3D, RIGHTARG = Polygon3D, PROCEDURE = intersect_path3D_poly3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_path3D_sphere(path Path3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_path3D_sphere(path Path3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_path3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Path3D, RIGHTARG = Sphere, PROCEDURE = intersect_path3D_sphere,
 	COMMUTATOR = ?#
@@ -558,32 +558,32 @@ CREATE OPERATOR ?# (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION intersect_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Polygon3D, RIGHTARG = Lseg3D, PROCEDURE = intersect_poly3D_lseg3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Polygon3D, RIGHTARG = Line3D, PROCEDURE = intersect_poly3D_line3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Polygon3D, RIGHTARG = Box3D, PROCEDURE = intersect_poly3D_box3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Polygon3D, RIGHTARG = Path3D, PROCEDURE = intersect_poly3D_path3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Polygon3D, RIGHTARG = Polygon3D, PROCEDURE = intersect_poly3D_poly3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Polygon3D, RIGHTARG = Sphere, PROCEDURE = intersect_poly3D_sphere,
 	COMMUTATOR = ?#
@@ -591,32 +591,32 @@ CREATE OPERATOR ?# (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION intersect_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Sphere, RIGHTARG = Lseg3D, PROCEDURE = intersect_sphere_lseg3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_sphere_line3D(sphere Sphere, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_sphere_line3D(sphere Sphere, line Line3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Sphere, RIGHTARG = Line3D, PROCEDURE = intersect_sphere_line3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_sphere_box3D(sphere Sphere, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_sphere_box3D(sphere Sphere, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Sphere, RIGHTARG = Box3D, PROCEDURE = intersect_sphere_box3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_sphere_path3D(sphere Sphere, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_sphere_path3D(sphere Sphere, path Path3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Sphere, RIGHTARG = Path3D, PROCEDURE = intersect_sphere_path3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Sphere, RIGHTARG = Polygon3D, PROCEDURE = intersect_sphere_poly3D,
 	COMMUTATOR = ?#
 );
-CREATE OR REPLACE FUNCTION intersect_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION intersect_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS boolean AS 'MODULE_PATHNAME', 'intersect_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ?# (
 	LEFTARG = Sphere, RIGHTARG = Sphere, PROCEDURE = intersect_sphere_sphere,
 	COMMUTATOR = ?#
@@ -626,32 +626,32 @@ CREATE OPERATOR ?# (
  * Intersection point functions
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION interpoint_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Lseg3D, RIGHTARG = Lseg3D, PROCEDURE = interpoint_lseg3D_lseg3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Lseg3D, RIGHTARG = Line3D, PROCEDURE = interpoint_lseg3D_line3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Lseg3D, RIGHTARG = Box3D, PROCEDURE = interpoint_lseg3D_box3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Lseg3D, RIGHTARG = Path3D, PROCEDURE = interpoint_lseg3D_path3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_lseg3D_poly3D(lseg Lseg3D, path Polygon3D) RETURNS Polygon3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_lseg3D_poly3D(lseg Lseg3D, path Polygon3D) RETURNS Polygon3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Lseg3D, RIGHTARG = Polygon3D, PROCEDURE = interpoint_lseg3D_poly3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Lseg3D, RIGHTARG = Sphere, PROCEDURE = interpoint_lseg3D_sphere,
 	COMMUTATOR = #
@@ -659,32 +659,32 @@ CREATE OPERATOR # (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION interpoint_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Line3D, RIGHTARG = Lseg3D, PROCEDURE = interpoint_line3D_lseg3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Line3D, RIGHTARG = Line3D, PROCEDURE = interpoint_line3D_line3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_line3D_box3D(line Line3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_line3D_box3D(line Line3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Line3D, RIGHTARG = Box3D, PROCEDURE = interpoint_line3D_box3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_line3D_path3D(line Line3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_line3D_path3D(line Line3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Line3D, RIGHTARG = Path3D, PROCEDURE = interpoint_line3D_path3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Line3D, RIGHTARG = Polygon3D, PROCEDURE = interpoint_line3D_poly3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_line3D_sphere(line Line3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_line3D_sphere(line Line3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_line3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Line3D, RIGHTARG = Sphere, PROCEDURE = interpoint_line3D_sphere,
 	COMMUTATOR = #
@@ -692,32 +692,32 @@ CREATE OPERATOR # (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION interpoint_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Box3D, RIGHTARG = Lseg3D, PROCEDURE = interpoint_box3D_lseg3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_box3D_line3D(box Box3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_box3D_line3D(box Box3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Box3D, RIGHTARG = Line3D, PROCEDURE = interpoint_box3D_line3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Box3D, RIGHTARG = Box3D, PROCEDURE = interpoint_box3D_box3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_box3D_path3D(box Box3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_box3D_path3D(box Box3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Box3D, RIGHTARG = Path3D, PROCEDURE = interpoint_box3D_path3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Box3D, RIGHTARG = Polygon3D, PROCEDURE = interpoint_box3D_poly3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_box3D_sphere(box Box3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_box3D_sphere(box Box3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Box3D, RIGHTARG = Sphere, PROCEDURE = interpoint_box3D_sphere,
 	COMMUTATOR = #
@@ -725,32 +725,32 @@ CREATE OPERATOR # (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION interpoint_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Path3D, RIGHTARG = Lseg3D, PROCEDURE = interpoint_path3D_lseg3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_path3D_line3D(path Path3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_path3D_line3D(path Path3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Path3D, RIGHTARG = Line3D, PROCEDURE = interpoint_path3D_line3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_path3D_box3D(path Path3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_path3D_box3D(path Path3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Path3D, RIGHTARG = Box3D, PROCEDURE = interpoint_path3D_box3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Path3D, RIGHTARG = Path3D, PROCEDURE = interpoint_path3D_path3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Path3D, RIGHTARG = Polygon3D, PROCEDURE = interpoint_path3D_poly3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_path3D_sphere(path Path3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_path3D_sphere(path Path3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_path3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Path3D, RIGHTARG = Sphere, PROCEDURE = interpoint_path3D_sphere,
 	COMMUTATOR = #
@@ -758,32 +758,32 @@ CREATE OPERATOR # (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION interpoint_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Polygon3D, RIGHTARG = Lseg3D, PROCEDURE = interpoint_poly3D_lseg3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Polygon3D, RIGHTARG = Line3D, PROCEDURE = interpoint_poly3D_line3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Polygon3D, RIGHTARG = Box3D, PROCEDURE = interpoint_poly3D_box3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Polygon3D, RIGHTARG = Path3D, PROCEDURE = interpoint_poly3D_path3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Polygon3D, RIGHTARG = Polygon3D, PROCEDURE = interpoint_poly3D_poly3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Polygon3D, RIGHTARG = Sphere, PROCEDURE = interpoint_poly3D_sphere,
 	COMMUTATOR = #
@@ -791,32 +791,32 @@ CREATE OPERATOR # (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION interpoint_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Sphere, RIGHTARG = Lseg3D, PROCEDURE = interpoint_sphere_lseg3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_sphere_line3D(sphere Sphere, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_sphere_line3D(sphere Sphere, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Sphere, RIGHTARG = Line3D, PROCEDURE = interpoint_sphere_line3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_sphere_box3D(sphere Sphere, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_sphere_box3D(sphere Sphere, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Sphere, RIGHTARG = Box3D, PROCEDURE = interpoint_sphere_box3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_sphere_path3D(sphere Sphere, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_sphere_path3D(sphere Sphere, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Sphere, RIGHTARG = Path3D, PROCEDURE = interpoint_sphere_path3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Sphere, RIGHTARG = Polygon3D, PROCEDURE = interpoint_sphere_poly3D,
 	COMMUTATOR = #
 );
-CREATE OR REPLACE FUNCTION interpoint_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION interpoint_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'interpoint_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR # (
 	LEFTARG = Sphere, RIGHTARG = Sphere, PROCEDURE = interpoint_sphere_sphere,
 	COMMUTATOR = #
@@ -826,43 +826,44 @@ CREATE OPERATOR # (
  * Intersection functions
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION box3D_intersection(box1 Box3D, box2 Box3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'box3D_intersection' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION box3D_intersection(box1 Box3D, box2 Box3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'box3D_intersection' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION expand(box Box3D, dist float8) RETURNS Box3D AS 'MODULE_PATHNAME', 'box3D_expand_dist' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 
 /******************************************************************************
  * Distance functions 
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION distance_point3D_point3D(point1 Point3D, point2 Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_point3D_point3D(point1 Point3D, point2 Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Point3D, RIGHTARG = Point3D, PROCEDURE = distance_point3D_point3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_point3D_lseg3D(point Point3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_point3D_lseg3D(point Point3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Point3D, RIGHTARG = Lseg3D, PROCEDURE = distance_point3D_lseg3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_point3D_line3D(point Point3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_point3D_line3D(point Point3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Point3D, RIGHTARG = Line3D, PROCEDURE = distance_point3D_line3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_point3D_box3D(point Point3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_point3D_box3D(point Point3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Point3D, RIGHTARG = Box3D, PROCEDURE = distance_point3D_box3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_point3D_path3D(point Point3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_point3D_path3D(point Point3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Point3D, RIGHTARG = Path3D, PROCEDURE = distance_point3D_path3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_point3D_poly3D(point Point3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_point3D_poly3D(point Point3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Point3D, RIGHTARG = Polygon3D, PROCEDURE = distance_point3D_poly3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_point3D_sphere(point Point3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_point3D_sphere(point Point3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Point3D, RIGHTARG = Sphere, PROCEDURE = distance_point3D_sphere,
 	COMMUTATOR = '<->'
@@ -870,37 +871,37 @@ CREATE OPERATOR <-> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION distance_lseg3D_point3D(lseg Lseg3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_lseg3D_point3D(lseg Lseg3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Lseg3D, RIGHTARG = Point3D, PROCEDURE = distance_lseg3D_point3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_lseg3D_lseg3D(lseg1 Lseg3D, lseg2 Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Lseg3D, RIGHTARG = Lseg3D, PROCEDURE = distance_lseg3D_lseg3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Lseg3D, RIGHTARG = Line3D, PROCEDURE = distance_lseg3D_line3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Lseg3D, RIGHTARG = Box3D, PROCEDURE = distance_lseg3D_box3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Lseg3D, RIGHTARG = Path3D, PROCEDURE = distance_lseg3D_path3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Lseg3D, RIGHTARG = Polygon3D, PROCEDURE = distance_lseg3D_poly3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Lseg3D, RIGHTARG = Sphere, PROCEDURE = distance_lseg3D_sphere,
 	COMMUTATOR = '<->'
@@ -908,37 +909,37 @@ CREATE OPERATOR <-> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION distance_line3D_point3D(line Line3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_line3D_point3D(line Line3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Line3D, RIGHTARG = Point3D, PROCEDURE = distance_line3D_point3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Line3D, RIGHTARG = Lseg3D, PROCEDURE = distance_line3D_lseg3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Line3D, RIGHTARG = Line3D, PROCEDURE = distance_line3D_line3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_line3D_box3D(line Line3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_line3D_box3D(line Line3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Line3D, RIGHTARG = Box3D, PROCEDURE = distance_line3D_box3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_line3D_path3D(line Line3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_line3D_path3D(line Line3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Line3D, RIGHTARG = Path3D, PROCEDURE = distance_line3D_path3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Line3D, RIGHTARG = Polygon3D, PROCEDURE = distance_line3D_poly3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_line3D_sphere(line Line3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_line3D_sphere(line Line3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_line3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Line3D, RIGHTARG = Sphere, PROCEDURE = distance_line3D_sphere,
 	COMMUTATOR = '<->'
@@ -946,37 +947,37 @@ CREATE OPERATOR <-> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION distance_box3D_point3D(box Box3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_box3D_point3D(box Box3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Box3D, RIGHTARG = Point3D, PROCEDURE = distance_box3D_point3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Box3D, RIGHTARG = Lseg3D, PROCEDURE = distance_box3D_lseg3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_box3D_line3D(box Box3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_box3D_line3D(box Box3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Box3D, RIGHTARG = Line3D, PROCEDURE = distance_box3D_line3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Box3D, RIGHTARG = Box3D, PROCEDURE = distance_box3D_box3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_box3D_path3D(box Box3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_box3D_path3D(box Box3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Box3D, RIGHTARG = Path3D, PROCEDURE = distance_box3D_path3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Box3D, RIGHTARG = Polygon3D, PROCEDURE = distance_box3D_poly3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_box3D_sphere(box Box3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_box3D_sphere(box Box3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Box3D, RIGHTARG = Sphere, PROCEDURE = distance_box3D_sphere,
 	COMMUTATOR = '<->'
@@ -984,37 +985,37 @@ CREATE OPERATOR <-> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION distance_path3D_point3D(path Path3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_path3D_point3D(path Path3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Path3D, RIGHTARG = Point3D, PROCEDURE = distance_path3D_point3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Path3D, RIGHTARG = Lseg3D, PROCEDURE = distance_path3D_lseg3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_path3D_line3D(path Path3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_path3D_line3D(path Path3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Path3D, RIGHTARG = Line3D, PROCEDURE = distance_path3D_line3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_path3D_box3D(path Path3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_path3D_box3D(path Path3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Path3D, RIGHTARG = Box3D, PROCEDURE = distance_path3D_box3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Path3D, RIGHTARG = Path3D, PROCEDURE = distance_path3D_path3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Path3D, RIGHTARG = Polygon3D, PROCEDURE = distance_path3D_poly3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_path3D_sphere(path Path3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_path3D_sphere(path Path3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Path3D, RIGHTARG = Sphere, PROCEDURE = distance_path3D_sphere,
 	COMMUTATOR = '<->'
@@ -1022,37 +1023,37 @@ CREATE OPERATOR <-> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION distance_poly3D_point3D(poly Polygon3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_poly3D_point3D(poly Polygon3D, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Polygon3D, RIGHTARG = Point3D, PROCEDURE = distance_poly3D_point3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Polygon3D, RIGHTARG = Lseg3D, PROCEDURE = distance_poly3D_lseg3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Polygon3D, RIGHTARG = Line3D, PROCEDURE = distance_poly3D_line3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Polygon3D, RIGHTARG = Box3D, PROCEDURE = distance_poly3D_box3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Polygon3D, RIGHTARG = Path3D, PROCEDURE = distance_poly3D_path3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Polygon3D, RIGHTARG = Polygon3D, PROCEDURE = distance_poly3D_poly3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Polygon3D, RIGHTARG = Sphere, PROCEDURE = distance_poly3D_sphere,
 	COMMUTATOR = '<->'
@@ -1060,72 +1061,144 @@ CREATE OPERATOR <-> (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION distance_sphere_point3D(sphere Sphere, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_point3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_sphere_point3D(sphere Sphere, point Point3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Sphere, RIGHTARG = Point3D, PROCEDURE = distance_sphere_point3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Sphere, RIGHTARG = Lseg3D, PROCEDURE = distance_sphere_lseg3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_sphere_line3D(sphere Sphere, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_sphere_line3D(sphere Sphere, line Line3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Sphere, RIGHTARG = Line3D, PROCEDURE = distance_sphere_line3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_sphere_box3D(sphere Sphere, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_sphere_box3D(sphere Sphere, box Box3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Sphere, RIGHTARG = Box3D, PROCEDURE = distance_sphere_box3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_sphere_path3D(sphere Sphere, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_sphere_path3D(sphere Sphere, path Path3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Sphere, RIGHTARG = Path3D, PROCEDURE = distance_sphere_path3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Sphere, RIGHTARG = Polygon3D, PROCEDURE = distance_sphere_poly3D,
 	COMMUTATOR = '<->'
 );
-CREATE OR REPLACE FUNCTION distance_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION distance_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS float AS 'MODULE_PATHNAME', 'distance_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR <-> (
 	LEFTARG = Sphere, RIGHTARG = Sphere, PROCEDURE = distance_sphere_sphere,
 	COMMUTATOR = '<->'
 );
 
+/******************************************************************************
+ * Within distance functions
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION dwithin3D(point1 Point3D, point2 Point3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_point3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(point Point3D, lseg Lseg3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_point3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(point Point3D, line Line3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_point3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(point Point3D, box Box3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_point3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(point Point3D, path Path3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_point3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(point Point3D, poly Polygon3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_point3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(point Point3D, sphere Sphere, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_point3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION dwithin3D(lseg Lseg3D, point Point3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_lseg3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(lseg1 Lseg3D, lseg2 Lseg3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(lseg Lseg3D, line Line3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(lseg Lseg3D, box Box3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(lseg Lseg3D, path Path3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(lseg Lseg3D, poly Polygon3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(lseg Lseg3D, sphere Sphere, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION dwithin3D(line Line3D, point Point3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_line3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(line Line3D, lseg Lseg3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(line1 Line3D, line2 Line3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_line3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(line Line3D, box Box3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_line3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(line Line3D, path Path3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_line3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(line Line3D, poly Polygon3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(line Line3D, sphere Sphere, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_line3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION dwithin3D(box Box3D, point Point3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_box3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(box Box3D, lseg Lseg3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(box Box3D, line Line3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_box3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(box1 Box3D, box2 Box3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(box Box3D, path Path3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_box3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(box Box3D, poly Polygon3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(box Box3D, sphere Sphere, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION dwithin3D(path Path3D, point Point3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_path3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(path Path3D, lseg Lseg3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(path Path3D, line Line3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_path3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(path Path3D, box Box3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_path3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(path1 Path3D, path2 Path3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_path3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(path Path3D, poly Polygon3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(path Path3D, sphere Sphere, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_path3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION dwithin3D(poly Polygon3D, point Point3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_poly3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(poly Polygon3D, lseg Lseg3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(poly Polygon3D, line Line3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(poly Polygon3D, box Box3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(poly Polygon3D, path Path3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(poly1 Polygon3D, poly2 Polygon3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(poly Polygon3D, sphere Sphere, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION dwithin3D(sphere Sphere, point Point3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_sphere_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(sphere Sphere, lseg Lseg3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(sphere Sphere, line Line3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_sphere_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(sphere Sphere, box Box3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(sphere Sphere, path Path3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_sphere_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(sphere Sphere, poly Polygon3D, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D(sphere1 Sphere, sphere2 Sphere, dist float8) RETURNS boolean AS 'MODULE_PATHNAME', 'dwithin_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
 /******************************************************************************
  * Closest point functions
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION closestpoint_point3D_lseg3D(point Point3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_point3D_lseg3D(point Point3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Point3D, RIGHTARG = Lseg3D, PROCEDURE = closestpoint_point3D_lseg3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_point3D_line3D(point Point3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_point3D_line3D(point Point3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Point3D, RIGHTARG = Line3D, PROCEDURE = closestpoint_point3D_line3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_point3D_box3D(point Point3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_point3D_box3D(point Point3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Point3D, RIGHTARG = Box3D, PROCEDURE = closestpoint_point3D_box3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_point3D_path3D(point Point3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_point3D_path3D(point Point3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Point3D, RIGHTARG = Path3D, PROCEDURE = closestpoint_point3D_path3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_point3D_poly3D(point Point3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_point3D_poly3D(point Point3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Point3D, RIGHTARG = Polygon3D, PROCEDURE = closestpoint_point3D_poly3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_point3D_sphere(point Point3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_point3D_sphere(point Point3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_point3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Point3D, RIGHTARG = Sphere, PROCEDURE = closestpoint_point3D_sphere,
 	COMMUTATOR = ##
@@ -1133,32 +1206,32 @@ CREATE OPERATOR ## (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION closestpoint_lseg3D_lseg3D(s1 Lseg3D, s2 Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_lseg3D_lseg3D(s1 Lseg3D, s2 Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Lseg3D, RIGHTARG = Lseg3D, PROCEDURE = closestpoint_lseg3D_lseg3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_lseg3D_line3D(lseg Lseg3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Lseg3D, RIGHTARG = Line3D, PROCEDURE = closestpoint_lseg3D_line3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_lseg3D_box3D(lseg Lseg3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Lseg3D, RIGHTARG = Box3D, PROCEDURE = closestpoint_lseg3D_box3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_lseg3D_path3D(lseg Lseg3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Lseg3D, RIGHTARG = Path3D, PROCEDURE = closestpoint_lseg3D_path3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_lseg3D_poly3D(lseg Lseg3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Lseg3D, RIGHTARG = Polygon3D, PROCEDURE = closestpoint_lseg3D_poly3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_lseg3D_sphere(lseg Lseg3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_lseg3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Lseg3D, RIGHTARG = Sphere, PROCEDURE = closestpoint_lseg3D_sphere,
 	COMMUTATOR = ##
@@ -1166,32 +1239,32 @@ CREATE OPERATOR ## (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION closestpoint_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_line3D_lseg3D(line Line3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Line3D, RIGHTARG = Lseg3D, PROCEDURE = closestpoint_line3D_lseg3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_line3D_line3D(line1 Line3D, line2 Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Line3D, RIGHTARG = Line3D, PROCEDURE = closestpoint_line3D_line3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_line3D_box3D(line Line3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_line3D_box3D(line Line3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Line3D, RIGHTARG = Box3D, PROCEDURE = closestpoint_line3D_box3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_line3D_path3D(line Line3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_line3D_path3D(line Line3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Line3D, RIGHTARG = Path3D, PROCEDURE = closestpoint_line3D_path3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_line3D_poly3D(line Line3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Line3D, RIGHTARG = Polygon3D, PROCEDURE = closestpoint_line3D_poly3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_line3D_sphere(line Line3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_line3D_sphere(line Line3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_line3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Line3D, RIGHTARG = Sphere, PROCEDURE = closestpoint_line3D_sphere,
 	COMMUTATOR = ##
@@ -1199,32 +1272,32 @@ CREATE OPERATOR ## (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION closestpoint_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_box3D_lseg3D(box Box3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Box3D, RIGHTARG = Lseg3D, PROCEDURE = closestpoint_box3D_lseg3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_box3D_line3D(box Box3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_box3D_line3D(box Box3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Box3D, RIGHTARG = Line3D, PROCEDURE = closestpoint_box3D_line3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_box3D_box3D(box1 Box3D, box2 Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Box3D, RIGHTARG = Box3D, PROCEDURE = closestpoint_box3D_box3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_box3D_path3D(box Box3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_box3D_path3D(box Box3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Box3D, RIGHTARG = Path3D, PROCEDURE = closestpoint_box3D_path3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_box3D_poly3D(box Box3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Box3D, RIGHTARG = Polygon3D, PROCEDURE = closestpoint_box3D_poly3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_box3D_sphere(box Box3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_box3D_sphere(box Box3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_box3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Box3D, RIGHTARG = Sphere, PROCEDURE = closestpoint_box3D_sphere,
 	COMMUTATOR = ##
@@ -1232,32 +1305,32 @@ CREATE OPERATOR ## (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION closestpoint_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_path3D_lseg3D(path Path3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Path3D, RIGHTARG = Lseg3D, PROCEDURE = closestpoint_path3D_lseg3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_path3D_line3D(path Path3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_path3D_line3D(path Path3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Path3D, RIGHTARG = Line3D, PROCEDURE = closestpoint_path3D_line3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_path3D_box3D(path Path3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_path3D_box3D(path Path3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Path3D, RIGHTARG = Box3D, PROCEDURE = closestpoint_path3D_box3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_path3D_path3D(path1 Path3D, path2 Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Path3D, RIGHTARG = Path3D, PROCEDURE = closestpoint_path3D_path3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_path3D_poly3D(path Path3D, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Path3D, RIGHTARG = Polygon3D, PROCEDURE = closestpoint_path3D_poly3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_path3D_sphere(path Path3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_path3D_sphere(path Path3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_path3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Path3D, RIGHTARG = Sphere, PROCEDURE = closestpoint_path3D_sphere,
 	COMMUTATOR = ##
@@ -1265,32 +1338,32 @@ CREATE OPERATOR ## (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION closestpoint_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_poly3D_lseg3D(poly Polygon3D, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Polygon3D, RIGHTARG = Lseg3D, PROCEDURE = closestpoint_poly3D_lseg3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_poly3D_line3D(poly Polygon3D, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Polygon3D, RIGHTARG = Line3D, PROCEDURE = closestpoint_poly3D_line3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_poly3D_box3D(poly Polygon3D, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Polygon3D, RIGHTARG = Box3D, PROCEDURE = closestpoint_poly3D_box3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_poly3D_path3D(poly Polygon3D, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Polygon3D, RIGHTARG = Path3D, PROCEDURE = closestpoint_poly3D_path3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_poly3D_poly3D(poly1 Polygon3D, poly2 Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Polygon3D, RIGHTARG = Polygon3D, PROCEDURE = closestpoint_poly3D_poly3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_poly3D_sphere(poly Polygon3D, sphere Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_poly3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Polygon3D, RIGHTARG = Sphere, PROCEDURE = closestpoint_poly3D_sphere,
 	COMMUTATOR = ##
@@ -1298,37 +1371,91 @@ CREATE OPERATOR ## (
 
 /******************************************************************************/
 
-CREATE OR REPLACE FUNCTION closestpoint_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_sphere_lseg3D(sphere Sphere, lseg Lseg3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Sphere, RIGHTARG = Lseg3D, PROCEDURE = closestpoint_sphere_lseg3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_sphere_line3D(sphere Sphere, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_line3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_sphere_line3D(sphere Sphere, line Line3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_line3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Sphere, RIGHTARG = Line3D, PROCEDURE = closestpoint_sphere_line3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_sphere_box3D(sphere Sphere, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_box3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_sphere_box3D(sphere Sphere, box Box3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Sphere, RIGHTARG = Box3D, PROCEDURE = closestpoint_sphere_box3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_sphere_path3D(sphere Sphere, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_path3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_sphere_path3D(sphere Sphere, path Path3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Sphere, RIGHTARG = Path3D, PROCEDURE = closestpoint_sphere_path3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_sphere_poly3D(sphere Sphere, poly Polygon3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Sphere, RIGHTARG = Polygon3D, PROCEDURE = closestpoint_sphere_poly3D,
 	COMMUTATOR = ##
 );
-CREATE OR REPLACE FUNCTION closestpoint_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_sphere' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION closestpoint_sphere_sphere(sphere1 Sphere, sphere2 Sphere) RETURNS Point3D AS 'MODULE_PATHNAME', 'closestpoint_sphere_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 CREATE OPERATOR ## (
 	LEFTARG = Sphere, RIGHTARG = Sphere, PROCEDURE = closestpoint_sphere_sphere,
 	COMMUTATOR = ##
 );
 
+/******************************************************************************
+ * Planner support functions
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION overlap3D_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'overlap3D_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION contain3D_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'contain3D_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION contained3D_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'contained3D_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION dwithin3D_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'dwithin3D_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION cost3D_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'cost3D_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/*
+ * Support functions can be attached to functions from PostgreSQL 12. They
+ * let the planner use an index for the functions of this file behind the
+ * topological operators, and for dwithin3D, and estimate the cost of the
+ * functions of this file from the number of vertices of their Path3D and
+ * Polygon3D arguments.
+ */
+DO $$
+DECLARE
+	fn regprocedure;
+	support text;
+BEGIN
+	IF current_setting('server_version_num')::int >= 120000 THEN
+		FOR fn, support IN
+			SELECT p.oid,
+				CASE
+					WHEN p.proname = 'dwithin3d' THEN 'dwithin3D_support'
+					WHEN p.proname LIKE 'contained\_%' THEN 'contained3D_support'
+					WHEN p.proname LIKE 'contain\_%' THEN 'contain3D_support'
+					WHEN p.proname LIKE 'overlap\_%' OR p.proname LIKE 'intersect\_%' THEN 'overlap3D_support'
+					ELSE 'cost3D_support'
+				END
+			FROM pg_proc p
+			/* Only the functions of the extension, not those of the user */
+			WHERE p.oid IN (SELECT d.objid FROM pg_depend d
+					WHERE d.classid = 'pg_proc'::regclass AND
+						d.refclassid = 'pg_extension'::regclass AND
+						d.refobjid = (SELECT oid FROM pg_extension WHERE extname = 'geo3d') AND
+						d.deptype = 'e') AND
+				((p.prorettype = 'boolean'::regtype AND
+				  (p.proname = 'dwithin3d' OR p.proname LIKE 'overlap\_%' OR
+				   p.proname LIKE 'intersect\_%' OR p.proname LIKE 'contain\_%' OR
+				   p.proname LIKE 'contained\_%')) OR
+				 ((p.proname LIKE 'distance\_%' OR p.proname LIKE 'closestpoint\_%' OR
+				   p.proname LIKE 'interpoint\_%') AND
+				  ('Path3D'::regtype::oid = ANY (p.proargtypes) OR
+				   'Polygon3D'::regtype::oid = ANY (p.proargtypes))))
+		LOOP
+			EXECUTE format('ALTER FUNCTION %s SUPPORT %s', fn, support);
+		END LOOP;
+	END IF;
+END;
+$$;
+
 /******************************************************************************/
 
 
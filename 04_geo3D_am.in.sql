@@ -13,15 +13,15 @@
  * Support routines for the GiST access method 
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION gist_box3D_consistent(internal, Box3D, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_box3D_consistent' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_union(internal, internal) RETURNS box3D AS 'MODULE_PATHNAME', 'gist_box3D_union' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_compress' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_decompress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_decompress' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_penalty(internal, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_penalty' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_picksplit(internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_picksplit' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_same(Box3D, Box3D, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_same' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_distance(internal, Box3D, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_point3D_distance' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_box3D_fetch(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_fetch' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION gist_box3D_consistent(internal, Box3D, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_box3D_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_union(internal, internal) RETURNS box3D AS 'MODULE_PATHNAME', 'gist_box3D_union' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_compress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_decompress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_decompress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_penalty(internal, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_penalty' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_picksplit(internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_picksplit' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_same(Box3D, Box3D, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_same' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_distance(internal, Box3D, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_point3D_distance' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3D_fetch(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3D_fetch' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 
 CREATE OPERATOR CLASS gist_box3D_ops
     DEFAULT FOR TYPE Box3D USING gist AS
@@ -160,10 +160,10 @@ CREATE OPERATOR CLASS gist_box3D_ops
 	FUNCTION	8	gist_box3D_distance (internal, Box3D, smallint, oid, internal),
 	FUNCTION	9	gist_box3D_fetch (internal);
 	
-CREATE OR REPLACE FUNCTION gist_point3D_consistent(internal, Point3D, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_point3D_consistent' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_point3D_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_point3D_compress' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_point3D_distance(internal, Point3D, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_point3D_distance' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_point3D_fetch(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_point3D_fetch' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION gist_point3D_consistent(internal, Point3D, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_point3D_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_point3D_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_point3D_compress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_point3D_distance(internal, Point3D, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_point3D_distance' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_point3D_fetch(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_point3D_fetch' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 
 CREATE OPERATOR CLASS gist_point3D_ops
     DEFAULT FOR TYPE point3D USING gist AS
@@ -293,9 +293,9 @@ CREATE OPERATOR CLASS gist_point3D_ops
 	FUNCTION	8	gist_point3D_distance (internal, Point3D, smallint, oid, internal),
 	FUNCTION	9	gist_point3D_fetch (internal);
 
-CREATE OR REPLACE FUNCTION gist_sphere_consistent(internal, Sphere, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_type3D_consistent' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_sphere_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_sphere_compress' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION gist_sphere_distance(internal, Sphere, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_sphere_distance' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION gist_sphere_consistent(internal, Sphere, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_type3D_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_sphere_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_sphere_compress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_sphere_distance(internal, Sphere, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_sphere_distance' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 
 CREATE OPERATOR CLASS gist_sphere_ops
     DEFAULT FOR TYPE sphere USING gist AS
@@ -436,11 +436,11 @@ CREATE OPERATOR CLASS gist_sphere_ops
  * Support routines for the SP-GiST octree access method
  *****************************************************************************/
 
-CREATE OR REPLACE FUNCTION spgist_octree_config(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_config' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION spgist_octree_choose(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_choose' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION spgist_octree_picksplit(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_picksplit' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION spgist_octree_inner_consistent(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_inner_consistent' LANGUAGE C IMMUTABLE STRICT;
-CREATE OR REPLACE FUNCTION spgist_octree_leaf_consistent(internal, internal) RETURNS boolean AS 'MODULE_PATHNAME', 'spgist_octree_leaf_consistent' LANGUAGE C IMMUTABLE STRICT;
+CREATE OR REPLACE FUNCTION spgist_octree_config(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_config' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION spgist_octree_choose(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_choose' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION spgist_octree_picksplit(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_picksplit' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION spgist_octree_inner_consistent(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octree_inner_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION spgist_octree_leaf_consistent(internal, internal) RETURNS boolean AS 'MODULE_PATHNAME', 'spgist_octree_leaf_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
 
 CREATE OPERATOR CLASS spgist_octree_ops
 	DEFAULT FOR TYPE Point3D
@@ -508,6 +508,82 @@ CREATE OPERATOR CLASS spgist_octree_ops
 	FUNCTION	3	spgist_octree_picksplit(internal, internal),
 	FUNCTION	4	spgist_octree_inner_consistent(internal, internal),
 	FUNCTION	5	spgist_octree_leaf_consistent(internal, internal);
+
+/******************************************************************************
+ * Support routines for the GIN octree access method
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION gin_box3D_extract_value(Box3D, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gin_box3D_extract_value' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_box3D_extract_query(Box3D, internal, int2, internal, internal, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gin_geo3D_extract_query' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_box3D_consistent(internal, int2, Box3D, int4, internal, internal, internal, internal) RETURNS boolean AS 'MODULE_PATHNAME', 'gin_geo3D_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_poly3D_extract_value(Polygon3D, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gin_poly3D_extract_value' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_poly3D_extract_query(Polygon3D, internal, int2, internal, internal, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gin_geo3D_extract_query' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_poly3D_consistent(internal, int2, Polygon3D, int4, internal, internal, internal, internal) RETURNS boolean AS 'MODULE_PATHNAME', 'gin_geo3D_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_path3D_extract_value(Path3D, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gin_path3D_extract_value' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_path3D_extract_query(Path3D, internal, int2, internal, internal, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'gin_geo3D_extract_query' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_path3D_consistent(internal, int2, Path3D, int4, internal, internal, internal, internal) RETURNS boolean AS 'MODULE_PATHNAME', 'gin_geo3D_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gin_geo3D_options(internal) RETURNS void AS 'MODULE_PATHNAME', 'gin_geo3D_options' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE OPERATOR CLASS gin_box3D_ops
+    DEFAULT FOR TYPE Box3D USING gin AS
+	-- overlaps
+	OPERATOR	123	&& (Box3D, Box3D),
+	OPERATOR	203	&& (Box3D, Polygon3D),
+	OPERATOR	243	&& (Box3D, Sphere),
+	-- intersects
+	OPERATOR	152	?# (Box3D, Box3D),
+	OPERATOR	192	?# (Box3D, Path3D),
+	OPERATOR	232	?# (Box3D, Polygon3D),
+	OPERATOR	272	?# (Box3D, Sphere),
+	-- functions
+	FUNCTION	1	btint8cmp (int8, int8),
+	FUNCTION	2	gin_box3D_extract_value (Box3D, internal, internal),
+	FUNCTION	3	gin_box3D_extract_query (Box3D, internal, int2, internal, internal, internal, internal),
+	FUNCTION	4	gin_box3D_consistent (internal, int2, Box3D, int4, internal, internal, internal, internal),
+	STORAGE		int8;
+
+CREATE OPERATOR CLASS gin_poly3D_ops
+    DEFAULT FOR TYPE Polygon3D USING gin AS
+	-- overlaps
+	OPERATOR	123	&& (Polygon3D, Box3D),
+	OPERATOR	203	&& (Polygon3D, Polygon3D),
+	OPERATOR	243	&& (Polygon3D, Sphere),
+	-- intersects
+	OPERATOR	152	?# (Polygon3D, Box3D),
+	OPERATOR	192	?# (Polygon3D, Path3D),
+	OPERATOR	232	?# (Polygon3D, Polygon3D),
+	OPERATOR	272	?# (Polygon3D, Sphere),
+	-- functions
+	FUNCTION	1	btint8cmp (int8, int8),
+	FUNCTION	2	gin_poly3D_extract_value (Polygon3D, internal, internal),
+	FUNCTION	3	gin_poly3D_extract_query (Polygon3D, internal, int2, internal, internal, internal, internal),
+	FUNCTION	4	gin_poly3D_consistent (internal, int2, Polygon3D, int4, internal, internal, internal, internal),
+	STORAGE		int8;
+
+CREATE OPERATOR CLASS gin_path3D_ops
+    DEFAULT FOR TYPE Path3D USING gin AS
+	-- intersects
+	OPERATOR	152	?# (Path3D, Box3D),
+	OPERATOR	192	?# (Path3D, Path3D),
+	OPERATOR	232	?# (Path3D, Polygon3D),
+	OPERATOR	272	?# (Path3D, Sphere),
+	-- functions
+	FUNCTION	1	btint8cmp (int8, int8),
+	FUNCTION	2	gin_path3D_extract_value (Path3D, internal, internal),
+	FUNCTION	3	gin_path3D_extract_query (Path3D, internal, int2, internal, internal, internal, internal),
+	FUNCTION	4	gin_path3D_consistent (internal, int2, Path3D, int4, internal, internal, internal, internal),
+	STORAGE		int8;
+
+/* Parameters of the operator classes from PostgreSQL 13 */
+DO $$
+BEGIN
+	IF current_setting('server_version_num')::int >= 130000 THEN
+		ALTER OPERATOR FAMILY gin_box3D_ops USING gin ADD FUNCTION 7 (Box3D) gin_geo3D_options(internal);
+		ALTER OPERATOR FAMILY gin_poly3D_ops USING gin ADD FUNCTION 7 (Polygon3D) gin_geo3D_options(internal);
+		ALTER OPERATOR FAMILY gin_path3D_ops USING gin ADD FUNCTION 7 (Path3D) gin_geo3D_options(internal);
+	END IF;
+END;
+$$;
 		   
 /******************************************************************************/
 
@@ -0,0 +1,1500 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_float_types.sql
+ *	  Single-precision types for 3D geometries
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------*/
+
+DROP TYPE IF EXISTS Point3DF CASCADE;
+DROP TYPE IF EXISTS Box3DF CASCADE;
+DROP TYPE IF EXISTS Path3DF CASCADE;
+CREATE TYPE Point3DF;
+CREATE TYPE Box3DF;
+CREATE TYPE Path3DF;
+ 
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION point3DF_in(cstring) RETURNS Point3DF AS 'MODULE_PATHNAME', 'point3DF_in' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3DF_out(Point3DF) RETURNS cstring AS 'MODULE_PATHNAME', 'point3DF_out' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3DF_recv(internal) RETURNS Point3DF AS 'MODULE_PATHNAME', 'point3DF_recv' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3DF_send(Point3DF) RETURNS bytea AS 'MODULE_PATHNAME', 'point3DF_send' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE TYPE Point3DF (
+   internallength = 12,
+   input = point3DF_in,
+   output = point3DF_out,
+   receive = point3DF_recv,
+   send = point3DF_send,
+   alignment = int4,
+   element = float4
+);
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION box3DF_in(cstring) RETURNS Box3DF AS 'MODULE_PATHNAME', 'box3DF_in' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION box3DF_out(Box3DF) RETURNS cstring AS 'MODULE_PATHNAME', 'box3DF_out' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION box3DF_recv(internal) RETURNS Box3DF AS 'MODULE_PATHNAME', 'box3DF_recv' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION box3DF_send(Box3DF) RETURNS bytea AS 'MODULE_PATHNAME', 'box3DF_send' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE TYPE Box3DF (
+   internallength = 24,
+   input = box3DF_in,
+   output = box3DF_out,
+   receive = box3DF_recv,
+   send = box3DF_send,
+   alignment = int4,
+   element = Point3DF
+);
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION path3DF_in(cstring) RETURNS Path3DF AS 'MODULE_PATHNAME', 'path3DF_in' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION path3DF_out(Path3DF) RETURNS cstring AS 'MODULE_PATHNAME', 'path3DF_out' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION path3DF_recv(internal) RETURNS Path3DF AS 'MODULE_PATHNAME', 'path3DF_recv' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION path3DF_send(Path3DF) RETURNS bytea AS 'MODULE_PATHNAME', 'path3DF_send' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE TYPE Path3DF (
+   internallength = variable,
+   input = path3DF_in,
+   output = path3DF_out,
+   receive = path3DF_recv,
+   send = path3DF_send,
+   alignment = int4,
+   storage = extended
+);
+
+/******************************************************************************
+ * Point3DF functions
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION point3DF(x float4, y float4, z float4) RETURNS Point3DF AS 'MODULE_PATHNAME', 'point3DF_construct' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION point3DF_x(point Point3DF) RETURNS float4 AS 'MODULE_PATHNAME', 'point3DF_x' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3DF_y(point Point3DF) RETURNS float4 AS 'MODULE_PATHNAME', 'point3DF_y' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3DF_z(point Point3DF) RETURNS float4 AS 'MODULE_PATHNAME', 'point3DF_z' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION point3D(point Point3DF) RETURNS Point3D AS 'MODULE_PATHNAME', 'point3DF_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3DF(point Point3D) RETURNS Point3DF AS 'MODULE_PATHNAME', 'point3D_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE CAST (Point3DF AS Point3D) WITH FUNCTION point3D(Point3DF) AS IMPLICIT;
+CREATE CAST (Point3D AS Point3DF) WITH FUNCTION point3DF(Point3D) AS ASSIGNMENT;
+
+CREATE OR REPLACE FUNCTION point3DF_same(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'point3DF_same' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR ~= (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = point3DF_same,
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+------------------------------------------------------------------------------
+--	Operator class for defining b-tree index
+------------------------------------------------------------------------------
+
+CREATE OR REPLACE FUNCTION point3DF_cmp(point1 Point3DF, point2 Point3DF) RETURNS int4 AS 'MODULE_PATHNAME', 'point3DF_cmp' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION point3DF_lt(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'point3DF_lt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR < (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = point3DF_lt,
+	COMMUTATOR = '>', NEGATOR = '>=',
+	RESTRICT = scalarltsel, JOIN = scalarltjoinsel
+);
+
+CREATE OR REPLACE FUNCTION point3DF_le(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'point3DF_le' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <= (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = point3DF_le,
+	COMMUTATOR = '>=', NEGATOR = '>',
+	RESTRICT = scalarltsel, JOIN = scalarltjoinsel
+);
+
+CREATE OR REPLACE FUNCTION point3DF_eq(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'point3DF_eq' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR = (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = point3DF_eq,
+	COMMUTATOR = '=', NEGATOR = '<>',
+	RESTRICT = eqsel, JOIN = eqjoinsel,
+	MERGES
+);
+
+CREATE OR REPLACE FUNCTION point3DF_ne(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'point3DF_ne' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = point3DF_ne,
+	COMMUTATOR = '<>', NEGATOR = '=',
+	RESTRICT = neqsel, JOIN = neqjoinsel
+);
+
+CREATE OR REPLACE FUNCTION point3DF_gt(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'point3DF_gt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR > (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = point3DF_gt,
+	COMMUTATOR = '<', NEGATOR = '<=',
+	RESTRICT = scalargtsel, JOIN = scalargtjoinsel
+);
+
+CREATE OR REPLACE FUNCTION point3DF_ge(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'point3DF_ge' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >= (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = point3DF_ge,
+	COMMUTATOR = '<=', NEGATOR = '<',
+	RESTRICT = scalargtsel, JOIN = scalargtjoinsel
+);
+
+CREATE OPERATOR CLASS Point3DF_ops
+    DEFAULT FOR TYPE Point3DF USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       point3DF_cmp(Point3DF, Point3DF);
+
+/******************************************************************************
+ * Box3DF functions
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION box3DF(pt1 Point3DF, pt2 Point3DF) RETURNS Box3DF AS 'MODULE_PATHNAME', 'box3DF_construct_pts' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION high(box Box3DF) RETURNS Point3DF AS 'MODULE_PATHNAME', 'box3DF_high' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION low(box Box3DF) RETURNS Point3DF AS 'MODULE_PATHNAME', 'box3DF_low' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION box3D(box Box3DF) RETURNS Box3D AS 'MODULE_PATHNAME', 'box3DF_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION box3DF(box Box3D) RETURNS Box3DF AS 'MODULE_PATHNAME', 'box3D_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE CAST (Box3DF AS Box3D) WITH FUNCTION box3D(Box3DF) AS IMPLICIT;
+CREATE CAST (Box3D AS Box3DF) WITH FUNCTION box3DF(Box3D) AS ASSIGNMENT;
+
+CREATE OR REPLACE FUNCTION box3DF_same(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'box3DF_same' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR ~= (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = box3DF_same,
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+------------------------------------------------------------------------------
+--	Operator class for defining b-tree index
+------------------------------------------------------------------------------
+
+CREATE OR REPLACE FUNCTION box3DF_cmp(box1 Box3DF, box2 Box3DF) RETURNS int4 AS 'MODULE_PATHNAME', 'box3DF_cmp' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION box3DF_lt(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'box3DF_lt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR < (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = box3DF_lt,
+	COMMUTATOR = '>', NEGATOR = '>=',
+	RESTRICT = scalarltsel, JOIN = scalarltjoinsel
+);
+
+CREATE OR REPLACE FUNCTION box3DF_le(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'box3DF_le' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <= (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = box3DF_le,
+	COMMUTATOR = '>=', NEGATOR = '>',
+	RESTRICT = scalarltsel, JOIN = scalarltjoinsel
+);
+
+CREATE OR REPLACE FUNCTION box3DF_eq(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'box3DF_eq' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR = (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = box3DF_eq,
+	COMMUTATOR = '=', NEGATOR = '<>',
+	RESTRICT = eqsel, JOIN = eqjoinsel,
+	MERGES
+);
+
+CREATE OR REPLACE FUNCTION box3DF_ne(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'box3DF_ne' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = box3DF_ne,
+	COMMUTATOR = '<>', NEGATOR = '=',
+	RESTRICT = neqsel, JOIN = neqjoinsel
+);
+
+CREATE OR REPLACE FUNCTION box3DF_gt(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'box3DF_gt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR > (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = box3DF_gt,
+	COMMUTATOR = '<', NEGATOR = '<=',
+	RESTRICT = scalargtsel, JOIN = scalargtjoinsel
+);
+
+CREATE OR REPLACE FUNCTION box3DF_ge(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'box3DF_ge' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >= (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = box3DF_ge,
+	COMMUTATOR = '<=', NEGATOR = '<',
+	RESTRICT = scalargtsel, JOIN = scalargtjoinsel
+);
+
+CREATE OPERATOR CLASS Box3DF_ops
+    DEFAULT FOR TYPE Box3DF USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       box3DF_cmp(Box3DF, Box3DF);
+
+/******************************************************************************
+ * Path3DF functions
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION npoints(path Path3DF) RETURNS int4 AS 'MODULE_PATHNAME', 'path3DF_npoints' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR # (
+	RIGHTARG = Path3DF, PROCEDURE = npoints
+);
+CREATE OR REPLACE FUNCTION boundbox(path Path3DF) RETURNS Box3DF AS 'MODULE_PATHNAME', 'path3DF_boundbox' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION path3D(path Path3DF) RETURNS Path3D AS 'MODULE_PATHNAME', 'path3DF_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION path3DF(path Path3D) RETURNS Path3DF AS 'MODULE_PATHNAME', 'path3D_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE CAST (Path3DF AS Path3D) WITH FUNCTION path3D(Path3DF) AS IMPLICIT;
+CREATE CAST (Path3D AS Path3DF) WITH FUNCTION path3DF(Path3D) AS ASSIGNMENT;
+
+CREATE OR REPLACE FUNCTION path3DF_same(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'path3DF_same' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR ~= (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = path3DF_same,
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+------------------------------------------------------------------------------
+--	Operator class for defining b-tree index
+------------------------------------------------------------------------------
+
+CREATE OR REPLACE FUNCTION path3DF_cmp(path1 Path3DF, path2 Path3DF) RETURNS int4 AS 'MODULE_PATHNAME', 'path3DF_cmp' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION path3DF_lt(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'path3DF_lt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR < (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = path3DF_lt,
+	COMMUTATOR = '>', NEGATOR = '>=',
+	RESTRICT = scalarltsel, JOIN = scalarltjoinsel
+);
+
+CREATE OR REPLACE FUNCTION path3DF_le(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'path3DF_le' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <= (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = path3DF_le,
+	COMMUTATOR = '>=', NEGATOR = '>',
+	RESTRICT = scalarltsel, JOIN = scalarltjoinsel
+);
+
+CREATE OR REPLACE FUNCTION path3DF_eq(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'path3DF_eq' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR = (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = path3DF_eq,
+	COMMUTATOR = '=', NEGATOR = '<>',
+	RESTRICT = eqsel, JOIN = eqjoinsel,
+	MERGES
+);
+
+CREATE OR REPLACE FUNCTION path3DF_ne(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'path3DF_ne' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = path3DF_ne,
+	COMMUTATOR = '<>', NEGATOR = '=',
+	RESTRICT = neqsel, JOIN = neqjoinsel
+);
+
+CREATE OR REPLACE FUNCTION path3DF_gt(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'path3DF_gt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR > (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = path3DF_gt,
+	COMMUTATOR = '<', NEGATOR = '<=',
+	RESTRICT = scalargtsel, JOIN = scalargtjoinsel
+);
+
+CREATE OR REPLACE FUNCTION path3DF_ge(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'path3DF_ge' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >= (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = path3DF_ge,
+	COMMUTATOR = '<=', NEGATOR = '<',
+	RESTRICT = scalargtsel, JOIN = scalargtjoinsel
+);
+
+CREATE OPERATOR CLASS Path3DF_ops
+    DEFAULT FOR TYPE Path3DF USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       path3DF_cmp(Path3DF, Path3DF);
+
+/******************************************************************************
+ * Topological operators
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION contained_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <@ (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = contained_point3DF_box3DF,
+	COMMUTATOR = '@>',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contained_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <@ (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = contained_point3DF_path3DF,
+	COMMUTATOR = '@>',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contained_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <@ (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = contained_box3DF_box3DF,
+	COMMUTATOR = '@>',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contained_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <@ (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = contained_path3DF_box3DF,
+	COMMUTATOR = '@>',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contained_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <@ (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = contained_path3DF_path3DF,
+	COMMUTATOR = '@>',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contain_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR @> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = contain_box3DF_point3DF,
+	COMMUTATOR = '<@',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contain_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR @> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = contain_box3DF_box3DF,
+	COMMUTATOR = '<@',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contain_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR @> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = contain_box3DF_path3DF,
+	COMMUTATOR = '<@',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contain_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR @> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = contain_path3DF_point3DF,
+	COMMUTATOR = '<@',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION contain_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'contain_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR @> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = contain_path3DF_path3DF,
+	COMMUTATOR = '<@',
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overlap_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR && (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = overlap_box3DF_box3DF,
+	COMMUTATOR = '&&',
+	RESTRICT = areasel, JOIN = areajoinsel
+);
+
+CREATE OR REPLACE FUNCTION distance_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = distance_point3DF_point3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = distance_point3DF_box3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = distance_point3DF_path3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = distance_box3DF_point3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = distance_box3DF_box3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = distance_box3DF_path3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = distance_path3DF_point3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = distance_path3DF_box3DF,
+	COMMUTATOR = '<->'
+);
+CREATE OR REPLACE FUNCTION distance_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS float AS 'MODULE_PATHNAME', 'distance_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = distance_path3DF_path3DF,
+	COMMUTATOR = '<->'
+);
+
+/******************************************************************************
+ * Relative position operators
+ *****************************************************************************/
+
+/* point3DF op point3DF */
+
+CREATE OR REPLACE FUNCTION left_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = left_point3DF_point3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = overleft_point3DF_point3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = right_point3DF_point3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = overright_point3DF_point3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = below_point3DF_point3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = overbelow_point3DF_point3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = above_point3DF_point3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = overabove_point3DF_point3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = front_point3DF_point3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = overfront_point3DF_point3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = back_point3DF_point3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_point3DF_point3DF(point1 Point3DF, point2 Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_point3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Point3DF, RIGHTARG = Point3DF, PROCEDURE = overback_point3DF_point3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* point3DF op box3DF */
+
+CREATE OR REPLACE FUNCTION left_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = left_point3DF_box3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = overleft_point3DF_box3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = right_point3DF_box3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = overright_point3DF_box3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = below_point3DF_box3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = overbelow_point3DF_box3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = above_point3DF_box3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = overabove_point3DF_box3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = front_point3DF_box3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = overfront_point3DF_box3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = back_point3DF_box3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_point3DF_box3DF(point Point3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_point3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Point3DF, RIGHTARG = Box3DF, PROCEDURE = overback_point3DF_box3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* point3DF op path3DF */
+
+CREATE OR REPLACE FUNCTION left_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = left_point3DF_path3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = overleft_point3DF_path3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = right_point3DF_path3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = overright_point3DF_path3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = below_point3DF_path3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = overbelow_point3DF_path3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = above_point3DF_path3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = overabove_point3DF_path3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = front_point3DF_path3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = overfront_point3DF_path3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = back_point3DF_path3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_point3DF_path3DF(point Point3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_point3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Point3DF, RIGHTARG = Path3DF, PROCEDURE = overback_point3DF_path3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* box3DF op point3DF */
+
+CREATE OR REPLACE FUNCTION left_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = left_box3DF_point3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = overleft_box3DF_point3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = right_box3DF_point3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = overright_box3DF_point3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = below_box3DF_point3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = overbelow_box3DF_point3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = above_box3DF_point3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = overabove_box3DF_point3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = front_box3DF_point3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = overfront_box3DF_point3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = back_box3DF_point3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_box3DF_point3DF(box Box3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_box3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Box3DF, RIGHTARG = Point3DF, PROCEDURE = overback_box3DF_point3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* box3DF op box3DF */
+
+CREATE OR REPLACE FUNCTION left_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = left_box3DF_box3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = overleft_box3DF_box3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = right_box3DF_box3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = overright_box3DF_box3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = below_box3DF_box3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = overbelow_box3DF_box3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = above_box3DF_box3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = overabove_box3DF_box3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = front_box3DF_box3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = overfront_box3DF_box3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = back_box3DF_box3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_box3DF_box3DF(box1 Box3DF, box2 Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_box3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Box3DF, RIGHTARG = Box3DF, PROCEDURE = overback_box3DF_box3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* box3DF op path3DF */
+
+CREATE OR REPLACE FUNCTION left_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = left_box3DF_path3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = overleft_box3DF_path3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = right_box3DF_path3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = overright_box3DF_path3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = below_box3DF_path3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = overbelow_box3DF_path3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = above_box3DF_path3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = overabove_box3DF_path3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = front_box3DF_path3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = overfront_box3DF_path3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = back_box3DF_path3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_box3DF_path3DF(box Box3DF, path Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_box3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Box3DF, RIGHTARG = Path3DF, PROCEDURE = overback_box3DF_path3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* path3DF op point3DF */
+
+CREATE OR REPLACE FUNCTION left_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = left_path3DF_point3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = overleft_path3DF_point3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = right_path3DF_point3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = overright_path3DF_point3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = below_path3DF_point3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = overbelow_path3DF_point3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = above_path3DF_point3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = overabove_path3DF_point3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = front_path3DF_point3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = overfront_path3DF_point3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = back_path3DF_point3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_path3DF_point3DF(path Path3DF, point Point3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_path3DF_point3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Path3DF, RIGHTARG = Point3DF, PROCEDURE = overback_path3DF_point3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* path3DF op box3DF */
+
+CREATE OR REPLACE FUNCTION left_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = left_path3DF_box3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = overleft_path3DF_box3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = right_path3DF_box3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = overright_path3DF_box3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = below_path3DF_box3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = overbelow_path3DF_box3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = above_path3DF_box3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = overabove_path3DF_box3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = front_path3DF_box3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = overfront_path3DF_box3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = back_path3DF_box3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_path3DF_box3DF(path Path3DF, box Box3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_path3DF_box3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Path3DF, RIGHTARG = Box3DF, PROCEDURE = overback_path3DF_box3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/* path3DF op path3DF */
+
+CREATE OR REPLACE FUNCTION left_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'left_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR << (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = left_path3DF_path3DF,
+	COMMUTATOR = '>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overleft_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overleft_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<& (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = overleft_path3DF_path3DF,
+	COMMUTATOR = '&>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION right_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'right_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR >> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = right_path3DF_path3DF,
+	COMMUTATOR = '<<',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overright_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overright_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &>> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = overright_path3DF_path3DF,
+	COMMUTATOR = '<<&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION below_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'below_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<| (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = below_path3DF_path3DF,
+	COMMUTATOR = '|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overbelow_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overbelow_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <<|& (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = overbelow_path3DF_path3DF,
+	COMMUTATOR = '&|>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION above_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'above_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR |>> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = above_path3DF_path3DF,
+	COMMUTATOR = '<<|',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overabove_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overabove_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &|>> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = overabove_path3DF_path3DF,
+	COMMUTATOR = '<<|&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION front_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'front_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</ (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = front_path3DF_path3DF,
+	COMMUTATOR = '/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overfront_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overfront_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <</& (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = overfront_path3DF_path3DF,
+	COMMUTATOR = '&/>>',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION back_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'back_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR />> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = back_path3DF_path3DF,
+	COMMUTATOR = '<</',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION overback_path3DF_path3DF(path1 Path3DF, path2 Path3DF) RETURNS boolean AS 'MODULE_PATHNAME', 'overback_path3DF_path3DF' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR &/>> (
+	LEFTARG = Path3DF, RIGHTARG = Path3DF, PROCEDURE = overback_path3DF_path3DF,
+	COMMUTATOR = '<</&',
+	RESTRICT = positionsel3D, JOIN = positionjoinsel3D
+);
+
+/******************************************************************************
+ * Support routines for the GiST access method
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION gist_point3DF_consistent(internal, Point3DF, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_point3DF_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_point3DF_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_point3DF_compress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_point3DF_distance(internal, Point3DF, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_point3DF_distance' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_point3DF_fetch(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_point3DF_fetch' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR CLASS gist_point3DF_ops
+    DEFAULT FOR TYPE Point3DF USING gist AS
+	-- strictly left
+	OPERATOR	1	<< (Point3DF, Point3DF),
+	OPERATOR	121	<< (Point3DF, Box3DF),
+	OPERATOR	161	<< (Point3DF, Path3DF),
+	-- overlaps or left
+	OPERATOR	2	<<& (Point3DF, Point3DF),
+	OPERATOR	122	<<& (Point3DF, Box3DF),
+	OPERATOR	162	<<& (Point3DF, Path3DF),
+	-- overlaps or right
+	OPERATOR	4	&>> (Point3DF, Point3DF),
+	OPERATOR	124	&>> (Point3DF, Box3DF),
+	OPERATOR	164	&>> (Point3DF, Path3DF),
+	-- strictly right
+	OPERATOR	5	>> (Point3DF, Point3DF),
+	OPERATOR	125	>> (Point3DF, Box3DF),
+	OPERATOR	165	>> (Point3DF, Path3DF),
+	-- same
+	OPERATOR	6	~= (Point3DF, Point3DF),
+	-- contained by
+	OPERATOR	128	<@ (Point3DF, Box3DF),
+	OPERATOR	168	<@ (Point3DF, Path3DF),
+	-- overlaps or below
+	OPERATOR	9	<<|& (Point3DF, Point3DF),
+	OPERATOR	129	<<|& (Point3DF, Box3DF),
+	OPERATOR	169	<<|& (Point3DF, Path3DF),
+	-- strictly below
+	OPERATOR	10	<<| (Point3DF, Point3DF),
+	OPERATOR	130	<<| (Point3DF, Box3DF),
+	OPERATOR	170	<<| (Point3DF, Path3DF),
+	-- strictly above
+	OPERATOR	11	|>> (Point3DF, Point3DF),
+	OPERATOR	131	|>> (Point3DF, Box3DF),
+	OPERATOR	171	|>> (Point3DF, Path3DF),
+	-- overlaps or above
+	OPERATOR	12	&|>> (Point3DF, Point3DF),
+	OPERATOR	132	&|>> (Point3DF, Box3DF),
+	OPERATOR	172	&|>> (Point3DF, Path3DF),
+	-- distance
+	OPERATOR	15	<-> (Point3DF, Point3DF) FOR ORDER BY pg_catalog.float_ops,
+	OPERATOR	135	<-> (Point3DF, Box3DF) FOR ORDER BY pg_catalog.float_ops,
+	OPERATOR	175	<-> (Point3DF, Path3DF) FOR ORDER BY pg_catalog.float_ops,
+	-- overlaps or front
+	OPERATOR	28	<</& (Point3DF, Point3DF),
+	OPERATOR	148	<</& (Point3DF, Box3DF),
+	OPERATOR	188	<</& (Point3DF, Path3DF),
+	-- strictly front
+	OPERATOR	29	<</ (Point3DF, Point3DF),
+	OPERATOR	149	<</ (Point3DF, Box3DF),
+	OPERATOR	189	<</ (Point3DF, Path3DF),
+	-- strictly back
+	OPERATOR	30	/>> (Point3DF, Point3DF),
+	OPERATOR	150	/>> (Point3DF, Box3DF),
+	OPERATOR	190	/>> (Point3DF, Path3DF),
+	-- overlaps or back
+	OPERATOR	31	&/>> (Point3DF, Point3DF),
+	OPERATOR	151	&/>> (Point3DF, Box3DF),
+	OPERATOR	191	&/>> (Point3DF, Path3DF),
+	-- functions
+	FUNCTION	1	gist_point3DF_consistent (internal, Point3DF, smallint, oid, internal),
+	FUNCTION	2	gist_box3D_union (internal, internal),
+	FUNCTION	3	gist_point3DF_compress (internal),
+	FUNCTION	4	gist_box3D_decompress (internal),
+	FUNCTION	5	gist_box3D_penalty (internal, internal, internal),
+	FUNCTION	6	gist_box3D_picksplit (internal, internal),
+	FUNCTION	7	gist_box3D_same (Box3D, Box3D, internal),
+	FUNCTION	8	gist_point3DF_distance (internal, Point3DF, smallint, oid, internal),
+	FUNCTION	9	gist_point3DF_fetch (internal),
+	STORAGE		Box3D;
+
+CREATE OR REPLACE FUNCTION gist_box3DF_consistent(internal, Box3DF, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_box3DF_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3DF_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3DF_compress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3DF_distance(internal, Box3DF, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_box3DF_distance' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_box3DF_fetch(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_box3DF_fetch' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR CLASS gist_box3DF_ops
+    DEFAULT FOR TYPE Box3DF USING gist AS
+	-- strictly left
+	OPERATOR	1	<< (Box3DF, Point3DF),
+	OPERATOR	121	<< (Box3DF, Box3DF),
+	OPERATOR	161	<< (Box3DF, Path3DF),
+	-- overlaps or left
+	OPERATOR	2	<<& (Box3DF, Point3DF),
+	OPERATOR	122	<<& (Box3DF, Box3DF),
+	OPERATOR	162	<<& (Box3DF, Path3DF),
+	-- overlaps
+	OPERATOR	123	&& (Box3DF, Box3DF),
+	-- overlaps or right
+	OPERATOR	4	&>> (Box3DF, Point3DF),
+	OPERATOR	124	&>> (Box3DF, Box3DF),
+	OPERATOR	164	&>> (Box3DF, Path3DF),
+	-- strictly right
+	OPERATOR	5	>> (Box3DF, Point3DF),
+	OPERATOR	125	>> (Box3DF, Box3DF),
+	OPERATOR	165	>> (Box3DF, Path3DF),
+	-- same
+	OPERATOR	126	~= (Box3DF, Box3DF),
+	-- contains
+	OPERATOR	7	@> (Box3DF, Point3DF),
+	OPERATOR	127	@> (Box3DF, Box3DF),
+	OPERATOR	167	@> (Box3DF, Path3DF),
+	-- contained by
+	OPERATOR	128	<@ (Box3DF, Box3DF),
+	-- overlaps or below
+	OPERATOR	9	<<|& (Box3DF, Point3DF),
+	OPERATOR	129	<<|& (Box3DF, Box3DF),
+	OPERATOR	169	<<|& (Box3DF, Path3DF),
+	-- strictly below
+	OPERATOR	10	<<| (Box3DF, Point3DF),
+	OPERATOR	130	<<| (Box3DF, Box3DF),
+	OPERATOR	170	<<| (Box3DF, Path3DF),
+	-- strictly above
+	OPERATOR	11	|>> (Box3DF, Point3DF),
+	OPERATOR	131	|>> (Box3DF, Box3DF),
+	OPERATOR	171	|>> (Box3DF, Path3DF),
+	-- overlaps or above
+	OPERATOR	12	&|>> (Box3DF, Point3DF),
+	OPERATOR	132	&|>> (Box3DF, Box3DF),
+	OPERATOR	172	&|>> (Box3DF, Path3DF),
+	-- distance
+	OPERATOR	15	<-> (Box3DF, Point3DF) FOR ORDER BY pg_catalog.float_ops,
+	OPERATOR	135	<-> (Box3DF, Box3DF) FOR ORDER BY pg_catalog.float_ops,
+	OPERATOR	175	<-> (Box3DF, Path3DF) FOR ORDER BY pg_catalog.float_ops,
+	-- overlaps or front
+	OPERATOR	28	<</& (Box3DF, Point3DF),
+	OPERATOR	148	<</& (Box3DF, Box3DF),
+	OPERATOR	188	<</& (Box3DF, Path3DF),
+	-- strictly front
+	OPERATOR	29	<</ (Box3DF, Point3DF),
+	OPERATOR	149	<</ (Box3DF, Box3DF),
+	OPERATOR	189	<</ (Box3DF, Path3DF),
+	-- strictly back
+	OPERATOR	30	/>> (Box3DF, Point3DF),
+	OPERATOR	150	/>> (Box3DF, Box3DF),
+	OPERATOR	190	/>> (Box3DF, Path3DF),
+	-- overlaps or back
+	OPERATOR	31	&/>> (Box3DF, Point3DF),
+	OPERATOR	151	&/>> (Box3DF, Box3DF),
+	OPERATOR	191	&/>> (Box3DF, Path3DF),
+	-- functions
+	FUNCTION	1	gist_box3DF_consistent (internal, Box3DF, smallint, oid, internal),
+	FUNCTION	2	gist_box3D_union (internal, internal),
+	FUNCTION	3	gist_box3DF_compress (internal),
+	FUNCTION	4	gist_box3D_decompress (internal),
+	FUNCTION	5	gist_box3D_penalty (internal, internal, internal),
+	FUNCTION	6	gist_box3D_picksplit (internal, internal),
+	FUNCTION	7	gist_box3D_same (Box3D, Box3D, internal),
+	FUNCTION	8	gist_box3DF_distance (internal, Box3DF, smallint, oid, internal),
+	FUNCTION	9	gist_box3DF_fetch (internal),
+	STORAGE		Box3D;
+
+CREATE OR REPLACE FUNCTION gist_path3DF_consistent(internal, Path3DF, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_path3DF_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_path3DF_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_path3DF_compress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_path3DF_distance(internal, Path3DF, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_path3DF_distance' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR CLASS gist_path3DF_ops
+    DEFAULT FOR TYPE Path3DF USING gist AS
+	-- strictly left
+	OPERATOR	1	<< (Path3DF, Point3DF),
+	OPERATOR	121	<< (Path3DF, Box3DF),
+	OPERATOR	161	<< (Path3DF, Path3DF),
+	-- overlaps or left
+	OPERATOR	2	<<& (Path3DF, Point3DF),
+	OPERATOR	122	<<& (Path3DF, Box3DF),
+	OPERATOR	162	<<& (Path3DF, Path3DF),
+	-- overlaps or right
+	OPERATOR	4	&>> (Path3DF, Point3DF),
+	OPERATOR	124	&>> (Path3DF, Box3DF),
+	OPERATOR	164	&>> (Path3DF, Path3DF),
+	-- strictly right
+	OPERATOR	5	>> (Path3DF, Point3DF),
+	OPERATOR	125	>> (Path3DF, Box3DF),
+	OPERATOR	165	>> (Path3DF, Path3DF),
+	-- same
+	OPERATOR	166	~= (Path3DF, Path3DF),
+	-- contains
+	OPERATOR	7	@> (Path3DF, Point3DF),
+	OPERATOR	167	@> (Path3DF, Path3DF),
+	-- contained by
+	OPERATOR	128	<@ (Path3DF, Box3DF),
+	OPERATOR	168	<@ (Path3DF, Path3DF),
+	-- overlaps or below
+	OPERATOR	9	<<|& (Path3DF, Point3DF),
+	OPERATOR	129	<<|& (Path3DF, Box3DF),
+	OPERATOR	169	<<|& (Path3DF, Path3DF),
+	-- strictly below
+	OPERATOR	10	<<| (Path3DF, Point3DF),
+	OPERATOR	130	<<| (Path3DF, Box3DF),
+	OPERATOR	170	<<| (Path3DF, Path3DF),
+	-- strictly above
+	OPERATOR	11	|>> (Path3DF, Point3DF),
+	OPERATOR	131	|>> (Path3DF, Box3DF),
+	OPERATOR	171	|>> (Path3DF, Path3DF),
+	-- overlaps or above
+	OPERATOR	12	&|>> (Path3DF, Point3DF),
+	OPERATOR	132	&|>> (Path3DF, Box3DF),
+	OPERATOR	172	&|>> (Path3DF, Path3DF),
+	-- distance
+	OPERATOR	15	<-> (Path3DF, Point3DF) FOR ORDER BY pg_catalog.float_ops,
+	OPERATOR	135	<-> (Path3DF, Box3DF) FOR ORDER BY pg_catalog.float_ops,
+	OPERATOR	175	<-> (Path3DF, Path3DF) FOR ORDER BY pg_catalog.float_ops,
+	-- overlaps or front
+	OPERATOR	28	<</& (Path3DF, Point3DF),
+	OPERATOR	148	<</& (Path3DF, Box3DF),
+	OPERATOR	188	<</& (Path3DF, Path3DF),
+	-- strictly front
+	OPERATOR	29	<</ (Path3DF, Point3DF),
+	OPERATOR	149	<</ (Path3DF, Box3DF),
+	OPERATOR	189	<</ (Path3DF, Path3DF),
+	-- strictly back
+	OPERATOR	30	/>> (Path3DF, Point3DF),
+	OPERATOR	150	/>> (Path3DF, Box3DF),
+	OPERATOR	190	/>> (Path3DF, Path3DF),
+	-- overlaps or back
+	OPERATOR	31	&/>> (Path3DF, Point3DF),
+	OPERATOR	151	&/>> (Path3DF, Box3DF),
+	OPERATOR	191	&/>> (Path3DF, Path3DF),
+	-- functions
+	FUNCTION	1	gist_path3DF_consistent (internal, Path3DF, smallint, oid, internal),
+	FUNCTION	2	gist_box3D_union (internal, internal),
+	FUNCTION	3	gist_path3DF_compress (internal),
+	FUNCTION	4	gist_box3D_decompress (internal),
+	FUNCTION	5	gist_box3D_penalty (internal, internal, internal),
+	FUNCTION	6	gist_box3D_picksplit (internal, internal),
+	FUNCTION	7	gist_box3D_same (Box3D, Box3D, internal),
+	FUNCTION	8	gist_path3DF_distance (internal, Path3DF, smallint, oid, internal),
+	STORAGE		Box3D;
+
+/******************************************************************************
+ * Support routines for the SP-GiST octree access method
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION spgist_octreeF_choose(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octreeF_choose' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION spgist_octreeF_picksplit(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octreeF_picksplit' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION spgist_octreeF_inner_consistent(internal, internal) RETURNS void AS 'MODULE_PATHNAME', 'spgist_octreeF_inner_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION spgist_octreeF_leaf_consistent(internal, internal) RETURNS boolean AS 'MODULE_PATHNAME', 'spgist_octreeF_leaf_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR CLASS spgist_octreeF_ops
+	FOR TYPE Point3DF
+	USING SPGiST AS
+	-- strictly left
+	OPERATOR	1	<< (Point3DF, Point3DF),
+	OPERATOR	121	<< (Point3DF, Box3DF),
+	OPERATOR	161	<< (Point3DF, Path3DF),
+	-- strictly right
+	OPERATOR	5	>> (Point3DF, Point3DF),
+	OPERATOR	125	>> (Point3DF, Box3DF),
+	OPERATOR	165	>> (Point3DF, Path3DF),
+	-- same
+	OPERATOR	6	~= (Point3DF, Point3DF),
+	-- contained by
+	OPERATOR	128	<@ (Point3DF, Box3DF),
+	OPERATOR	168	<@ (Point3DF, Path3DF),
+	-- strictly below
+	OPERATOR	10	<<| (Point3DF, Point3DF),
+	OPERATOR	130	<<| (Point3DF, Box3DF),
+	OPERATOR	170	<<| (Point3DF, Path3DF),
+	-- strictly above
+	OPERATOR	11	|>> (Point3DF, Point3DF),
+	OPERATOR	131	|>> (Point3DF, Box3DF),
+	OPERATOR	171	|>> (Point3DF, Path3DF),
+	-- strictly front
+	OPERATOR	29	<</ (Point3DF, Point3DF),
+	OPERATOR	149	<</ (Point3DF, Box3DF),
+	OPERATOR	189	<</ (Point3DF, Path3DF),
+	-- strictly back
+	OPERATOR	30	/>> (Point3DF, Point3DF),
+	OPERATOR	150	/>> (Point3DF, Box3DF),
+	OPERATOR	190	/>> (Point3DF, Path3DF),
+	-- functions
+	FUNCTION	1	spgist_octree_config(internal, internal),
+	FUNCTION	2	spgist_octreeF_choose(internal, internal),
+	FUNCTION	3	spgist_octreeF_picksplit(internal, internal),
+	FUNCTION	4	spgist_octreeF_inner_consistent(internal, internal),
+	FUNCTION	5	spgist_octreeF_leaf_consistent(internal, internal);
+
+/******************************************************************************/
@@ -0,0 +1,122 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_pointpatch.sql
+ *	  Patches of 3D points
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------*/
+
+DROP TYPE IF EXISTS PointPatch3D CASCADE;
+CREATE TYPE PointPatch3D;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION pointpatch3D_in(cstring) RETURNS PointPatch3D AS 'MODULE_PATHNAME', 'pointpatch3D_in' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION pointpatch3D_out(PointPatch3D) RETURNS cstring AS 'MODULE_PATHNAME', 'pointpatch3D_out' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION pointpatch3D_recv(internal) RETURNS PointPatch3D AS 'MODULE_PATHNAME', 'pointpatch3D_recv' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION pointpatch3D_send(PointPatch3D) RETURNS bytea AS 'MODULE_PATHNAME', 'pointpatch3D_send' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE TYPE PointPatch3D (
+   internallength = variable,
+   input = pointpatch3D_in,
+   output = pointpatch3D_out,
+   receive = pointpatch3D_recv,
+   send = pointpatch3D_send,
+   alignment = double,
+   storage = extended
+);
+
+/******************************************************************************
+ * Constructors and accessors
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION pointpatch3D(points Point3D[]) RETURNS PointPatch3D AS 'MODULE_PATHNAME', 'pointpatch3D_construct' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION quantize(patch PointPatch3D, scale float8) RETURNS PointPatch3D AS 'MODULE_PATHNAME', 'pointpatch3D_quantize' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION npoints(patch PointPatch3D) RETURNS int4 AS 'MODULE_PATHNAME', 'pointpatch3D_npoints' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION boundbox(patch PointPatch3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'pointpatch3D_boundbox' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION scale(patch PointPatch3D) RETURNS float8 AS 'MODULE_PATHNAME', 'pointpatch3D_scale' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION pointpatch3D_points(patch PointPatch3D) RETURNS Point3D[] AS 'MODULE_PATHNAME', 'pointpatch3D_points' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION pointpatch3D_explode(patch PointPatch3D) RETURNS SETOF Point3D AS 'MODULE_PATHNAME', 'pointpatch3D_explode' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION pointpatch3D_filter(patch PointPatch3D, box Box3D) RETURNS SETOF Point3D AS 'MODULE_PATHNAME', 'pointpatch3D_filter' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION pointpatch3D_rows_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'pointpatch3D_rows_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/* Estimate the number of points returned from PostgreSQL 12 */
+DO $$
+BEGIN
+	IF current_setting('server_version_num')::int >= 120000 THEN
+		ALTER FUNCTION pointpatch3D_explode(PointPatch3D) SUPPORT pointpatch3D_rows_support;
+		ALTER FUNCTION pointpatch3D_filter(PointPatch3D, Box3D) SUPPORT pointpatch3D_rows_support;
+	END IF;
+END;
+$$;
+
+/******************************************************************************
+ * Operators
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION overlap_pointpatch3D_box3D(patch PointPatch3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'overlap_pointpatch3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR && (
+	LEFTARG = PointPatch3D, RIGHTARG = Box3D, PROCEDURE = overlap_pointpatch3D_box3D,
+	RESTRICT = areasel, JOIN = areajoinsel
+);
+
+CREATE OR REPLACE FUNCTION contained_pointpatch3D_box3D(patch PointPatch3D, box Box3D) RETURNS boolean AS 'MODULE_PATHNAME', 'contained_pointpatch3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <@ (
+	LEFTARG = PointPatch3D, RIGHTARG = Box3D, PROCEDURE = contained_pointpatch3D_box3D,
+	RESTRICT = contsel3D, JOIN = contjoinsel3D
+);
+
+CREATE OR REPLACE FUNCTION distance_pointpatch3D_point3D(patch PointPatch3D, point Point3D) RETURNS float8 AS 'MODULE_PATHNAME', 'distance_pointpatch3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OPERATOR <-> (
+	LEFTARG = PointPatch3D, RIGHTARG = Point3D, PROCEDURE = distance_pointpatch3D_point3D
+);
+
+/******************************************************************************
+ * Aggregate packing points into patches of at most maxpts points ordered on
+ * their Morton code
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION pointpatch3D_pack_transfn(internal, Point3D, int4) RETURNS internal AS 'MODULE_PATHNAME', 'pointpatch3D_pack_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION pointpatch3D_pack_finalfn(internal) RETURNS PointPatch3D[] AS 'MODULE_PATHNAME', 'pointpatch3D_pack_finalfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE AGGREGATE pointpatch3D_pack(point Point3D, maxpts int4) (
+	SFUNC = pointpatch3D_pack_transfn,
+	STYPE = internal,
+	FINALFUNC = pointpatch3D_pack_finalfn,
+	PARALLEL = SAFE
+);
+
+/******************************************************************************
+ * Support routines for the GiST access method
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION gist_pointpatch3D_consistent(internal, PointPatch3D, smallint, oid, internal) RETURNS bool AS 'MODULE_PATHNAME', 'gist_type3D_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_pointpatch3D_compress(internal) RETURNS internal AS 'MODULE_PATHNAME', 'gist_pointpatch3D_compress' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION gist_pointpatch3D_distance(internal, PointPatch3D, smallint, oid, internal) RETURNS float8 AS 'MODULE_PATHNAME', 'gist_poly3D_distance' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR CLASS gist_pointpatch3D_ops
+    DEFAULT FOR TYPE PointPatch3D USING gist AS
+	-- overlaps
+	OPERATOR	123	&& (PointPatch3D, Box3D),
+	-- contained by
+	OPERATOR	128	<@ (PointPatch3D, Box3D),
+	-- distance
+	OPERATOR	15	<-> (PointPatch3D, Point3D) FOR ORDER BY pg_catalog.float_ops,
+	-- functions
+	FUNCTION	1	gist_pointpatch3D_consistent (internal, PointPatch3D, smallint, oid, internal),
+	FUNCTION	2	gist_box3D_union (internal, internal),
+	FUNCTION	3	gist_pointpatch3D_compress (internal),
+	FUNCTION	4	gist_box3D_decompress (internal),
+	FUNCTION	5	gist_box3D_penalty (internal, internal, internal),
+	FUNCTION	6	gist_box3D_picksplit (internal, internal),
+	FUNCTION	7	gist_box3D_same (Box3D, Box3D, internal),
+	FUNCTION	8	gist_pointpatch3D_distance (internal, PointPatch3D, smallint, oid, internal),
+	STORAGE		Box3D;
+
+/******************************************************************************/
@@ -0,0 +1,52 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_wkb.sql
+ *	  Well-Known Binary input and output for 3D geometries
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------*/
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(point Point3D) RETURNS bytea AS 'MODULE_PATHNAME', 'point3D_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3D_fromwkb(wkb bytea) RETURNS Point3D AS 'MODULE_PATHNAME', 'point3D_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (Point3D AS bytea) WITH FUNCTION geo3d_asbinary(Point3D);
+CREATE CAST (bytea AS Point3D) WITH FUNCTION point3D_fromwkb(bytea);
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(lseg Lseg3D) RETURNS bytea AS 'MODULE_PATHNAME', 'lseg3D_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION lseg3D_fromwkb(wkb bytea) RETURNS Lseg3D AS 'MODULE_PATHNAME', 'lseg3D_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (Lseg3D AS bytea) WITH FUNCTION geo3d_asbinary(Lseg3D);
+CREATE CAST (bytea AS Lseg3D) WITH FUNCTION lseg3D_fromwkb(bytea);
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(line Line3D) RETURNS bytea AS 'MODULE_PATHNAME', 'line3D_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION line3D_fromwkb(wkb bytea) RETURNS Line3D AS 'MODULE_PATHNAME', 'line3D_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (Line3D AS bytea) WITH FUNCTION geo3d_asbinary(Line3D);
+CREATE CAST (bytea AS Line3D) WITH FUNCTION line3D_fromwkb(bytea);
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(box Box3D) RETURNS bytea AS 'MODULE_PATHNAME', 'box3D_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION box3D_fromwkb(wkb bytea) RETURNS Box3D AS 'MODULE_PATHNAME', 'box3D_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (Box3D AS bytea) WITH FUNCTION geo3d_asbinary(Box3D);
+CREATE CAST (bytea AS Box3D) WITH FUNCTION box3D_fromwkb(bytea);
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(path Path3D) RETURNS bytea AS 'MODULE_PATHNAME', 'path3D_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION path3D_fromwkb(wkb bytea) RETURNS Path3D AS 'MODULE_PATHNAME', 'path3D_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (Path3D AS bytea) WITH FUNCTION geo3d_asbinary(Path3D);
+CREATE CAST (bytea AS Path3D) WITH FUNCTION path3D_fromwkb(bytea);
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(poly Polygon3D) RETURNS bytea AS 'MODULE_PATHNAME', 'poly3D_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION polygon3D_fromwkb(wkb bytea) RETURNS Polygon3D AS 'MODULE_PATHNAME', 'poly3D_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (Polygon3D AS bytea) WITH FUNCTION geo3d_asbinary(Polygon3D);
+CREATE CAST (bytea AS Polygon3D) WITH FUNCTION polygon3D_fromwkb(bytea);
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(sphere Sphere) RETURNS bytea AS 'MODULE_PATHNAME', 'sphere_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION sphere_fromwkb(wkb bytea) RETURNS Sphere AS 'MODULE_PATHNAME', 'sphere_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (Sphere AS bytea) WITH FUNCTION geo3d_asbinary(Sphere);
+CREATE CAST (bytea AS Sphere) WITH FUNCTION sphere_fromwkb(bytea);
+
+CREATE OR REPLACE FUNCTION geo3d_asbinary(patch PointPatch3D) RETURNS bytea AS 'MODULE_PATHNAME', 'pointpatch3D_asbinary' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION pointpatch3D_fromwkb(wkb bytea) RETURNS PointPatch3D AS 'MODULE_PATHNAME', 'pointpatch3D_fromwkb' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE CAST (PointPatch3D AS bytea) WITH FUNCTION geo3d_asbinary(PointPatch3D);
+CREATE CAST (bytea AS PointPatch3D) WITH FUNCTION pointpatch3D_fromwkb(bytea);
+
+/******************************************************************************/
@@ -0,0 +1,144 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_aggregates.sql
+ *	  Aggregate functions for 3D geometries
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * Extent
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION extent3D_combinefn(Box3D, Box3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_combinefn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION extent3D_transfn(Box3D, Point3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_point3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE AGGREGATE extent3D(Point3D) (
+	SFUNC = extent3D_transfn,
+	STYPE = Box3D,
+	COMBINEFUNC = extent3D_combinefn,
+	PARALLEL = SAFE
+);
+
+CREATE OR REPLACE FUNCTION extent3D_transfn(Box3D, Lseg3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_lseg3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE AGGREGATE extent3D(Lseg3D) (
+	SFUNC = extent3D_transfn,
+	STYPE = Box3D,
+	COMBINEFUNC = extent3D_combinefn,
+	PARALLEL = SAFE
+);
+
+CREATE OR REPLACE FUNCTION extent3D_transfn(Box3D, Box3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_box3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE AGGREGATE extent3D(Box3D) (
+	SFUNC = extent3D_transfn,
+	STYPE = Box3D,
+	COMBINEFUNC = extent3D_combinefn,
+	PARALLEL = SAFE
+);
+
+CREATE OR REPLACE FUNCTION extent3D_transfn(Box3D, Path3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_path3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE AGGREGATE extent3D(Path3D) (
+	SFUNC = extent3D_transfn,
+	STYPE = Box3D,
+	COMBINEFUNC = extent3D_combinefn,
+	PARALLEL = SAFE
+);
+
+CREATE OR REPLACE FUNCTION extent3D_transfn(Box3D, Polygon3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_poly3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE AGGREGATE extent3D(Polygon3D) (
+	SFUNC = extent3D_transfn,
+	STYPE = Box3D,
+	COMBINEFUNC = extent3D_combinefn,
+	PARALLEL = SAFE
+);
+
+CREATE OR REPLACE FUNCTION extent3D_transfn(Box3D, Sphere) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_sphere_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE AGGREGATE extent3D(Sphere) (
+	SFUNC = extent3D_transfn,
+	STYPE = Box3D,
+	COMBINEFUNC = extent3D_combinefn,
+	PARALLEL = SAFE
+);
+
+CREATE OR REPLACE FUNCTION extent3D_transfn(Box3D, PointPatch3D) RETURNS Box3D AS 'MODULE_PATHNAME', 'extent3D_pointpatch3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE AGGREGATE extent3D(PointPatch3D) (
+	SFUNC = extent3D_transfn,
+	STYPE = Box3D,
+	COMBINEFUNC = extent3D_combinefn,
+	PARALLEL = SAFE
+);
+
+/******************************************************************************
+ * Moments of points
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION point3D_moments_transfn(float8[], Point3D) RETURNS float8[] AS 'MODULE_PATHNAME', 'point3D_moments_transfn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION point3D_moments_combinefn(float8[], float8[]) RETURNS float8[] AS 'MODULE_PATHNAME', 'point3D_moments_combinefn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION centroid3D_finalfn(float8[]) RETURNS Point3D AS 'MODULE_PATHNAME', 'centroid3D_finalfn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION covariance3D_finalfn(float8[]) RETURNS float8[] AS 'MODULE_PATHNAME', 'covariance3D_finalfn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION principal_axes3D_finalfn(float8[]) RETURNS Point3D[] AS 'MODULE_PATHNAME', 'principal_axes3D_finalfn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION principal_variances3D_finalfn(float8[]) RETURNS float8[] AS 'MODULE_PATHNAME', 'principal_variances3D_finalfn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE AGGREGATE centroid3D(Point3D) (
+	SFUNC = point3D_moments_transfn,
+	STYPE = float8[],
+	FINALFUNC = centroid3D_finalfn,
+	COMBINEFUNC = point3D_moments_combinefn,
+	INITCOND = '{0,0,0,0,0,0,0,0,0,0}',
+	PARALLEL = SAFE
+);
+
+CREATE AGGREGATE covariance3D(Point3D) (
+	SFUNC = point3D_moments_transfn,
+	STYPE = float8[],
+	FINALFUNC = covariance3D_finalfn,
+	COMBINEFUNC = point3D_moments_combinefn,
+	INITCOND = '{0,0,0,0,0,0,0,0,0,0}',
+	PARALLEL = SAFE
+);
+
+CREATE AGGREGATE principal_axes3D(Point3D) (
+	SFUNC = point3D_moments_transfn,
+	STYPE = float8[],
+	FINALFUNC = principal_axes3D_finalfn,
+	COMBINEFUNC = point3D_moments_combinefn,
+	INITCOND = '{0,0,0,0,0,0,0,0,0,0}',
+	PARALLEL = SAFE
+);
+
+CREATE AGGREGATE principal_variances3D(Point3D) (
+	SFUNC = point3D_moments_transfn,
+	STYPE = float8[],
+	FINALFUNC = principal_variances3D_finalfn,
+	COMBINEFUNC = point3D_moments_combinefn,
+	INITCOND = '{0,0,0,0,0,0,0,0,0,0}',
+	PARALLEL = SAFE
+);
+
+/******************************************************************************
+ * Collect points into paths and polygons
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION path3D_collect_transfn(internal, Point3D) RETURNS internal AS 'MODULE_PATHNAME', 'path3D_collect_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION path3D_collect_finalfn(internal) RETURNS Path3D AS 'MODULE_PATHNAME', 'path3D_collect_finalfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION poly3D_collect_transfn(internal, Point3D) RETURNS internal AS 'MODULE_PATHNAME', 'poly3D_collect_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION poly3D_collect_finalfn(internal) RETURNS Polygon3D AS 'MODULE_PATHNAME', 'poly3D_collect_finalfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE AGGREGATE path3D_collect(Point3D) (
+	SFUNC = path3D_collect_transfn,
+	STYPE = internal,
+	FINALFUNC = path3D_collect_finalfn,
+	PARALLEL = SAFE
+);
+
+CREATE AGGREGATE poly3D_collect(Point3D) (
+	SFUNC = poly3D_collect_transfn,
+	STYPE = internal,
+	FINALFUNC = poly3D_collect_finalfn,
+	PARALLEL = SAFE
+);
+
+/******************************************************************************/
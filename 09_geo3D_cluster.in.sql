@@ -0,0 +1,25 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_cluster.sql
+ *	  Clustering of 3D points
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * DBSCAN
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION dbscan3D(point Point3D, eps float8, minpts int4) RETURNS int4 AS 'MODULE_PATHNAME', 'dbscan3D' LANGUAGE C IMMUTABLE WINDOW PARALLEL SAFE;
+
+/******************************************************************************
+ * k-means
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION kmeans3D(point Point3D, k int4) RETURNS int4 AS 'MODULE_PATHNAME', 'kmeans3D' LANGUAGE C IMMUTABLE WINDOW PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION kmeans3D(point Point3D, k int4, seed int8) RETURNS int4 AS 'MODULE_PATHNAME', 'kmeans3D' LANGUAGE C IMMUTABLE WINDOW PARALLEL SAFE;
+
+/******************************************************************************/
@@ -0,0 +1,356 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_voxel.sql
+ *	  Sparse voxel sets
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------*/
+
+DROP TYPE IF EXISTS VoxelSet3D CASCADE;
+DROP TYPE IF EXISTS VoxelCell3D CASCADE;
+DROP TYPE IF EXISTS OctCell3D CASCADE;
+CREATE TYPE VoxelSet3D;
+CREATE TYPE VoxelCell3D;
+CREATE TYPE OctCell3D;
+
+/******************************************************************************/
+
+CREATE OR REPLACE FUNCTION voxelset3D_in(cstring) RETURNS VoxelSet3D AS 'MODULE_PATHNAME', 'voxelset3D_in' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelset3D_out(VoxelSet3D) RETURNS cstring AS 'MODULE_PATHNAME', 'voxelset3D_out' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelset3D_recv(internal) RETURNS VoxelSet3D AS 'MODULE_PATHNAME', 'voxelset3D_recv' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelset3D_send(VoxelSet3D) RETURNS bytea AS 'MODULE_PATHNAME', 'voxelset3D_send' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE TYPE VoxelSet3D (
+   internallength = variable,
+   input = voxelset3D_in,
+   output = voxelset3D_out,
+   receive = voxelset3D_recv,
+   send = voxelset3D_send,
+   alignment = double,
+   storage = extended
+);
+
+/******************************************************************************
+ * Accessors
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION nvoxels(vs VoxelSet3D) RETURNS int4 AS 'MODULE_PATHNAME', 'voxelset3D_nvoxels' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelsize(vs VoxelSet3D) RETURNS float8 AS 'MODULE_PATHNAME', 'voxelset3D_voxelsize' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION origin(vs VoxelSet3D) RETURNS Point3D AS 'MODULE_PATHNAME', 'voxelset3D_origin' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelcount(vs VoxelSet3D, point Point3D) RETURNS int8 AS 'MODULE_PATHNAME', 'voxelset3D_count' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION voxelset3D_voxels(vs VoxelSet3D, OUT i int4, OUT j int4, OUT k int4, OUT voxel Box3D, OUT count int8) RETURNS SETOF record AS 'MODULE_PATHNAME', 'voxelset3D_voxels' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************
+ * Aggregate counting the points in the voxels of a grid
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION voxelize3D_transfn(internal, Point3D, float8) RETURNS internal AS 'MODULE_PATHNAME', 'voxelize3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelize3D_transfn(internal, Point3D, float8, Point3D) RETURNS internal AS 'MODULE_PATHNAME', 'voxelize3D_transfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelize3D_combinefn(internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'voxelize3D_combinefn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelize3D_serialfn(internal) RETURNS bytea AS 'MODULE_PATHNAME', 'voxelize3D_serialfn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelize3D_deserialfn(bytea, internal) RETURNS internal AS 'MODULE_PATHNAME', 'voxelize3D_deserialfn' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelize3D_finalfn(internal) RETURNS VoxelSet3D AS 'MODULE_PATHNAME', 'voxelize3D_finalfn' LANGUAGE C IMMUTABLE PARALLEL SAFE;
+
+CREATE AGGREGATE voxelize3D(point Point3D, voxel_size float8) (
+	SFUNC = voxelize3D_transfn,
+	STYPE = internal,
+	FINALFUNC = voxelize3D_finalfn,
+	COMBINEFUNC = voxelize3D_combinefn,
+	SERIALFUNC = voxelize3D_serialfn,
+	DESERIALFUNC = voxelize3D_deserialfn,
+	PARALLEL = SAFE
+);
+
+CREATE AGGREGATE voxelize3D(point Point3D, voxel_size float8, origin Point3D) (
+	SFUNC = voxelize3D_transfn,
+	STYPE = internal,
+	FINALFUNC = voxelize3D_finalfn,
+	COMBINEFUNC = voxelize3D_combinefn,
+	SERIALFUNC = voxelize3D_serialfn,
+	DESERIALFUNC = voxelize3D_deserialfn,
+	PARALLEL = SAFE
+);
+
+/******************************************************************************
+ * Voxel cells
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION voxelcell3D_in(cstring) RETURNS VoxelCell3D AS 'MODULE_PATHNAME', 'voxelcell3D_in' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelcell3D_out(VoxelCell3D) RETURNS cstring AS 'MODULE_PATHNAME', 'voxelcell3D_out' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelcell3D_recv(internal) RETURNS VoxelCell3D AS 'MODULE_PATHNAME', 'voxelcell3D_recv' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelcell3D_send(VoxelCell3D) RETURNS bytea AS 'MODULE_PATHNAME', 'voxelcell3D_send' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE TYPE VoxelCell3D (
+   internallength = 8,
+   input = voxelcell3D_in,
+   output = voxelcell3D_out,
+   receive = voxelcell3D_recv,
+   send = voxelcell3D_send,
+   alignment = double
+);
+
+CREATE OR REPLACE FUNCTION voxelcell3D(point Point3D, voxel_size float8) RETURNS VoxelCell3D AS 'MODULE_PATHNAME', 'voxelcell3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxel(cell VoxelCell3D, voxel_size float8) RETURNS Box3D AS 'MODULE_PATHNAME', 'voxelcell3D_voxel' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelcells3D(point Point3D, voxel_size float8, distance float8 DEFAULT 0) RETURNS SETOF VoxelCell3D AS 'MODULE_PATHNAME', 'voxelcells3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxelcells3D(box Box3D, voxel_size float8, distance float8 DEFAULT 0) RETURNS SETOF VoxelCell3D AS 'MODULE_PATHNAME', 'voxelcells3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION voxelcells3D_rows_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'voxelcells3D_rows_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/* Estimate the number of cells returned from PostgreSQL 12 */
+DO $$
+BEGIN
+	IF current_setting('server_version_num')::int >= 120000 THEN
+		ALTER FUNCTION voxelcells3D(Point3D, float8, float8) SUPPORT voxelcells3D_rows_support;
+		ALTER FUNCTION voxelcells3D(Box3D, float8, float8) SUPPORT voxelcells3D_rows_support;
+	END IF;
+END;
+$$;
+
+------------------------------------------------------------------------------
+--	Operator classes for defining b-tree and hash indexes
+------------------------------------------------------------------------------
+
+CREATE FUNCTION voxelcell3D_lt(VoxelCell3D, VoxelCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'voxelcell3D_lt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION voxelcell3D_le(VoxelCell3D, VoxelCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'voxelcell3D_le' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION voxelcell3D_eq(VoxelCell3D, VoxelCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'voxelcell3D_eq' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION voxelcell3D_ne(VoxelCell3D, VoxelCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'voxelcell3D_ne' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION voxelcell3D_ge(VoxelCell3D, VoxelCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'voxelcell3D_ge' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION voxelcell3D_gt(VoxelCell3D, VoxelCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'voxelcell3D_gt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION voxelcell3D_cmp(VoxelCell3D, VoxelCell3D) RETURNS int4 AS 'MODULE_PATHNAME', 'voxelcell3D_cmp' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION voxelcell3D_hash(VoxelCell3D) RETURNS int4 AS 'MODULE_PATHNAME', 'voxelcell3D_hash' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR < (
+   leftarg = VoxelCell3D, rightarg = VoxelCell3D, procedure = voxelcell3D_lt,
+   commutator = > , negator = >= ,
+   restrict = scalarltsel, join = scalarltjoinsel
+);
+CREATE OPERATOR <= (
+   leftarg = VoxelCell3D, rightarg = VoxelCell3D, procedure = voxelcell3D_le,
+   commutator = >= , negator = > ,
+   restrict = scalarltsel, join = scalarltjoinsel
+);
+CREATE OPERATOR = (
+   leftarg = VoxelCell3D, rightarg = VoxelCell3D, procedure = voxelcell3D_eq,
+   commutator = = ,
+   negator = <> ,
+   restrict = eqsel, join = eqjoinsel,
+   hashes, merges
+);
+CREATE OPERATOR <> (
+   leftarg = VoxelCell3D, rightarg = VoxelCell3D, procedure = voxelcell3D_ne,
+   commutator = <> ,
+   negator = = ,
+   restrict = neqsel, join = neqjoinsel
+);
+CREATE OPERATOR >= (
+   leftarg = VoxelCell3D, rightarg = VoxelCell3D, procedure = voxelcell3D_ge,
+   commutator = <= , negator = < ,
+   restrict = scalargtsel, join = scalargtjoinsel
+);
+CREATE OPERATOR > (
+   leftarg = VoxelCell3D, rightarg = VoxelCell3D, procedure = voxelcell3D_gt,
+   commutator = < , negator = <= ,
+   restrict = scalargtsel, join = scalargtjoinsel
+);
+
+CREATE OPERATOR CLASS voxelcell3D_ops
+    DEFAULT FOR TYPE VoxelCell3D USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       voxelcell3D_cmp(VoxelCell3D, VoxelCell3D);
+
+CREATE OPERATOR CLASS voxelcell3D_hash_ops
+    DEFAULT FOR TYPE VoxelCell3D USING hash AS
+        OPERATOR        1       = ,
+        FUNCTION        1       voxelcell3D_hash(VoxelCell3D);
+
+------------------------------------------------------------------------------
+--	Space-filling curve keys
+------------------------------------------------------------------------------
+
+CREATE OR REPLACE FUNCTION morton3D(point Point3D, voxel_size float8) RETURNS int8 AS 'MODULE_PATHNAME', 'morton3D_key' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION hilbert3D(point Point3D, voxel_size float8) RETURNS int8 AS 'MODULE_PATHNAME', 'hilbert3D_key' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION morton3D_ranges(box Box3D, voxel_size float8, max_ranges int4 DEFAULT 16, OUT lo int8, OUT hi int8) RETURNS SETOF record AS 'MODULE_PATHNAME', 'morton3D_ranges' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION hilbert3D_ranges(box Box3D, voxel_size float8, max_ranges int4 DEFAULT 16, OUT lo int8, OUT hi int8) RETURNS SETOF record AS 'MODULE_PATHNAME', 'hilbert3D_ranges' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION morton3D_within(key int8, box Box3D, voxel_size float8) RETURNS boolean AS 'MODULE_PATHNAME', 'morton3D_within' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION hilbert3D_within(key int8, box Box3D, voxel_size float8) RETURNS boolean AS 'MODULE_PATHNAME', 'hilbert3D_within' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION morton3D_within_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'morton3D_within_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION hilbert3D_within_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'hilbert3D_within_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/* Search a btree index on the key from PostgreSQL 12 */
+DO $$
+BEGIN
+	IF current_setting('server_version_num')::int >= 120000 THEN
+		ALTER FUNCTION morton3D_within(int8, Box3D, float8) SUPPORT morton3D_within_support;
+		ALTER FUNCTION hilbert3D_within(int8, Box3D, float8) SUPPORT hilbert3D_within_support;
+	END IF;
+END;
+$$;
+
+/******************************************************************************
+ * Octree cells
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION octcell3D_in(cstring) RETURNS OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_in' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcell3D_out(OctCell3D) RETURNS cstring AS 'MODULE_PATHNAME', 'octcell3D_out' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcell3D_recv(internal) RETURNS OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_recv' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcell3D_send(OctCell3D) RETURNS bytea AS 'MODULE_PATHNAME', 'octcell3D_send' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE TYPE OctCell3D (
+   internallength = 8,
+   input = octcell3D_in,
+   output = octcell3D_out,
+   receive = octcell3D_recv,
+   send = octcell3D_send,
+   alignment = double
+);
+
+CREATE OR REPLACE FUNCTION octcell3D(point Point3D, voxel_size float8, level int4) RETURNS OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcell3D(cell VoxelCell3D) RETURNS OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_voxelcell3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcell3D(id int8) RETURNS OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_from_id' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION cellid(cell OctCell3D) RETURNS int8 AS 'MODULE_PATHNAME', 'octcell3D_id' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION level(cell OctCell3D) RETURNS int4 AS 'MODULE_PATHNAME', 'octcell3D_level' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION voxel(cell OctCell3D, voxel_size float8) RETURNS Box3D AS 'MODULE_PATHNAME', 'octcell3D_voxel' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION parent(cell OctCell3D) RETURNS OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_parent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION parent(cell OctCell3D, level int4) RETURNS OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_parent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION children(cell OctCell3D) RETURNS SETOF OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_children' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE ROWS 8;
+CREATE OR REPLACE FUNCTION neighbours(cell OctCell3D) RETURNS SETOF OctCell3D AS 'MODULE_PATHNAME', 'octcell3D_neighbours' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE ROWS 26;
+
+CREATE OR REPLACE FUNCTION octcells3D(box Box3D, voxel_size float8, max_level int4, max_cells int4 DEFAULT 64) RETURNS SETOF OctCell3D AS 'MODULE_PATHNAME', 'octcells3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcells3D(sphere Sphere, voxel_size float8, max_level int4, max_cells int4 DEFAULT 64) RETURNS SETOF OctCell3D AS 'MODULE_PATHNAME', 'octcells3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcells3D(poly Polygon3D, voxel_size float8, max_level int4, max_cells int4 DEFAULT 64) RETURNS SETOF OctCell3D AS 'MODULE_PATHNAME', 'octcells3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE FUNCTION octcell3D_contains(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_contains' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_contained(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_contained' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR @> (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_contains,
+   commutator = <@ ,
+   restrict = contsel, join = contjoinsel
+);
+CREATE OPERATOR <@ (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_contained,
+   commutator = @> ,
+   restrict = contsel, join = contjoinsel
+);
+
+CREATE OR REPLACE FUNCTION octcell3D_contains_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'octcell3D_contains_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION octcell3D_contained_support(internal) RETURNS internal AS 'MODULE_PATHNAME', 'octcell3D_contained_support' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/* Search a btree index on the cells from PostgreSQL 12 */
+DO $$
+BEGIN
+	IF current_setting('server_version_num')::int >= 120000 THEN
+		ALTER FUNCTION octcell3D_contains(OctCell3D, OctCell3D) SUPPORT octcell3D_contains_support;
+		ALTER FUNCTION octcell3D_contained(OctCell3D, OctCell3D) SUPPORT octcell3D_contained_support;
+	END IF;
+END;
+$$;
+
+------------------------------------------------------------------------------
+--	Operator classes for defining b-tree, hash, and GIN indexes
+------------------------------------------------------------------------------
+
+CREATE FUNCTION octcell3D_lt(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_lt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_le(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_le' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_eq(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_eq' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_ne(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_ne' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_ge(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_ge' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_gt(OctCell3D, OctCell3D) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_gt' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_cmp(OctCell3D, OctCell3D) RETURNS int4 AS 'MODULE_PATHNAME', 'octcell3D_cmp' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_hash(OctCell3D) RETURNS int4 AS 'MODULE_PATHNAME', 'octcell3D_hash' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR < (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_lt,
+   commutator = > , negator = >= ,
+   restrict = scalarltsel, join = scalarltjoinsel
+);
+CREATE OPERATOR <= (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_le,
+   commutator = >= , negator = > ,
+   restrict = scalarltsel, join = scalarltjoinsel
+);
+CREATE OPERATOR = (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_eq,
+   commutator = = ,
+   negator = <> ,
+   restrict = eqsel, join = eqjoinsel,
+   hashes, merges
+);
+CREATE OPERATOR <> (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_ne,
+   commutator = <> ,
+   negator = = ,
+   restrict = neqsel, join = neqjoinsel
+);
+CREATE OPERATOR >= (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_ge,
+   commutator = <= , negator = < ,
+   restrict = scalargtsel, join = scalargtjoinsel
+);
+CREATE OPERATOR > (
+   leftarg = OctCell3D, rightarg = OctCell3D, procedure = octcell3D_gt,
+   commutator = < , negator = <= ,
+   restrict = scalargtsel, join = scalargtjoinsel
+);
+
+CREATE OPERATOR CLASS octcell3D_ops
+    DEFAULT FOR TYPE OctCell3D USING btree AS
+        OPERATOR        1       < ,
+        OPERATOR        2       <= ,
+        OPERATOR        3       = ,
+        OPERATOR        4       >= ,
+        OPERATOR        5       > ,
+        FUNCTION        1       octcell3D_cmp(OctCell3D, OctCell3D);
+
+CREATE OPERATOR CLASS octcell3D_hash_ops
+    DEFAULT FOR TYPE OctCell3D USING hash AS
+        OPERATOR        1       = ,
+        FUNCTION        1       octcell3D_hash(OctCell3D);
+
+CREATE FUNCTION octcell3D_gin_extract_value(OctCell3D, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'octcell3D_gin_extract_value' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_gin_extract_query(OctCell3D, internal, int2, internal, internal, internal, internal) RETURNS internal AS 'MODULE_PATHNAME', 'octcell3D_gin_extract_query' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE FUNCTION octcell3D_gin_consistent(internal, int2, OctCell3D, int4, internal, internal, internal, internal) RETURNS boolean AS 'MODULE_PATHNAME', 'octcell3D_gin_consistent' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OPERATOR CLASS octcell3D_gin_ops
+    DEFAULT FOR TYPE OctCell3D USING gin AS
+        OPERATOR        7       @> ,
+        OPERATOR        8       <@ ,
+        FUNCTION        1       btint8cmp(int8, int8),
+        FUNCTION        2       octcell3D_gin_extract_value(OctCell3D, internal, internal),
+        FUNCTION        3       octcell3D_gin_extract_query(OctCell3D, internal, int2, internal, internal, internal, internal),
+        FUNCTION        4       octcell3D_gin_consistent(internal, int2, OctCell3D, int4, internal, internal, internal, internal),
+        STORAGE         int8;
+
+/******************************************************************************
+ * Partition cells
+ *****************************************************************************/
+
+/*
+ * The partition key of a geometry is the identifier of the smallest cell of
+ * level at most the given one containing its bounding box, e.g.,
+ *   CREATE TABLE t (id int, geom Box3D)
+ *     PARTITION BY HASH (partitioncell3D(geom, 10.0, 8));
+ * Once the library is loaded, the planner adds to the predicates comparing
+ * the column with a constant through &&, @>, <@, ?# or dwithin3D the
+ * condition that the key is one of the partitioncells3D of the bounding box
+ * of the constant, on which it prunes the partitions.
+ */
+CREATE OR REPLACE FUNCTION partitioncell3D(point Point3D, voxel_size float8, level int4) RETURNS int8 AS 'MODULE_PATHNAME', 'partitioncell3D_point3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION partitioncell3D(lseg Lseg3D, voxel_size float8, level int4) RETURNS int8 AS 'MODULE_PATHNAME', 'partitioncell3D_lseg3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION partitioncell3D(box Box3D, voxel_size float8, level int4) RETURNS int8 AS 'MODULE_PATHNAME', 'partitioncell3D_box3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION partitioncell3D(path Path3D, voxel_size float8, level int4) RETURNS int8 AS 'MODULE_PATHNAME', 'partitioncell3D_path3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION partitioncell3D(poly Polygon3D, voxel_size float8, level int4) RETURNS int8 AS 'MODULE_PATHNAME', 'partitioncell3D_poly3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION partitioncell3D(sphere Sphere, voxel_size float8, level int4) RETURNS int8 AS 'MODULE_PATHNAME', 'partitioncell3D_sphere' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION partitioncell3D(patch PointPatch3D, voxel_size float8, level int4) RETURNS int8 AS 'MODULE_PATHNAME', 'partitioncell3D_pointpatch3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+CREATE OR REPLACE FUNCTION partitioncells3D(box Box3D, voxel_size float8, level int4) RETURNS int8[] AS 'MODULE_PATHNAME', 'partitioncells3D' LANGUAGE C IMMUTABLE STRICT PARALLEL SAFE;
+
+/******************************************************************************/
@@ -0,0 +1,24 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_join.sql
+ *	  Spatial joins of 3D relations
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------*/
+
+/******************************************************************************
+ * Partition based spatial-merge join
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION spatialjoin3D(rel1 regclass, col1 text, rel2 regclass, col2 text, predicate text DEFAULT '&&', OUT ctid1 tid, OUT ctid2 tid) RETURNS SETOF record AS 'MODULE_PATHNAME', 'spatialjoin3D' LANGUAGE C STABLE STRICT PARALLEL RESTRICTED;
+
+/******************************************************************************
+ * k-nearest neighbour join
+ *****************************************************************************/
+
+CREATE OR REPLACE FUNCTION knnjoin3D(rel1 regclass, col1 text, rel2 regclass, col2 text, k integer DEFAULT 1, OUT ctid1 tid, OUT ctid2 tid, OUT distance float8) RETURNS SETOF record AS 'MODULE_PATHNAME', 'knnjoin3D' LANGUAGE C STABLE STRICT PARALLEL RESTRICTED;
+
+/******************************************************************************/
@@ -0,0 +1,707 @@
+/*****************************************************************************
+ *
+ * geo3D_aggregates.c
+ *	  Aggregate functions for 3D geometries
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <math.h>
+#include <float.h>
+
+#include <catalog/pg_type.h>
+#include <utils/array.h>
+#include <utils/builtins.h>
+#include "geo3D_decls.h"
+
+/*****************************************************************************
+ * Extent
+ *
+ * The transition state of extent3D is a Box3D, which is of fixed size so
+ * that no serialization is needed for parallel aggregation. The state is
+ * allocated in the aggregate context on the first row and then expanded in
+ * place, which avoids a palloc per row.
+ *****************************************************************************/
+
+static inline void
+box3D_expand(Box3D *box, Point3D *low, Point3D *high)
+{
+	box->low.x = Min(box->low.x, low->x);
+	box->low.y = Min(box->low.y, low->y);
+	box->low.z = Min(box->low.z, low->z);
+	box->high.x = Max(box->high.x, high->x);
+	box->high.y = Max(box->high.y, high->y);
+	box->high.z = Max(box->high.z, high->z);
+}
+
+/*
+ * Expand the state in argument 0 with the box from low to high
+ */
+static Datum
+extent3D_transfn_internal(FunctionCallInfo fcinfo, Point3D *low, Point3D *high)
+{
+	MemoryContext aggcontext;
+	Box3D	   *state;
+
+	if (!AggCheckCallContext(fcinfo, &aggcontext))
+		elog(ERROR, "extent3D_transfn called in non-aggregate context");
+
+	if (PG_ARGISNULL(0))
+	{
+		state = (Box3D *) MemoryContextAlloc(aggcontext, sizeof(Box3D));
+		state->low = *low;
+		state->high = *high;
+	}
+	else
+	{
+		state = PG_GETARG_BOX3D_P(0);
+		box3D_expand(state, low, high);
+	}
+	PG_RETURN_BOX3D_P(state);
+}
+
+/* Return the current state, which may be NULL, when the value is NULL */
+#define EXTENT3D_SKIP_NULL() \
+	do { \
+		if (PG_ARGISNULL(1)) \
+		{ \
+			if (PG_ARGISNULL(0)) \
+				PG_RETURN_NULL(); \
+			PG_RETURN_DATUM(PG_GETARG_DATUM(0)); \
+		} \
+	} while (0)
+
+Datum
+extent3D_point3D_transfn(PG_FUNCTION_ARGS)
+{
+	Point3D    *point;
+
+	EXTENT3D_SKIP_NULL();
+	point = PG_GETARG_POINT3D_P(1);
+	return extent3D_transfn_internal(fcinfo, point, point);
+}
+
+PG_FUNCTION_INFO_V1(extent3D_point3D_transfn);
+
+Datum
+extent3D_lseg3D_transfn(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg;
+	Point3D		low,
+				high;
+
+	EXTENT3D_SKIP_NULL();
+	lseg = PG_GETARG_LSEG3D_P(1);
+	low.x = Min(lseg->p[0].x, lseg->p[1].x);
+	low.y = Min(lseg->p[0].y, lseg->p[1].y);
+	low.z = Min(lseg->p[0].z, lseg->p[1].z);
+	high.x = Max(lseg->p[0].x, lseg->p[1].x);
+	high.y = Max(lseg->p[0].y, lseg->p[1].y);
+	high.z = Max(lseg->p[0].z, lseg->p[1].z);
+	return extent3D_transfn_internal(fcinfo, &low, &high);
+}
+
+PG_FUNCTION_INFO_V1(extent3D_lseg3D_transfn);
+
+Datum
+extent3D_box3D_transfn(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box;
+
+	EXTENT3D_SKIP_NULL();
+	box = PG_GETARG_BOX3D_P(1);
+	return extent3D_transfn_internal(fcinfo, &box->low, &box->high);
+}
+
+PG_FUNCTION_INFO_V1(extent3D_box3D_transfn);
+
+/*
+ * The bounding box of paths, polygons, and point patches is in their header,
+ * so only the header of toasted values is fetched
+ */
+Datum
+extent3D_path3D_transfn(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path;
+	Datum		result;
+
+	EXTENT3D_SKIP_NULL();
+	path = (Path3D *) PG_DETOAST_DATUM_SLICE(PG_GETARG_DATUM(1), 0,
+		offsetof(Path3D, p));
+	result = extent3D_transfn_internal(fcinfo, &path->boundbox.low,
+		&path->boundbox.high);
+	PG_FREE_IF_COPY(path, 1);
+	return result;
+}
+
+PG_FUNCTION_INFO_V1(extent3D_path3D_transfn);
+
+Datum
+extent3D_poly3D_transfn(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly;
+	Datum		result;
+
+	EXTENT3D_SKIP_NULL();
+	poly = (Polygon3D *) PG_DETOAST_DATUM_SLICE(PG_GETARG_DATUM(1), 0,
+		offsetof(Polygon3D, p));
+	result = extent3D_transfn_internal(fcinfo, &poly->boundbox.low,
+		&poly->boundbox.high);
+	PG_FREE_IF_COPY(poly, 1);
+	return result;
+}
+
+PG_FUNCTION_INFO_V1(extent3D_poly3D_transfn);
+
+Datum
+extent3D_sphere_transfn(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere;
+	Point3D		low,
+				high;
+
+	EXTENT3D_SKIP_NULL();
+	sphere = PG_GETARG_SPHERE_P(1);
+	low.x = sphere->center.x - sphere->radius;
+	low.y = sphere->center.y - sphere->radius;
+	low.z = sphere->center.z - sphere->radius;
+	high.x = sphere->center.x + sphere->radius;
+	high.y = sphere->center.y + sphere->radius;
+	high.z = sphere->center.z + sphere->radius;
+	return extent3D_transfn_internal(fcinfo, &low, &high);
+}
+
+PG_FUNCTION_INFO_V1(extent3D_sphere_transfn);
+
+Datum
+extent3D_pointpatch3D_transfn(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch;
+	Datum		result;
+
+	EXTENT3D_SKIP_NULL();
+	patch = PG_GETARG_POINTPATCH3D_HEADER(1);
+	result = extent3D_transfn_internal(fcinfo, &patch->boundbox.low,
+		&patch->boundbox.high);
+	PG_FREE_IF_COPY(patch, 1);
+	return result;
+}
+
+PG_FUNCTION_INFO_V1(extent3D_pointpatch3D_transfn);
+
+/*
+ * extent3D_combinefn: Combine the states of two partial aggregates. The
+ * function is strict, so that the executor handles the NULL states.
+ */
+Datum
+extent3D_combinefn(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box1 = PG_GETARG_BOX3D_P(0);
+	Box3D	   *box2 = PG_GETARG_BOX3D_P(1);
+
+	if (!AggCheckCallContext(fcinfo, NULL))
+		elog(ERROR, "extent3D_combinefn called in non-aggregate context");
+
+	box3D_expand(box1, &box2->low, &box2->high);
+	PG_RETURN_BOX3D_P(box1);
+}
+
+PG_FUNCTION_INFO_V1(extent3D_combinefn);
+
+/*****************************************************************************
+ * Moments of points
+ *
+ * The centroid, covariance, and principal axes aggregates share a float8[]
+ * transition state holding the number of points, their mean, and the sums
+ * of the products of the deviations from the mean
+ *		{n, mx, my, mz, cxx, cxy, cxz, cyy, cyz, czz}
+ * which are updated with Welford's algorithm, and combined with the formula
+ * of Chan et al. for parallel aggregation. As for the float8 aggregates of
+ * PostgreSQL, the array needs no serialization and is updated in place.
+ *****************************************************************************/
+
+#define MOMENTS3D_N		10
+
+static double *
+moments3D_check(ArrayType *transarray, const char *caller)
+{
+	if (ARR_NDIM(transarray) != 1 ||
+		ARR_DIMS(transarray)[0] != MOMENTS3D_N ||
+		ARR_HASNULL(transarray) ||
+		ARR_ELEMTYPE(transarray) != FLOAT8OID)
+		elog(ERROR, "%s: expected %d-element float8 array", caller, MOMENTS3D_N);
+	return (double *) ARR_DATA_PTR(transarray);
+}
+
+static ArrayType *
+moments3D_array(double *moments)
+{
+	Datum		d[MOMENTS3D_N];
+	int			i;
+
+	for (i = 0; i < MOMENTS3D_N; i++)
+		d[i] = Float8GetDatumFast(moments[i]);
+	return construct_array(d, MOMENTS3D_N, FLOAT8OID, sizeof(float8),
+		FLOAT8PASSBYVAL, 'd');
+}
+
+/*
+ * point3D_moments_transfn: Add a point to the moments
+ */
+Datum
+point3D_moments_transfn(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray = PG_GETARG_ARRAYTYPE_P(0);
+	Point3D    *point = PG_GETARG_POINT3D_P(1);
+	double	   *m = moments3D_check(transarray, "point3D_moments_transfn");
+	double		result[MOMENTS3D_N];
+	double	   *r;
+	double		n = m[0] + 1.0;
+	double		dx = point->x - m[1],
+				dy = point->y - m[2],
+				dz = point->z - m[3];
+	double		ex,
+				ey,
+				ez;
+
+	/* Update in place in an aggregate, since the array is ours */
+	r = AggCheckCallContext(fcinfo, NULL) ? m : result;
+
+	r[0] = n;
+	r[1] = m[1] + dx / n;
+	r[2] = m[2] + dy / n;
+	r[3] = m[3] + dz / n;
+	ex = point->x - r[1];
+	ey = point->y - r[2];
+	ez = point->z - r[3];
+	r[4] = m[4] + dx * ex;
+	r[5] = m[5] + dx * ey;
+	r[6] = m[6] + dx * ez;
+	r[7] = m[7] + dy * ey;
+	r[8] = m[8] + dy * ez;
+	r[9] = m[9] + dz * ez;
+
+	if (r == m)
+		PG_RETURN_ARRAYTYPE_P(transarray);
+	PG_RETURN_ARRAYTYPE_P(moments3D_array(result));
+}
+
+PG_FUNCTION_INFO_V1(point3D_moments_transfn);
+
+/*
+ * point3D_moments_combinefn: Combine the moments of two sets of points
+ */
+Datum
+point3D_moments_combinefn(PG_FUNCTION_ARGS)
+{
+	ArrayType  *transarray1 = PG_GETARG_ARRAYTYPE_P(0);
+	ArrayType  *transarray2 = PG_GETARG_ARRAYTYPE_P(1);
+	double	   *m1 = moments3D_check(transarray1, "point3D_moments_combinefn");
+	double	   *m2 = moments3D_check(transarray2, "point3D_moments_combinefn");
+	double		result[MOMENTS3D_N];
+	double	   *r;
+	double		n,
+				f,
+				dx,
+				dy,
+				dz;
+	int			i;
+
+	r = AggCheckCallContext(fcinfo, NULL) ? m1 : result;
+
+	if (m2[0] == 0.0)
+	{
+		if (r != m1)
+			memcpy(r, m1, sizeof(double) * MOMENTS3D_N);
+	}
+	else if (m1[0] == 0.0)
+		memcpy(r, m2, sizeof(double) * MOMENTS3D_N);
+	else
+	{
+		n = m1[0] + m2[0];
+		f = m1[0] * m2[0] / n;
+		dx = m2[1] - m1[1];
+		dy = m2[2] - m1[2];
+		dz = m2[3] - m1[3];
+		r[4] = m1[4] + m2[4] + dx * dx * f;
+		r[5] = m1[5] + m2[5] + dx * dy * f;
+		r[6] = m1[6] + m2[6] + dx * dz * f;
+		r[7] = m1[7] + m2[7] + dy * dy * f;
+		r[8] = m1[8] + m2[8] + dy * dz * f;
+		r[9] = m1[9] + m2[9] + dz * dz * f;
+		for (i = 1; i <= 3; i++)
+			r[i] = m1[i] + (m2[i] - m1[i]) * m2[0] / n;
+		r[0] = n;
+	}
+
+	if (r == m1)
+		PG_RETURN_ARRAYTYPE_P(transarray1);
+	PG_RETURN_ARRAYTYPE_P(moments3D_array(result));
+}
+
+PG_FUNCTION_INFO_V1(point3D_moments_combinefn);
+
+/*
+ * Fill the symmetric matrix cov with the sample covariance of the moments
+ */
+static void
+moments3D_covariance(double *m, double cov[3][3])
+{
+	double		d = m[0] - 1.0;
+
+	cov[0][0] = m[4] / d;
+	cov[0][1] = cov[1][0] = m[5] / d;
+	cov[0][2] = cov[2][0] = m[6] / d;
+	cov[1][1] = m[7] / d;
+	cov[1][2] = cov[2][1] = m[8] / d;
+	cov[2][2] = m[9] / d;
+}
+
+/*
+ * eigen3D_symmetric: Eigenvalues and eigenvectors of the symmetric matrix a,
+ * which is destroyed, with the cyclic Jacobi method. The eigenvalues are
+ * returned in w in decreasing order and the corresponding unit eigenvectors
+ * in the columns of v.
+ */
+static void
+eigen3D_symmetric(double a[3][3], double w[3], double v[3][3])
+{
+	int			sweep,
+				p,
+				q,
+				k;
+
+	for (p = 0; p < 3; p++)
+		for (q = 0; q < 3; q++)
+			v[p][q] = (p == q) ? 1.0 : 0.0;
+
+	for (sweep = 0; sweep < 50; sweep++)
+	{
+		double		off = fabs(a[0][1]) + fabs(a[0][2]) + fabs(a[1][2]);
+		double		diag = fabs(a[0][0]) + fabs(a[1][1]) + fabs(a[2][2]);
+
+		if (off == 0.0 || off <= DBL_EPSILON * diag)
+			break;
+
+		for (p = 0; p < 2; p++)
+		{
+			for (q = p + 1; q < 3; q++)
+			{
+				double		theta,
+							t,
+							c,
+							s;
+
+				if (a[p][q] == 0.0)
+					continue;
+				theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+				t = 1.0 / (fabs(theta) + sqrt(theta * theta + 1.0));
+				if (theta < 0.0)
+					t = -t;
+				c = 1.0 / sqrt(t * t + 1.0);
+				s = t * c;
+
+				for (k = 0; k < 3; k++)
+				{
+					double		g = a[k][p],
+								h = a[k][q];
+
+					a[k][p] = c * g - s * h;
+					a[k][q] = s * g + c * h;
+				}
+				for (k = 0; k < 3; k++)
+				{
+					double		g = a[p][k],
+								h = a[q][k];
+
+					a[p][k] = c * g - s * h;
+					a[q][k] = s * g + c * h;
+				}
+				for (k = 0; k < 3; k++)
+				{
+					double		g = v[k][p],
+								h = v[k][q];
+
+					v[k][p] = c * g - s * h;
+					v[k][q] = s * g + c * h;
+				}
+			}
+		}
+	}
+
+	for (p = 0; p < 3; p++)
+		w[p] = a[p][p];
+
+	/* Sort in decreasing order of eigenvalue */
+	for (p = 0; p < 2; p++)
+	{
+		int			max = p;
+
+		for (q = p + 1; q < 3; q++)
+			if (w[q] > w[max])
+				max = q;
+		if (max != p)
+		{
+			double		tmp = w[p];
+
+			w[p] = w[max];
+			w[max] = tmp;
+			for (k = 0; k < 3; k++)
+			{
+				tmp = v[k][p];
+				v[k][p] = v[k][max];
+				v[k][max] = tmp;
+			}
+		}
+	}
+
+	/* Make the result deterministic: largest component of each axis positive */
+	for (q = 0; q < 3; q++)
+	{
+		int			max = 0;
+
+		for (k = 1; k < 3; k++)
+			if (fabs(v[k][q]) > fabs(v[max][q]))
+				max = k;
+		if (v[max][q] < 0.0)
+			for (k = 0; k < 3; k++)
+				v[k][q] = -v[k][q];
+	}
+}
+
+/*
+ * centroid3D_finalfn: Mean of the points, NULL if there are none
+ */
+Datum
+centroid3D_finalfn(PG_FUNCTION_ARGS)
+{
+	double	   *m = moments3D_check(PG_GETARG_ARRAYTYPE_P(0), "centroid3D_finalfn");
+	Point3D    *result;
+
+	if (m[0] == 0.0)
+		PG_RETURN_NULL();
+
+	result = (Point3D *) palloc(sizeof(Point3D));
+	result->x = m[1];
+	result->y = m[2];
+	result->z = m[3];
+	PG_RETURN_POINT3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(centroid3D_finalfn);
+
+/*
+ * covariance3D_finalfn: Sample covariance matrix of the points as a
+ * float8[3][3], NULL if there are less than two points
+ */
+Datum
+covariance3D_finalfn(PG_FUNCTION_ARGS)
+{
+	double	   *m = moments3D_check(PG_GETARG_ARRAYTYPE_P(0), "covariance3D_finalfn");
+	double		cov[3][3];
+	Datum		d[9];
+	int			dims[2] = {3, 3};
+	int			lbs[2] = {1, 1};
+	int			i,
+				j;
+
+	if (m[0] < 2.0)
+		PG_RETURN_NULL();
+
+	moments3D_covariance(m, cov);
+	for (i = 0; i < 3; i++)
+		for (j = 0; j < 3; j++)
+			d[i * 3 + j] = Float8GetDatumFast(cov[i][j]);
+
+	PG_RETURN_ARRAYTYPE_P(construct_md_array(d, NULL, 2, dims, lbs, FLOAT8OID,
+		sizeof(float8), FLOAT8PASSBYVAL, 'd'));
+}
+
+PG_FUNCTION_INFO_V1(covariance3D_finalfn);
+
+/*
+ * principal_axes3D_finalfn: Unit vectors of the principal axes of the
+ * points in decreasing order of variance, NULL if there are less than two
+ * points. The last axis is the normal of the best fitting plane.
+ */
+Datum
+principal_axes3D_finalfn(PG_FUNCTION_ARGS)
+{
+	double	   *m = moments3D_check(PG_GETARG_ARRAYTYPE_P(0), "principal_axes3D_finalfn");
+	double		cov[3][3],
+				w[3],
+				v[3][3];
+	Point3D    *axes;
+	Datum		d[3];
+	int			i;
+
+	if (m[0] < 2.0)
+		PG_RETURN_NULL();
+
+	moments3D_covariance(m, cov);
+	eigen3D_symmetric(cov, w, v);
+
+	axes = (Point3D *) palloc(sizeof(Point3D) * 3);
+	for (i = 0; i < 3; i++)
+	{
+		axes[i].x = v[0][i];
+		axes[i].y = v[1][i];
+		axes[i].z = v[2][i];
+		d[i] = Point3DPGetDatum(&axes[i]);
+	}
+
+	PG_RETURN_ARRAYTYPE_P(construct_array(d, 3, point3d_oid(), sizeof(Point3D), FALSE, 'd'));
+}
+
+PG_FUNCTION_INFO_V1(principal_axes3D_finalfn);
+
+/*
+ * principal_variances3D_finalfn: Variances of the points along their
+ * principal axes in decreasing order, NULL if there are less than two points
+ */
+Datum
+principal_variances3D_finalfn(PG_FUNCTION_ARGS)
+{
+	double	   *m = moments3D_check(PG_GETARG_ARRAYTYPE_P(0), "principal_variances3D_finalfn");
+	double		cov[3][3],
+				w[3],
+				v[3][3];
+	Datum		d[3];
+	int			i;
+
+	if (m[0] < 2.0)
+		PG_RETURN_NULL();
+
+	moments3D_covariance(m, cov);
+	eigen3D_symmetric(cov, w, v);
+	for (i = 0; i < 3; i++)
+		d[i] = Float8GetDatumFast(w[i]);
+
+	PG_RETURN_ARRAYTYPE_P(construct_array(d, 3, FLOAT8OID, sizeof(float8),
+		FLOAT8PASSBYVAL, 'd'));
+}
+
+PG_FUNCTION_INFO_V1(principal_variances3D_finalfn);
+
+/*****************************************************************************
+ * Collect
+ *
+ * path3D_collect and poly3D_collect assemble the points of a group, usually
+ * given with ORDER BY, into a single Path3D or Polygon3D. The transition
+ * state is a Point3DBuilder allocated in the aggregate context, so that the
+ * points are appended in amortized constant time and the result is formed
+ * once by the final function.
+ *****************************************************************************/
+
+static Datum
+point3D_collect_transfn(FunctionCallInfo fcinfo, Size hdrsize,
+	const char *fname)
+{
+	MemoryContext aggcontext,
+				oldcontext;
+	Point3DBuilder *state;
+
+	if (!AggCheckCallContext(fcinfo, &aggcontext))
+		elog(ERROR, "%s called in non-aggregate context", fname);
+
+	if (PG_ARGISNULL(0))
+	{
+		oldcontext = MemoryContextSwitchTo(aggcontext);
+		state = (Point3DBuilder *) palloc(sizeof(Point3DBuilder));
+		point3D_builder_init(state, hdrsize, 0);
+		MemoryContextSwitchTo(oldcontext);
+	}
+	else
+		state = (Point3DBuilder *) PG_GETARG_POINTER(0);
+
+	if (!PG_ARGISNULL(1))
+		point3D_builder_append(state, PG_GETARG_POINT3D_P(1), 1, NULL);
+
+	PG_RETURN_POINTER(state);
+}
+
+/*
+ * Copy the result out of the state, since the final function may be called
+ * again on a state that keeps growing when the aggregate is used as a
+ * window function
+ */
+static Datum
+point3D_collect_result(void *result)
+{
+	Size		size = VARSIZE(result);
+	void	   *copy = palloc(size);
+
+	memcpy(copy, result, size);
+	return PointerGetDatum(copy);
+}
+
+/*
+ * path3D_collect_transfn: Append a point to the path being built
+ */
+Datum
+path3D_collect_transfn(PG_FUNCTION_ARGS)
+{
+	return point3D_collect_transfn(fcinfo, offsetof(Path3D, p),
+		"path3D_collect_transfn");
+}
+
+PG_FUNCTION_INFO_V1(path3D_collect_transfn);
+
+/*
+ * path3D_collect_finalfn: Open path through the collected points, NULL if
+ * there are none
+ */
+Datum
+path3D_collect_finalfn(PG_FUNCTION_ARGS)
+{
+	Point3DBuilder *state;
+
+	if (PG_ARGISNULL(0))
+		PG_RETURN_NULL();
+	state = (Point3DBuilder *) PG_GETARG_POINTER(0);
+	if (state->npts == 0)
+		PG_RETURN_NULL();
+
+	return point3D_collect_result(path3D_builder_finish(state, FALSE));
+}
+
+PG_FUNCTION_INFO_V1(path3D_collect_finalfn);
+
+/*
+ * poly3D_collect_transfn: Append a point to the polygon being built
+ */
+Datum
+poly3D_collect_transfn(PG_FUNCTION_ARGS)
+{
+	return point3D_collect_transfn(fcinfo, offsetof(Polygon3D, p),
+		"poly3D_collect_transfn");
+}
+
+PG_FUNCTION_INFO_V1(poly3D_collect_transfn);
+
+/*
+ * poly3D_collect_finalfn: Polygon whose vertices are the collected points,
+ * NULL if there are none
+ */
+Datum
+poly3D_collect_finalfn(PG_FUNCTION_ARGS)
+{
+	Point3DBuilder *state;
+
+	if (PG_ARGISNULL(0))
+		PG_RETURN_NULL();
+	state = (Point3DBuilder *) PG_GETARG_POINTER(0);
+	if (state->npts == 0)
+		PG_RETURN_NULL();
+
+	return point3D_collect_result(poly3D_builder_finish(state));
+}
+
+PG_FUNCTION_INFO_V1(poly3D_collect_finalfn);
+
+/*****************************************************************************/
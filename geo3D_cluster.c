@@ -0,0 +1,773 @@
+/*****************************************************************************
+ *
+ * geo3D_cluster.c
+ *	  Clustering of 3D points
+ *
+ * dbscan3D is a window function that assigns to each point of the window
+ * partition the number of its DBSCAN cluster, or NULL for noise points.
+ * On the first row of a partition, the points of the partition are sorted
+ * on a uniform grid whose cells are at least eps wide, so that the points
+ * at distance at most eps of a point are in the 27 cells around it. The
+ * clusters of all the rows are then computed at once and kept in the
+ * partition-local memory of the window function. Apart from the sort, the
+ * cost of the clustering depends on the number of points within eps of
+ * each point rather than on the size of the partition.
+ *
+ * kmeans3D is a window function that partitions the points of the window
+ * partition into k clusters with the k-means algorithm.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <math.h>
+#include <float.h>
+
+#include <miscadmin.h>
+#include <utils/memutils.h>
+#include <windowapi.h>
+#include "geo3D_decls.h"
+
+/*
+ * The clusters of all the rows of a partition are computed on its first row
+ * and kept in the partition-local memory of the window function
+ */
+typedef struct
+{
+	bool		computed;
+	int32		cluster[FLEXIBLE_ARRAY_MEMBER];	/* cluster of each row */
+} Cluster3DContext;
+
+static Cluster3DContext *
+cluster3D_context(WindowObject winobj, const char *fname)
+{
+	int64		rowcount = WinGetPartitionRowCount(winobj);
+
+	if (rowcount > (int64) ((MaxAllocSize - offsetof(Cluster3DContext, cluster)) / sizeof(int32)))
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("Too many points in the partition for %s", fname)));
+
+	return (Cluster3DContext *) WinGetPartitionLocalMemory(winobj,
+		offsetof(Cluster3DContext, cluster) + sizeof(int32) * rowcount);
+}
+
+/*****************************************************************************
+ * DBSCAN
+ *****************************************************************************/
+
+/* Number of bits per axis of the cell numbers of the grid */
+#define DBSCAN3D_CELLBITS		21
+#define DBSCAN3D_MAXCELL		((1 << DBSCAN3D_CELLBITS) - 1)
+
+/* Cluster of the points that are not yet visited or are noise */
+#define DBSCAN3D_UNVISITED		-1
+#define DBSCAN3D_NOISE			-2
+
+typedef struct
+{
+	uint64		key;			/* cell of the point */
+	int32		idx;			/* row number of the point */
+} DBSCAN3DCell;
+
+typedef struct
+{
+	Point3D    *points;			/* points indexed by row number */
+	DBSCAN3DCell *cells;		/* non-null points sorted on their cell */
+	int32		ncells;
+	Point3D		low;			/* origin of the grid */
+	double		cellsize;
+	double		eps;
+} DBSCAN3DGrid;
+
+static inline int32
+dbscan3D_cell(double value, double low, double cellsize)
+{
+	double		cell = floor((value - low) / cellsize);
+
+	return (int32) Min(cell, DBSCAN3D_MAXCELL);
+}
+
+static inline uint64
+dbscan3D_key(int32 cx, int32 cy, int32 cz)
+{
+	return ((uint64) cx << (2 * DBSCAN3D_CELLBITS)) |
+		((uint64) cy << DBSCAN3D_CELLBITS) | (uint64) cz;
+}
+
+static int
+dbscan3D_cell_cmp(const void *a, const void *b)
+{
+	const DBSCAN3DCell *ca = (const DBSCAN3DCell *) a;
+	const DBSCAN3DCell *cb = (const DBSCAN3DCell *) b;
+
+	if (ca->key != cb->key)
+		return (ca->key > cb->key) ? 1 : -1;
+	/* Keep the points of a cell in row order */
+	return (ca->idx > cb->idx) ? 1 : ((ca->idx < cb->idx) ? -1 : 0);
+}
+
+/*
+ * Sort the non-null points on the cells of a grid. The cells are at least
+ * eps wide, and wider when needed for the cell numbers to fit in
+ * DBSCAN3D_CELLBITS bits.
+ */
+static void
+dbscan3D_grid_build(DBSCAN3DGrid *grid, bool *isnull, int32 npts)
+{
+	Point3D		high;
+	double		extent;
+	bool		first = TRUE;
+	int			i;
+
+	grid->ncells = 0;
+	for (i = 0; i < npts; i++)
+	{
+		Point3D    *p = &grid->points[i];
+
+		if (isnull[i])
+			continue;
+		if (first)
+		{
+			grid->low = high = *p;
+			first = FALSE;
+			continue;
+		}
+		grid->low.x = Min(grid->low.x, p->x);
+		grid->low.y = Min(grid->low.y, p->y);
+		grid->low.z = Min(grid->low.z, p->z);
+		high.x = Max(high.x, p->x);
+		high.y = Max(high.y, p->y);
+		high.z = Max(high.z, p->z);
+	}
+	if (first)
+		return;
+
+	extent = Max(Max(high.x - grid->low.x, high.y - grid->low.y),
+		high.z - grid->low.z);
+	grid->cellsize = Max(grid->eps, extent / DBSCAN3D_MAXCELL);
+	if (grid->cellsize <= 0.0)
+		grid->cellsize = 1.0;
+
+	for (i = 0; i < npts; i++)
+	{
+		Point3D    *p = &grid->points[i];
+
+		if (isnull[i])
+			continue;
+		grid->cells[grid->ncells].key = dbscan3D_key(
+			dbscan3D_cell(p->x, grid->low.x, grid->cellsize),
+			dbscan3D_cell(p->y, grid->low.y, grid->cellsize),
+			dbscan3D_cell(p->z, grid->low.z, grid->cellsize));
+		grid->cells[grid->ncells].idx = i;
+		grid->ncells++;
+	}
+	qsort(grid->cells, grid->ncells, sizeof(DBSCAN3DCell), dbscan3D_cell_cmp);
+}
+
+/*
+ * Position of the first cell whose key is not less than key
+ */
+static int32
+dbscan3D_lower_bound(DBSCAN3DGrid *grid, uint64 key)
+{
+	int32		lo = 0,
+				hi = grid->ncells;
+
+	while (lo < hi)
+	{
+		int32		mid = lo + (hi - lo) / 2;
+
+		if (grid->cells[mid].key < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+/*
+ * Store in result the row numbers of the points at distance at most eps of
+ * the i-th point, including itself, and return their number. For each of
+ * the 9 columns of cells around the point along the z axis, the 3 cells of
+ * the column are contiguous in the sort order.
+ */
+static int32
+dbscan3D_neighbors(DBSCAN3DGrid *grid, int32 i, int32 *result)
+{
+	Point3D    *p = &grid->points[i];
+	int32		cx = dbscan3D_cell(p->x, grid->low.x, grid->cellsize),
+				cy = dbscan3D_cell(p->y, grid->low.y, grid->cellsize),
+				cz = dbscan3D_cell(p->z, grid->low.z, grid->cellsize);
+	int32		count = 0;
+	int32		x,
+				y,
+				j;
+
+	for (x = Max(cx - 1, 0); x <= Min(cx + 1, DBSCAN3D_MAXCELL); x++)
+	{
+		for (y = Max(cy - 1, 0); y <= Min(cy + 1, DBSCAN3D_MAXCELL); y++)
+		{
+			uint64		high = dbscan3D_key(x, y, Min(cz + 1, DBSCAN3D_MAXCELL));
+
+			for (j = dbscan3D_lower_bound(grid, dbscan3D_key(x, y, Max(cz - 1, 0)));
+				 j < grid->ncells && grid->cells[j].key <= high; j++)
+			{
+				int32		idx = grid->cells[j].idx;
+
+				if (dist_point3D_point3D(p, &grid->points[idx]) <= grid->eps)
+					result[count++] = idx;
+			}
+		}
+	}
+	return count;
+}
+
+/*
+ * Compute the cluster of each point. Clusters are numbered from 0 in the
+ * order of their first core point in the partition.
+ */
+static void
+dbscan3D_compute(DBSCAN3DGrid *grid, int32 minpts, int32 *cluster,
+	int32 npts)
+{
+	int32	   *neighbors = (int32 *) MemoryContextAllocHuge(CurrentMemoryContext,
+		sizeof(int32) * grid->ncells);
+	int32	   *queue = (int32 *) MemoryContextAllocHuge(CurrentMemoryContext,
+		sizeof(int32) * grid->ncells);
+	int32		nclusters = 0;
+	int			i;
+
+	for (i = 0; i < npts; i++)
+	{
+		int32		nqueue,
+					count,
+					j;
+
+		if (cluster[i] != DBSCAN3D_UNVISITED)
+			continue;
+
+		CHECK_FOR_INTERRUPTS();
+
+		if (dbscan3D_neighbors(grid, i, neighbors) < minpts)
+		{
+			/* May later become a border point of a cluster */
+			cluster[i] = DBSCAN3D_NOISE;
+			continue;
+		}
+
+		/* Expand a new cluster from the core point */
+		cluster[i] = nclusters;
+		nqueue = 0;
+		queue[nqueue++] = i;
+		while (nqueue > 0)
+		{
+			count = dbscan3D_neighbors(grid, queue[--nqueue], neighbors);
+			if (count < minpts)
+				continue;
+			for (j = 0; j < count; j++)
+			{
+				int32		idx = neighbors[j];
+
+				if (cluster[idx] == DBSCAN3D_NOISE)
+					cluster[idx] = nclusters;
+				else if (cluster[idx] == DBSCAN3D_UNVISITED)
+				{
+					cluster[idx] = nclusters;
+					queue[nqueue++] = idx;
+				}
+			}
+		}
+		nclusters++;
+	}
+
+	pfree(neighbors);
+	pfree(queue);
+}
+
+/*
+ * dbscan3D: Window function returning the number of the DBSCAN cluster of
+ * the point of the current row among the points of the partition, or NULL
+ * if it is a noise point. A point is a core point if there are at least
+ * minpts points, including itself, at distance at most eps.
+ */
+Datum
+dbscan3D(PG_FUNCTION_ARGS)
+{
+	WindowObject winobj = PG_WINDOW_OBJECT();
+	Cluster3DContext *context = cluster3D_context(winobj, "dbscan3D");
+	int64		curpos;
+
+	if (!context->computed)
+	{
+		DBSCAN3DGrid grid;
+		bool	   *isnull;
+		bool		epsnull,
+					minptsnull;
+		int32		minpts;
+		int32		npts = (int32) WinGetPartitionRowCount(winobj);
+		int			i;
+
+		grid.eps = DatumGetFloat8(WinGetFuncArgCurrent(winobj, 1, &epsnull));
+		minpts = DatumGetInt32(WinGetFuncArgCurrent(winobj, 2, &minptsnull));
+		if (epsnull || minptsnull)
+			ereport(ERROR,
+					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+					 errmsg("eps and minpts of dbscan3D cannot be NULL")));
+		if (isnan(grid.eps) || grid.eps < 0.0)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("eps of dbscan3D must be a nonnegative number")));
+		if (minpts < 1)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("minpts of dbscan3D must be positive")));
+
+		grid.points = (Point3D *) MemoryContextAllocHuge(CurrentMemoryContext,
+			sizeof(Point3D) * npts);
+		grid.cells = (DBSCAN3DCell *) MemoryContextAllocHuge(CurrentMemoryContext,
+			sizeof(DBSCAN3DCell) * npts);
+		isnull = (bool *) palloc(sizeof(bool) * npts);
+
+		for (i = 0; i < npts; i++)
+		{
+			bool		isout;
+			Datum		d = WinGetFuncArgInPartition(winobj, 0, i,
+				WINDOW_SEEK_HEAD, FALSE, &isnull[i], &isout);
+
+			if (!isnull[i])
+				grid.points[i] = *DatumGetPoint3DP(d);
+			/* Points that are NULL are in no cluster */
+			context->cluster[i] = isnull[i] ? DBSCAN3D_NOISE : DBSCAN3D_UNVISITED;
+		}
+
+		dbscan3D_grid_build(&grid, isnull, npts);
+		dbscan3D_compute(&grid, minpts, context->cluster, npts);
+		context->computed = TRUE;
+
+		pfree(grid.points);
+		pfree(grid.cells);
+		pfree(isnull);
+	}
+
+	curpos = WinGetCurrentPosition(winobj);
+	if (context->cluster[curpos] < 0)
+		PG_RETURN_NULL();
+	PG_RETURN_INT32(context->cluster[curpos]);
+}
+
+PG_FUNCTION_INFO_V1(dbscan3D);
+
+/*****************************************************************************
+ * k-means
+ *
+ * The centers are seeded with k-means++ using a pseudo-random generator
+ * of our own, so that the result only depends on the seed and not on the
+ * platform or the server version. The Lloyd iterations use the bounds of
+ * Hamerly: each point keeps an upper bound of the distance to its center
+ * and a lower bound of the distance to the second closest center, and the
+ * distances to all the centers are only computed for the points whose
+ * bounds no longer guarantee that their center is the closest one. The
+ * iterations stop when no point changes its center or when the centers
+ * barely move, since otherwise a few points on the border between two
+ * clusters may keep the iterations going without changing the result
+ * noticeably.
+ *****************************************************************************/
+
+/* Maximum number of Lloyd iterations */
+#define KMEANS3D_MAXITER		100
+
+/*
+ * The iterations stop when the sum of the squared moves of the centers is
+ * below this fraction of the variance of the points, as in scikit-learn
+ */
+#define KMEANS3D_TOLERANCE		1.0E-04
+
+/* Default seed of the pseudo-random generator */
+#define KMEANS3D_SEED			0
+
+typedef struct
+{
+	Point3D    *points;			/* non-null points of the partition */
+	int32		npts;
+	int32		k;
+	Point3D    *centers;
+	int32	   *assign;			/* center of each point */
+	double	   *upper;			/* upper bound of the distance to the center */
+	double	   *lower;			/* lower bound of the distance to the others */
+	double	   *sumx,			/* sum of the points of each center */
+			   *sumy,
+			   *sumz;
+	int32	   *count;			/* number of points of each center */
+} KMeans3D;
+
+/* SplitMix64 generator */
+static inline uint64
+kmeans3D_random(uint64 *state)
+{
+	uint64		z = (*state += UINT64CONST(0x9E3779B97F4A7C15));
+
+	z = (z ^ (z >> 30)) * UINT64CONST(0xBF58476D1CE4E5B9);
+	z = (z ^ (z >> 27)) * UINT64CONST(0x94D049BB133111EB);
+	return z ^ (z >> 31);
+}
+
+/* Uniform random number in [0, 1) */
+static inline double
+kmeans3D_uniform(uint64 *state)
+{
+	return (double) (kmeans3D_random(state) >> 11) * (1.0 / (double) (UINT64CONST(1) << 53));
+}
+
+static inline double
+kmeans3D_dist2(Point3D *p1, Point3D *p2)
+{
+	double		dx = p1->x - p2->x,
+				dy = p1->y - p2->y,
+				dz = p1->z - p2->z;
+
+	return dx * dx + dy * dy + dz * dz;
+}
+
+/*
+ * Choose the initial centers with k-means++: each new center is a point
+ * drawn with probability proportional to the square of its distance to the
+ * closest center already chosen
+ */
+static void
+kmeans3D_seed(KMeans3D *km, uint64 seed)
+{
+	double	   *dist2 = (double *) MemoryContextAllocHuge(CurrentMemoryContext,
+		sizeof(double) * km->npts);
+	uint64		state = seed;
+	double		sum = 0.0;
+	int32		i,
+				j;
+
+	i = (int32) (kmeans3D_uniform(&state) * km->npts);
+	km->centers[0] = km->points[Min(i, km->npts - 1)];
+	for (i = 0; i < km->npts; i++)
+	{
+		dist2[i] = kmeans3D_dist2(&km->points[i], &km->centers[0]);
+		sum += dist2[i];
+	}
+
+	for (j = 1; j < km->k; j++)
+	{
+		double		target = kmeans3D_uniform(&state) * sum,
+					cumul = 0.0;
+		int32		chosen = -1;
+
+		CHECK_FOR_INTERRUPTS();
+
+		for (i = 0; i < km->npts; i++)
+		{
+			if (dist2[i] <= 0.0)
+				continue;
+			chosen = i;
+			cumul += dist2[i];
+			if (cumul > target)
+				break;
+		}
+		/* All the points coincide with a center: take any of them */
+		if (chosen < 0)
+			chosen = (int32) (kmeans3D_uniform(&state) * km->npts);
+		km->centers[j] = km->points[Min(chosen, km->npts - 1)];
+
+		sum = 0.0;
+		for (i = 0; i < km->npts; i++)
+		{
+			double		d2 = kmeans3D_dist2(&km->points[i], &km->centers[j]);
+
+			if (d2 < dist2[i])
+				dist2[i] = d2;
+			sum += dist2[i];
+		}
+	}
+
+	pfree(dist2);
+}
+
+/*
+ * Find the closest center of the i-th point and set its bounds to the
+ * distances to the closest and the second closest center
+ */
+static int32
+kmeans3D_nearest(KMeans3D *km, int32 i)
+{
+	double		best = DBL_MAX,
+				second = DBL_MAX;
+	int32		result = 0,
+				j;
+
+	for (j = 0; j < km->k; j++)
+	{
+		double		d2 = kmeans3D_dist2(&km->points[i], &km->centers[j]);
+
+		if (d2 < best)
+		{
+			second = best;
+			best = d2;
+			result = j;
+		}
+		else if (d2 < second)
+			second = d2;
+	}
+	km->upper[i] = sqrt(best);
+	km->lower[i] = sqrt(second);
+	return result;
+}
+
+static inline void
+kmeans3D_add(KMeans3D *km, int32 i, int32 center, int32 sign)
+{
+	km->sumx[center] += sign * km->points[i].x;
+	km->sumy[center] += sign * km->points[i].y;
+	km->sumz[center] += sign * km->points[i].z;
+	km->count[center] += sign;
+}
+
+/*
+ * Sum of the variances of the coordinates of the points
+ */
+static double
+kmeans3D_variance(KMeans3D *km)
+{
+	Point3D		mean = {0.0, 0.0, 0.0};
+	double		result = 0.0;
+	int32		i;
+
+	for (i = 0; i < km->npts; i++)
+	{
+		mean.x += km->points[i].x;
+		mean.y += km->points[i].y;
+		mean.z += km->points[i].z;
+	}
+	mean.x /= km->npts;
+	mean.y /= km->npts;
+	mean.z /= km->npts;
+	for (i = 0; i < km->npts; i++)
+		result += kmeans3D_dist2(&km->points[i], &mean);
+	return result / km->npts;
+}
+
+/*
+ * Run the Lloyd iterations until the assignment of the points is stable
+ */
+static void
+kmeans3D_compute(KMeans3D *km)
+{
+	double	   *moved = (double *) palloc(sizeof(double) * km->k);
+	double	   *half = (double *) palloc(sizeof(double) * km->k);
+	double		tolerance = KMEANS3D_TOLERANCE * kmeans3D_variance(km);
+	int32		i,
+				j,
+				iter;
+
+	for (i = 0; i < km->npts; i++)
+	{
+		km->assign[i] = kmeans3D_nearest(km, i);
+		kmeans3D_add(km, i, km->assign[i], 1);
+	}
+
+	for (iter = 0; iter < KMEANS3D_MAXITER; iter++)
+	{
+		double		maxmove = 0.0,
+					secondmove = 0.0,
+					sumsqmove = 0.0;
+		int32		maxcenter = -1,
+					changed = 0;
+
+		CHECK_FOR_INTERRUPTS();
+
+		/* Move the centers to the mean of their points */
+		for (j = 0; j < km->k; j++)
+		{
+			Point3D		center;
+
+			moved[j] = 0.0;
+			if (km->count[j] == 0)
+				continue;
+			center.x = km->sumx[j] / km->count[j];
+			center.y = km->sumy[j] / km->count[j];
+			center.z = km->sumz[j] / km->count[j];
+			moved[j] = sqrt(kmeans3D_dist2(&center, &km->centers[j]));
+			km->centers[j] = center;
+			sumsqmove += moved[j] * moved[j];
+			if (moved[j] > maxmove)
+			{
+				secondmove = maxmove;
+				maxmove = moved[j];
+				maxcenter = j;
+			}
+			else if (moved[j] > secondmove)
+				secondmove = moved[j];
+		}
+		if (maxmove == 0.0 || sumsqmove <= tolerance)
+			break;
+
+		/* Half the distance of each center to the closest other center */
+		for (j = 0; j < km->k; j++)
+		{
+			int32		l;
+
+			half[j] = DBL_MAX;
+			for (l = 0; l < km->k; l++)
+			{
+				if (l != j)
+					half[j] = Min(half[j],
+						0.5 * sqrt(kmeans3D_dist2(&km->centers[j], &km->centers[l])));
+			}
+		}
+
+		for (i = 0; i < km->npts; i++)
+		{
+			int32		a = km->assign[i],
+						b;
+			double		bound;
+
+			km->upper[i] += moved[a];
+			km->lower[i] -= (a == maxcenter) ? secondmove : maxmove;
+
+			bound = Max(half[a], km->lower[i]);
+			if (km->upper[i] <= bound)
+				continue;
+			km->upper[i] = sqrt(kmeans3D_dist2(&km->points[i], &km->centers[a]));
+			if (km->upper[i] <= bound)
+				continue;
+
+			b = kmeans3D_nearest(km, i);
+			if (b != a)
+			{
+				kmeans3D_add(km, i, a, -1);
+				kmeans3D_add(km, i, b, 1);
+				km->assign[i] = b;
+				changed++;
+			}
+		}
+		if (changed == 0)
+			break;
+	}
+
+	pfree(moved);
+	pfree(half);
+}
+
+/*
+ * kmeans3D: Window function returning the number of the k-means cluster of
+ * the point of the current row among the points of the partition, or NULL
+ * if the point is NULL. The clusters are numbered from 0 in the order of
+ * their first point in the partition. When there are fewer than k points,
+ * each point is in a cluster of its own.
+ */
+Datum
+kmeans3D(PG_FUNCTION_ARGS)
+{
+	WindowObject winobj = PG_WINDOW_OBJECT();
+	Cluster3DContext *context = cluster3D_context(winobj, "kmeans3D");
+	int64		curpos;
+
+	if (!context->computed)
+	{
+		KMeans3D	km;
+		int32		rowcount = (int32) WinGetPartitionRowCount(winobj);
+		int32	   *rows;
+		int32	   *renumber;
+		int32		nclusters = 0;
+		bool		knull,
+					seednull = FALSE;
+		int32		k;
+		uint64		seed = KMEANS3D_SEED;
+		int32		i;
+
+		k = DatumGetInt32(WinGetFuncArgCurrent(winobj, 1, &knull));
+		if (PG_NARGS() > 2)
+			seed = (uint64) DatumGetInt64(WinGetFuncArgCurrent(winobj, 2, &seednull));
+		if (knull || seednull)
+			ereport(ERROR,
+					(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+					 errmsg("k and seed of kmeans3D cannot be NULL")));
+		if (k < 1)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("k of kmeans3D must be positive")));
+
+		km.points = (Point3D *) MemoryContextAllocHuge(CurrentMemoryContext,
+			sizeof(Point3D) * rowcount);
+		rows = (int32 *) MemoryContextAllocHuge(CurrentMemoryContext,
+			sizeof(int32) * rowcount);
+		km.npts = 0;
+		for (i = 0; i < rowcount; i++)
+		{
+			bool		isnull,
+						isout;
+			Datum		d = WinGetFuncArgInPartition(winobj, 0, i,
+				WINDOW_SEEK_HEAD, FALSE, &isnull, &isout);
+
+			context->cluster[i] = -1;
+			if (isnull)
+				continue;
+			km.points[km.npts] = *DatumGetPoint3DP(d);
+			rows[km.npts++] = i;
+		}
+
+		if (km.npts > 0)
+		{
+			km.k = Min(k, km.npts);
+			km.centers = (Point3D *) palloc(sizeof(Point3D) * km.k);
+			km.assign = (int32 *) MemoryContextAllocHuge(CurrentMemoryContext,
+				sizeof(int32) * km.npts);
+			km.upper = (double *) MemoryContextAllocHuge(CurrentMemoryContext,
+				sizeof(double) * km.npts);
+			km.lower = (double *) MemoryContextAllocHuge(CurrentMemoryContext,
+				sizeof(double) * km.npts);
+			km.sumx = (double *) palloc0(sizeof(double) * km.k);
+			km.sumy = (double *) palloc0(sizeof(double) * km.k);
+			km.sumz = (double *) palloc0(sizeof(double) * km.k);
+			km.count = (int32 *) palloc0(sizeof(int32) * km.k);
+
+			kmeans3D_seed(&km, seed);
+			kmeans3D_compute(&km);
+
+			/* Number the clusters in the order of the rows */
+			renumber = (int32 *) palloc(sizeof(int32) * km.k);
+			for (i = 0; i < km.k; i++)
+				renumber[i] = -1;
+			for (i = 0; i < km.npts; i++)
+			{
+				int32		a = km.assign[i];
+
+				if (renumber[a] < 0)
+					renumber[a] = nclusters++;
+				context->cluster[rows[i]] = renumber[a];
+			}
+
+			pfree(renumber);
+			pfree(km.centers);
+			pfree(km.assign);
+			pfree(km.upper);
+			pfree(km.lower);
+			pfree(km.sumx);
+			pfree(km.sumy);
+			pfree(km.sumz);
+			pfree(km.count);
+		}
+		context->computed = TRUE;
+
+		pfree(km.points);
+		pfree(rows);
+	}
+
+	curpos = WinGetCurrentPosition(winobj);
+	if (context->cluster[curpos] < 0)
+		PG_RETURN_NULL();
+	PG_RETURN_INT32(context->cluster[curpos]);
+}
+
+PG_FUNCTION_INFO_V1(kmeans3D);
+
+/*****************************************************************************/
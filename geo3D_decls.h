@@ -17,6 +17,9 @@
 #include <math.h>
 
 #include <fmgr.h>
+#include <lib/stringinfo.h>
+#include <storage/itemptr.h>
+#include <utils/expandeddatum.h>
 
 /*--------------------------------------------------------------------
  * Useful floating point utilities and constants.
@@ -51,6 +54,157 @@
 
 #define DOT(u,v)   ((u).x * (v).x + (u).y * (v).y + (u).z * (v).z)
 
+/*
+ * Reverse the byte order of a 64-bit value. Written with shifts so that the
+ * compiler turns loops over coordinates into vector byte swaps.
+ */
+static inline uint64
+geo3D_bswap64(uint64 x)
+{
+	return ((x << 56) & UINT64CONST(0xff00000000000000)) |
+		((x << 40) & UINT64CONST(0x00ff000000000000)) |
+		((x << 24) & UINT64CONST(0x0000ff0000000000)) |
+		((x << 8) & UINT64CONST(0x000000ff00000000)) |
+		((x >> 8) & UINT64CONST(0x00000000ff000000)) |
+		((x >> 24) & UINT64CONST(0x0000000000ff0000)) |
+		((x >> 40) & UINT64CONST(0x000000000000ff00)) |
+		((x >> 56) & UINT64CONST(0x00000000000000ff));
+}
+
+/*--------------------------------------------------------------------
+ * Morton codes interleaving the bits of three cell numbers of
+ * MORTON3D_BITS bits each, the bits of x being the lowest ones
+ *-------------------------------------------------------------------*/
+
+#define MORTON3D_BITS			21
+#define MORTON3D_MAXCELL		((1 << MORTON3D_BITS) - 1)
+
+/*
+ * Spread the lowest MORTON3D_BITS bits of v so that there are two zero
+ * bits between each of them
+ */
+static inline uint64
+morton3D_spread(uint32 v)
+{
+	uint64		x = v & MORTON3D_MAXCELL;
+
+	x = (x | x << 32) & UINT64CONST(0x001f00000000ffff);
+	x = (x | x << 16) & UINT64CONST(0x001f0000ff0000ff);
+	x = (x | x << 8) & UINT64CONST(0x100f00f00f00f00f);
+	x = (x | x << 4) & UINT64CONST(0x10c30c30c30c30c3);
+	x = (x | x << 2) & UINT64CONST(0x1249249249249249);
+	return x;
+}
+
+/* Inverse of morton3D_spread */
+static inline uint32
+morton3D_compact(uint64 x)
+{
+	x &= UINT64CONST(0x1249249249249249);
+	x = (x | x >> 2) & UINT64CONST(0x10c30c30c30c30c3);
+	x = (x | x >> 4) & UINT64CONST(0x100f00f00f00f00f);
+	x = (x | x >> 8) & UINT64CONST(0x001f0000ff0000ff);
+	x = (x | x >> 16) & UINT64CONST(0x001f00000000ffff);
+	x = (x | x >> 32) & MORTON3D_MAXCELL;
+	return (uint32) x;
+}
+
+static inline uint64
+morton3D_encode(uint32 x, uint32 y, uint32 z)
+{
+	return morton3D_spread(x) | morton3D_spread(y) << 1 | morton3D_spread(z) << 2;
+}
+
+static inline void
+morton3D_decode(uint64 code, uint32 *x, uint32 *y, uint32 *z)
+{
+	*x = morton3D_compact(code);
+	*y = morton3D_compact(code >> 1);
+	*z = morton3D_compact(code >> 2);
+}
+
+/*
+ * Hilbert code of the cell, computed with the transform of J. Skilling,
+ * "Programming the Hilbert curve", AIP Conference Proceedings 707, 2004,
+ * which turns the cell numbers into the transpose of the code, whose bits
+ * are then interleaved as in a Morton code. Consecutive codes are those of
+ * neighbouring cells.
+ */
+static inline uint64
+hilbert3D_encode(uint32 x, uint32 y, uint32 z)
+{
+	uint32		X[3],
+				P,
+				Q,
+				t;
+	int			i;
+
+	X[0] = x & MORTON3D_MAXCELL;
+	X[1] = y & MORTON3D_MAXCELL;
+	X[2] = z & MORTON3D_MAXCELL;
+	for (Q = 1 << (MORTON3D_BITS - 1); Q > 1; Q >>= 1)
+	{
+		P = Q - 1;
+		for (i = 0; i < 3; i++)
+		{
+			if (X[i] & Q)
+				X[0] ^= P;
+			else
+			{
+				t = (X[0] ^ X[i]) & P;
+				X[0] ^= t;
+				X[i] ^= t;
+			}
+		}
+	}
+	X[1] ^= X[0];
+	X[2] ^= X[1];
+	t = 0;
+	for (Q = 1 << (MORTON3D_BITS - 1); Q > 1; Q >>= 1)
+	{
+		if (X[2] & Q)
+			t ^= Q - 1;
+	}
+	for (i = 0; i < 3; i++)
+		X[i] ^= t;
+	return morton3D_encode(X[2], X[1], X[0]);
+}
+
+/* Inverse of hilbert3D_encode */
+static inline void
+hilbert3D_decode(uint64 code, uint32 *x, uint32 *y, uint32 *z)
+{
+	uint32		X[3],
+				P,
+				Q,
+				t;
+	int			i;
+
+	morton3D_decode(code, &X[2], &X[1], &X[0]);
+	t = X[2] >> 1;
+	X[2] ^= X[1];
+	X[1] ^= X[0];
+	X[0] ^= t;
+	for (Q = 2; Q != (uint32) 1 << MORTON3D_BITS; Q <<= 1)
+	{
+		P = Q - 1;
+		for (i = 2; i >= 0; i--)
+		{
+			if (X[i] & Q)
+				X[0] ^= P;
+			else
+			{
+				t = (X[0] ^ X[i]) & P;
+				X[0] ^= t;
+				X[i] ^= t;
+			}
+		}
+	}
+	*x = X[0];
+	*y = X[1];
+	*z = X[2];
+}
+
 /*--------------------------------------------------------------------
  * Additional strategy numbers for GIST and SP-GIST with respect 
  * to those defined in the file stratnum.h
@@ -60,6 +214,7 @@
 #define RTFrontStrategyNumber			29		/* for <</ */
 #define RTBackStrategyNumber			30		/* for />> */
 #define RTOverBackStrategyNumber		31		/* for &/>> */
+#define RTIntersectStrategyNumber		32		/* for ?# */
 
 #define Geo3DStrategyNumberOffset		40
 #define Point3DStrategyNumberGroup		0
@@ -144,6 +299,39 @@ typedef struct
 	Point3D		p[FLEXIBLE_ARRAY_MEMBER];
 } Polygon3D;
 
+/*---------------------------------------------------------------------
+ * Point3DBuilder: A Path3D or Polygon3D under construction whose
+ * points are appended to a geometrically growing buffer, keeping
+ * the bounding box up to date
+ *-------------------------------------------------------------------*/
+typedef struct
+{
+	char	   *data;			/* Path3D or Polygon3D being built */
+	Size		hdrsize;		/* offset of the points in data */
+	int32		npts;
+	int32		maxpts;			/* number of points allocated */
+	Box3D		boundbox;
+} Point3DBuilder;
+
+#define POINT3D_BUILDER_POINTS(b)	((Point3D *) ((b)->data + (b)->hdrsize))
+
+/*---------------------------------------------------------------------
+ * ExpandedPoint3D: Expanded in-memory form of a Path3D or Polygon3D,
+ * which can be edited in place, e.g., in a PL/pgSQL variable, and is
+ * only flattened when the value is stored
+ *-------------------------------------------------------------------*/
+#define EXPANDED_POINT3D_MAGIC	0x2A3D3D50
+
+typedef struct
+{
+	ExpandedObjectHeader hdr;	/* standard header of expanded objects */
+	int			magic;			/* EXPANDED_POINT3D_MAGIC */
+	bool		ispoly;			/* Polygon3D rather than Path3D? */
+	bool		closed;			/* is this a closed path? */
+	bool		bbox_valid;		/* is builder.boundbox up to date? */
+	Point3DBuilder builder;		/* points and bounding box */
+} ExpandedPoint3D;
+
 /*---------------------------------------------------------------------
  * Sphere: A sphere specified by a center point and a radius
  *-------------------------------------------------------------------*/
@@ -153,6 +341,203 @@ typedef struct
 	double		radius;
 } Sphere;
 
+/*---------------------------------------------------------------------
+ * Point3DF, Box3DF, Path3DF: Single-precision counterparts of Point3D,
+ * Box3D, and Path3D for massive point data (e.g., lidar) that is float4
+ * at source. They halve the storage size of their double-precision
+ * counterparts and share their operators, which widen the arguments to
+ * double precision and call the same kernels.
+ *-------------------------------------------------------------------*/
+typedef struct
+{
+	float4		x,
+				y,
+				z;
+} Point3DF;
+
+typedef struct
+{
+	Point3DF	high,
+				low;			/* corner points */
+} Box3DF;
+
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	int32		npts;
+	int32		closed;			/* is this a closed polygon? */
+	Box3DF		boundbox;
+	Point3DF	p[FLEXIBLE_ARRAY_MEMBER];
+} Path3DF;
+
+/*---------------------------------------------------------------------
+ * PointPatch3D: A patch of up to POINTPATCH3D_MAXPTS points stored in a
+ * single value together with their bounding box, which avoids paying a
+ * tuple header per point for point clouds. The points are stored either
+ * as an array of Point3D or, if the patch is quantized, as the offsets
+ * of the points from the low corner of the bounding box in multiples of
+ * scale, delta-encoded from one point to the next as zigzag varints.
+ *-------------------------------------------------------------------*/
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	int32		npts;
+	int32		flags;
+	int32		dummy;			/* padding to make it double align */
+	double		scale;			/* quantum of quantized patches, 0 otherwise */
+	Box3D		boundbox;
+	char		data[FLEXIBLE_ARRAY_MEMBER];
+} PointPatch3D;
+
+#define POINTPATCH3D_QUANTIZED	0x01
+
+#define POINTPATCH3D_MAXPTS		16384
+
+/* Size of the header of a PointPatch3D, i.e., what the GiST index needs */
+#define POINTPATCH3D_HDRSZ		offsetof(PointPatch3D, data)
+
+/*---------------------------------------------------------------------
+ * VoxelSet3D: A sparse set of voxels of a regular grid with the number
+ * of points in each of them. The grid is given by the size of its cubic
+ * voxels and the low corner of its voxel (0,0,0). A voxel is identified
+ * by the Morton code of its cell numbers offset by VOXELSET3D_OFFSET.
+ * The keys of the voxels are sorted in increasing order and followed by
+ * their counts.
+ *-------------------------------------------------------------------*/
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	int32		nvoxels;
+	double		size;			/* edge length of the voxels */
+	Point3D		origin;			/* low corner of the voxel (0,0,0) */
+	uint64		data[FLEXIBLE_ARRAY_MEMBER];	/* keys, then counts */
+} VoxelSet3D;
+
+/* Cell numbers range from -VOXELSET3D_OFFSET to VOXELSET3D_OFFSET - 1 */
+#define VOXELSET3D_OFFSET		(1 << (MORTON3D_BITS - 1))
+
+#define VOXELSET3D_KEYS(v)		((v)->data)
+#define VOXELSET3D_COUNTS(v)	((int64 *) ((v)->data + (v)->nvoxels))
+#define VOXELSET3D_SIZE(n)		(offsetof(VoxelSet3D, data) + 2 * sizeof(uint64) * (n))
+
+/*---------------------------------------------------------------------
+ * VoxelCell3D: A voxel of a grid of cubic voxels whose voxel (0,0,0) has
+ * its low corner at the origin, identified by its key as in a VoxelSet3D.
+ * The size of the voxels is not part of the value, so that the cells of
+ * two values only compare meaningfully if they come from the same grid.
+ *-------------------------------------------------------------------*/
+typedef struct
+{
+	uint64		key;
+} VoxelCell3D;
+
+/*---------------------------------------------------------------------
+ * OctCell3D: A cell of the octree of the grid of a VoxelCell3D, whose
+ * root at level 0 is the whole grid and whose cells at level
+ * OCTCELL3D_MAXLEVEL are its voxels. The identifier of a cell of level l
+ * is the Morton code of its low voxel shifted left by one bit, plus the
+ * bit 3 * (OCTCELL3D_MAXLEVEL - l). The identifiers of the descendants of
+ * a cell are then the range of identifiers around it that are within this
+ * lowest bit, so that the hierarchy is answered with integer arithmetic.
+ *-------------------------------------------------------------------*/
+typedef struct
+{
+	uint64		id;
+} OctCell3D;
+
+#define OCTCELL3D_MAXLEVEL		MORTON3D_BITS
+
+/* Lowest bit of the identifiers of the cells of the level */
+static inline uint64
+octcell3D_lsb_for_level(int level)
+{
+	return (uint64) 1 << (3 * (OCTCELL3D_MAXLEVEL - level));
+}
+
+static inline uint64
+octcell3D_lsb(uint64 id)
+{
+	return id & (~id + 1);
+}
+
+static inline int
+octcell3D_id_level(uint64 id)
+{
+	int			level = OCTCELL3D_MAXLEVEL;
+
+	while (level > 0 && (id & (((uint64) 8 << (3 * (OCTCELL3D_MAXLEVEL - level))) - 1)) == 0)
+		level--;
+	return level;
+}
+
+/* Range of the identifiers of the cell and its descendants */
+static inline uint64
+octcell3D_range_min(uint64 id)
+{
+	return id - (octcell3D_lsb(id) - 1);
+}
+
+static inline uint64
+octcell3D_range_max(uint64 id)
+{
+	return id + (octcell3D_lsb(id) - 1);
+}
+
+/* Ancestor of the cell at the level, which is at most its own level */
+static inline uint64
+octcell3D_id_parent(uint64 id, int level)
+{
+	uint64		lsb = octcell3D_lsb_for_level(level);
+
+	return (id & (~lsb + 1)) | lsb;
+}
+
+/*---------------------------------------------------------------------
+ * SpatialJoin3D: Partition based spatial join of two inputs. The objects
+ * of both inputs are added with their bounding box, and the candidate
+ * pairs, whose boxes intersect, are passed to the emit function, which
+ * evaluates the join predicate on the values of the objects.
+ *-------------------------------------------------------------------*/
+typedef struct SpatialJoin3D SpatialJoin3D;
+
+/*
+ * An object of an input copied into a partition: its bounding box, its
+ * ctid if any, and its value, which follows the header at a MAXALIGN'd
+ * offset
+ */
+typedef struct
+{
+	Box3D		box;
+	ItemPointerData tid;
+	int32		len;			/* length of the value */
+} SpatialJoin3DEntry;
+
+#define SPATIALJOIN3D_HDRSZ			MAXALIGN(sizeof(SpatialJoin3DEntry))
+#define SPATIALJOIN3D_ENTRYSZ(len)	MAXALIGN(SPATIALJOIN3D_HDRSZ + (len))
+#define SPATIALJOIN3D_VALUE(e)		((char *) (e) + SPATIALJOIN3D_HDRSZ)
+
+/* Statistics of an input used to size the grid of the join */
+typedef struct
+{
+	int64		count;
+	Box3D		extent;
+	double		avgdim[3];		/* average width, height, and depth */
+	double		avgsize;		/* average size of the values */
+} SpatialJoin3DStats;
+
+/* Counters reported by EXPLAIN ANALYZE */
+typedef struct
+{
+	int32		nparts;
+	int64		ntiles;
+	int64		nentries;		/* objects copied into the partitions */
+	int32		nfiles;			/* partitions spilled to disk */
+	int64		ncandidates;	/* pairs passed to the emit function */
+} SpatialJoin3DInstr;
+
+typedef void (*SpatialJoin3DEmit) (void *arg, SpatialJoin3DEntry *r,
+	SpatialJoin3DEntry *s);
+
 /*---------------------------------------------------------------------
  * fmgr interface macros
  *
@@ -199,11 +584,57 @@ typedef struct
 #define PG_GETARG_SPHERE_P(n) DatumGetSphereP(PG_GETARG_DATUM(n))
 #define PG_RETURN_SPHERE_P(x) return SpherePGetDatum(x)
 
+#define DatumGetPoint3DFP(X)	 ((Point3DF *) DatumGetPointer(X))
+#define Point3DFPGetDatum(X)	 PointerGetDatum(X)
+#define PG_GETARG_POINT3DF_P(n) DatumGetPoint3DFP(PG_GETARG_DATUM(n))
+#define PG_RETURN_POINT3DF_P(x) return Point3DFPGetDatum(x)
+
+#define DatumGetBox3DFP(X)    ((Box3DF *) DatumGetPointer(X))
+#define Box3DFPGetDatum(X)    PointerGetDatum(X)
+#define PG_GETARG_BOX3DF_P(n) DatumGetBox3DFP(PG_GETARG_DATUM(n))
+#define PG_RETURN_BOX3DF_P(x) return Box3DFPGetDatum(x)
+
+#define DatumGetPath3DFP(X)				((Path3DF *) PG_DETOAST_DATUM(X))
+#define DatumGetPath3DFPCopy(X)			((Path3DF *) PG_DETOAST_DATUM_COPY(X))
+#define Path3DFPGetDatum(X)				PointerGetDatum(X)
+#define PG_GETARG_PATH3DF_P(n)			DatumGetPath3DFP(PG_GETARG_DATUM(n))
+#define PG_GETARG_PATH3DF_P_COPY(n)		DatumGetPath3DFPCopy(PG_GETARG_DATUM(n))
+#define PG_RETURN_PATH3DF_P(x)			return Path3DFPGetDatum(x)
+
+#define DatumGetPointPatch3DP(X)		((PointPatch3D *) PG_DETOAST_DATUM(X))
+#define DatumGetPointPatch3DPHeader(X)	((PointPatch3D *) PG_DETOAST_DATUM_SLICE(X, 0, POINTPATCH3D_HDRSZ))
+#define PointPatch3DPGetDatum(X)		PointerGetDatum(X)
+#define PG_GETARG_POINTPATCH3D_P(n)		DatumGetPointPatch3DP(PG_GETARG_DATUM(n))
+#define PG_GETARG_POINTPATCH3D_HEADER(n)	DatumGetPointPatch3DPHeader(PG_GETARG_DATUM(n))
+#define PG_RETURN_POINTPATCH3D_P(x)		return PointPatch3DPGetDatum(x)
+
+#define DatumGetVoxelSet3DP(X)			((VoxelSet3D *) PG_DETOAST_DATUM(X))
+#define VoxelSet3DPGetDatum(X)			PointerGetDatum(X)
+#define DatumGetVoxelSet3DPCopy(X)		((VoxelSet3D *) PG_DETOAST_DATUM_COPY(X))
+#define PG_GETARG_VOXELSET3D_P(n)		DatumGetVoxelSet3DP(PG_GETARG_DATUM(n))
+#define PG_GETARG_VOXELSET3D_P_COPY(n)	DatumGetVoxelSet3DPCopy(PG_GETARG_DATUM(n))
+#define PG_RETURN_VOXELSET3D_P(x)		return VoxelSet3DPGetDatum(x)
+
+#define DatumGetVoxelCell3DP(X)			((VoxelCell3D *) DatumGetPointer(X))
+#define VoxelCell3DPGetDatum(X)			PointerGetDatum(X)
+#define PG_GETARG_VOXELCELL3D_P(n)		DatumGetVoxelCell3DP(PG_GETARG_DATUM(n))
+#define PG_RETURN_VOXELCELL3D_P(x)		return VoxelCell3DPGetDatum(x)
+
+#define DatumGetOctCell3DP(X)			((OctCell3D *) DatumGetPointer(X))
+#define OctCell3DPGetDatum(X)			PointerGetDatum(X)
+#define PG_GETARG_OCTCELL3D_P(n)		DatumGetOctCell3DP(PG_GETARG_DATUM(n))
+#define PG_RETURN_OCTCELL3D_P(x)		return OctCell3DPGetDatum(x)
+
 /*---------------------------------------------------------------------
  * Oid lookups
  *-------------------------------------------------------------------*/
 
 Oid point3d_oid() ;
+Oid box3d_oid() ;
+Oid path3d_oid() ;
+Oid poly3d_oid() ;
+Oid pointpatch3d_oid() ;
+Oid octcell3d_oid() ;
 
 /*****************************************************************************
  * Generic routines
@@ -220,6 +651,10 @@ extern double pg_hypot(double x, double y);
 extern double pg_hypot3D(double x, double y, double z);
 
 extern bool plist_test3noncollinearpts(Point3D  *plist, int npts);
+extern int single_decode(char *str, double *x, char **s);
+extern void single_encode(double x, StringInfo str);
+extern int triple_decode(char *str, double *x, double *y, double *z, char **s);
+extern void triple_encode(double x, double y, double z, StringInfo str);
 extern bool plist_find3noncollinearpts(Point3D  *plist, int npts, int *pos1, int *pos2, int *pos3);
 
 /*****************************************************************************
@@ -256,14 +691,18 @@ extern Datum point3D_div(PG_FUNCTION_ARGS);
 
 extern Datum point3D_same(PG_FUNCTION_ARGS);
 extern Datum point3D_cmp(PG_FUNCTION_ARGS);
+extern Datum point3D_sortsupport(PG_FUNCTION_ARGS);
 extern Datum point3D_lt(PG_FUNCTION_ARGS);
 extern Datum point3D_le(PG_FUNCTION_ARGS);
 extern Datum point3D_eq(PG_FUNCTION_ARGS);
 extern Datum point3D_ne(PG_FUNCTION_ARGS);
 extern Datum point3D_ge(PG_FUNCTION_ARGS);
+extern Datum point3D_exact_eq(PG_FUNCTION_ARGS);
+extern Datum point3D_hash(PG_FUNCTION_ARGS);
 extern Datum point3D_gt(PG_FUNCTION_ARGS);
 
 extern bool point3D_same_internal(Point3D* point1, Point3D* point2);
+extern int point3D_cmp_internal(Point3D* point1, Point3D* point2);
 
 /*****************************************************************************
  * Lseg3D routines
@@ -303,6 +742,7 @@ extern Line3D *lseg3D_line3D_internal(Lseg3D *lseg);
 
 extern Datum lseg3D_same(PG_FUNCTION_ARGS);
 extern Datum lseg3D_cmp(PG_FUNCTION_ARGS);
+extern Datum lseg3D_sortsupport(PG_FUNCTION_ARGS);
 extern Datum lseg3D_lt(PG_FUNCTION_ARGS);
 extern Datum lseg3D_le(PG_FUNCTION_ARGS);
 extern Datum lseg3D_eq(PG_FUNCTION_ARGS);
@@ -380,14 +820,18 @@ extern Sphere *box3D_bsphere(Box3D *box);
 
 extern Datum box3D_same(PG_FUNCTION_ARGS);
 extern Datum box3D_cmp(PG_FUNCTION_ARGS);
+extern Datum box3D_sortsupport(PG_FUNCTION_ARGS);
 extern Datum box3D_lt(PG_FUNCTION_ARGS);
 extern Datum box3D_le(PG_FUNCTION_ARGS);
 extern Datum box3D_eq(PG_FUNCTION_ARGS);
 extern Datum box3D_ne(PG_FUNCTION_ARGS);
 extern Datum box3D_ge(PG_FUNCTION_ARGS);
+extern Datum box3D_exact_eq(PG_FUNCTION_ARGS);
+extern Datum box3D_hash(PG_FUNCTION_ARGS);
 extern Datum box3D_gt(PG_FUNCTION_ARGS);
 
 extern bool box3D_same_internal(Box3D *box1, Box3D *box2);
+extern int box3D_cmp_internal(Box3D *box1, Box3D *box2);
 
 extern Datum box3D_add(PG_FUNCTION_ARGS);
 extern Datum box3D_sub(PG_FUNCTION_ARGS);
@@ -404,8 +848,16 @@ extern Datum path3D_out(PG_FUNCTION_ARGS);
 extern Datum path3D_recv(PG_FUNCTION_ARGS);
 extern Datum path3D_send(PG_FUNCTION_ARGS);
 
+extern void point3D_array_recv(StringInfo buf, Point3D *points, int32 npts, Box3D *box);
+extern void point3D_array_send(StringInfo buf, Point3D *points, int32 npts);
+extern void path3D_make_bbox(Path3D *path);
 extern Path3D *path3D_copy(Path3D *path);
 
+extern void point3D_builder_init(Point3DBuilder *builder, Size hdrsize, int32 maxpts);
+extern void point3D_builder_append(Point3DBuilder *builder, Point3D *points, int32 npts, Box3D *box);
+extern Path3D *path3D_builder_finish(Point3DBuilder *builder, bool closed);
+extern Polygon3D *poly3D_builder_finish(Point3DBuilder *builder);
+
 extern Datum path3D_npoints(PG_FUNCTION_ARGS);
 extern Datum path3D_points(PG_FUNCTION_ARGS);
 extern Datum path3D_center(PG_FUNCTION_ARGS);
@@ -434,6 +886,7 @@ extern Datum path3D_gt(PG_FUNCTION_ARGS);
 extern Datum path3D_ge(PG_FUNCTION_ARGS);
 
 extern bool path3D_same_internal(Path3D *path1, Path3D *path2);
+extern int path3D_cmp_internal(Path3D *path1, Path3D *path2);
 
 extern Datum path3D_concat(PG_FUNCTION_ARGS);
 extern Datum path3D_add(PG_FUNCTION_ARGS);
@@ -505,12 +958,15 @@ extern Box3D *sphere_bbox(Sphere *sphere);
 
 extern Datum sphere_same(PG_FUNCTION_ARGS);
 extern Datum sphere_cmp(PG_FUNCTION_ARGS);
+extern Datum sphere_sortsupport(PG_FUNCTION_ARGS);
 extern Datum sphere_eq(PG_FUNCTION_ARGS);
 extern Datum sphere_ne(PG_FUNCTION_ARGS);
 extern Datum sphere_lt(PG_FUNCTION_ARGS);
 extern Datum sphere_gt(PG_FUNCTION_ARGS);
 extern Datum sphere_le(PG_FUNCTION_ARGS);
 extern Datum sphere_ge(PG_FUNCTION_ARGS);
+extern Datum sphere_exact_eq(PG_FUNCTION_ARGS);
+extern Datum sphere_hash(PG_FUNCTION_ARGS);
 
 extern bool sphere_same_internal(Sphere *sphere1, Sphere *sphere2);
 
@@ -2236,6 +2692,66 @@ extern double dist_sphere_path3D(Sphere *sphere, Path3D *path);
 extern double dist_sphere_poly3D(Sphere *sphere, Polygon3D *poly2);
 extern double dist_sphere_sphere(Sphere *sphere1, Sphere *sphere2);
 
+/*****************************************************************************
+ *	Within distance functions
+ *****************************************************************************/
+
+extern Datum dwithin_point3D_point3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_point3D_lseg3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_point3D_line3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_point3D_box3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_point3D_path3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_point3D_poly3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_point3D_sphere(PG_FUNCTION_ARGS);
+
+extern Datum dwithin_lseg3D_point3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_lseg3D_lseg3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_lseg3D_line3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_lseg3D_box3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_lseg3D_path3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_lseg3D_poly3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_lseg3D_sphere(PG_FUNCTION_ARGS);
+
+extern Datum dwithin_line3D_point3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_line3D_lseg3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_line3D_line3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_line3D_box3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_line3D_path3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_line3D_poly3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_line3D_sphere(PG_FUNCTION_ARGS);
+
+extern Datum dwithin_box3D_point3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_box3D_lseg3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_box3D_line3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_box3D_box3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_box3D_path3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_box3D_poly3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_box3D_sphere(PG_FUNCTION_ARGS);
+
+extern Datum dwithin_path3D_point3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_path3D_lseg3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_path3D_line3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_path3D_box3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_path3D_path3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_path3D_poly3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_path3D_sphere(PG_FUNCTION_ARGS);
+
+extern Datum dwithin_poly3D_point3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_poly3D_lseg3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_poly3D_line3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_poly3D_box3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_poly3D_path3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_poly3D_poly3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_poly3D_sphere(PG_FUNCTION_ARGS);
+
+extern Datum dwithin_sphere_point3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_sphere_lseg3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_sphere_line3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_sphere_box3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_sphere_path3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_sphere_poly3D(PG_FUNCTION_ARGS);
+extern Datum dwithin_sphere_sphere(PG_FUNCTION_ARGS);
+
 /*****************************************************************************
  *	Closest point functions
  *****************************************************************************/
@@ -2531,6 +3047,436 @@ extern Point3D *interpt_sphere_sphere(Sphere *sphere1, Sphere *sphere2);
  *****************************************************************************/
 
 extern Datum box3D_intersection(PG_FUNCTION_ARGS);
+extern Datum box3D_expand_dist(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ * Single-precision types (geo3D_float_types.c)
+ *****************************************************************************/
+
+extern Point3D *point3DF_point3D_internal(Point3DF *point, Point3D *result);
+extern Point3DF *point3D_point3DF_internal(Point3D *point, Point3DF *result);
+extern Box3D *box3DF_box3D_internal(Box3DF *box, Box3D *result);
+extern Box3DF *box3D_box3DF_internal(Box3D *box, Box3DF *result);
+extern Path3D *path3DF_path3D_internal(Path3DF *path);
+extern Path3DF *path3D_path3DF_internal(Path3D *path);
+extern Datum geo3DF_widen_query(FmgrInfo *flinfo, Datum query, int strategyGroup);
+
+extern Datum point3DF_in(PG_FUNCTION_ARGS);
+extern Datum point3DF_out(PG_FUNCTION_ARGS);
+extern Datum point3DF_recv(PG_FUNCTION_ARGS);
+extern Datum point3DF_send(PG_FUNCTION_ARGS);
+extern Datum point3DF_construct(PG_FUNCTION_ARGS);
+extern Datum point3DF_x(PG_FUNCTION_ARGS);
+extern Datum point3DF_y(PG_FUNCTION_ARGS);
+extern Datum point3DF_z(PG_FUNCTION_ARGS);
+extern Datum point3DF_point3D(PG_FUNCTION_ARGS);
+extern Datum point3D_point3DF(PG_FUNCTION_ARGS);
+extern Datum point3DF_same(PG_FUNCTION_ARGS);
+extern Datum point3DF_cmp(PG_FUNCTION_ARGS);
+extern Datum point3DF_lt(PG_FUNCTION_ARGS);
+extern Datum point3DF_le(PG_FUNCTION_ARGS);
+extern Datum point3DF_eq(PG_FUNCTION_ARGS);
+extern Datum point3DF_ne(PG_FUNCTION_ARGS);
+extern Datum point3DF_ge(PG_FUNCTION_ARGS);
+extern Datum point3DF_gt(PG_FUNCTION_ARGS);
+
+extern Datum box3DF_in(PG_FUNCTION_ARGS);
+extern Datum box3DF_out(PG_FUNCTION_ARGS);
+extern Datum box3DF_recv(PG_FUNCTION_ARGS);
+extern Datum box3DF_send(PG_FUNCTION_ARGS);
+extern Datum box3DF_construct_pts(PG_FUNCTION_ARGS);
+extern Datum box3DF_high(PG_FUNCTION_ARGS);
+extern Datum box3DF_low(PG_FUNCTION_ARGS);
+extern Datum box3DF_box3D(PG_FUNCTION_ARGS);
+extern Datum box3D_box3DF(PG_FUNCTION_ARGS);
+extern Datum box3DF_same(PG_FUNCTION_ARGS);
+extern Datum box3DF_cmp(PG_FUNCTION_ARGS);
+extern Datum box3DF_lt(PG_FUNCTION_ARGS);
+extern Datum box3DF_le(PG_FUNCTION_ARGS);
+extern Datum box3DF_eq(PG_FUNCTION_ARGS);
+extern Datum box3DF_ne(PG_FUNCTION_ARGS);
+extern Datum box3DF_ge(PG_FUNCTION_ARGS);
+extern Datum box3DF_gt(PG_FUNCTION_ARGS);
+
+extern Datum path3DF_in(PG_FUNCTION_ARGS);
+extern Datum path3DF_out(PG_FUNCTION_ARGS);
+extern Datum path3DF_recv(PG_FUNCTION_ARGS);
+extern Datum path3DF_send(PG_FUNCTION_ARGS);
+extern Datum path3DF_npoints(PG_FUNCTION_ARGS);
+extern Datum path3DF_boundbox(PG_FUNCTION_ARGS);
+extern Datum path3DF_path3D(PG_FUNCTION_ARGS);
+extern Datum path3D_path3DF(PG_FUNCTION_ARGS);
+extern Datum path3DF_same(PG_FUNCTION_ARGS);
+extern Datum path3DF_cmp(PG_FUNCTION_ARGS);
+extern Datum path3DF_lt(PG_FUNCTION_ARGS);
+extern Datum path3DF_le(PG_FUNCTION_ARGS);
+extern Datum path3DF_eq(PG_FUNCTION_ARGS);
+extern Datum path3DF_ne(PG_FUNCTION_ARGS);
+extern Datum path3DF_ge(PG_FUNCTION_ARGS);
+extern Datum path3DF_gt(PG_FUNCTION_ARGS);
+
+extern Datum contain_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum contain_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum contain_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum contain_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum contain_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum contained_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum contained_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum contained_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum contained_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum contained_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overlap_box3DF_box3DF(PG_FUNCTION_ARGS);
+
+extern Datum distance_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum distance_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum distance_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum distance_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum distance_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum distance_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum distance_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum distance_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum distance_path3DF_path3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum right_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overright_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum below_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum above_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum front_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum back_point3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overback_point3DF_point3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum right_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overright_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum below_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum above_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum front_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum back_point3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overback_point3DF_box3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum right_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overright_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum below_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum above_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum front_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum back_point3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overback_point3DF_path3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum right_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overright_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum below_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum above_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum front_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum back_box3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overback_box3DF_point3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum right_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overright_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum below_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum above_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum front_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum back_box3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overback_box3DF_box3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum right_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overright_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum below_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum above_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum front_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum back_box3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overback_box3DF_path3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum right_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overright_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum below_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum above_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum front_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum back_path3DF_point3DF(PG_FUNCTION_ARGS);
+extern Datum overback_path3DF_point3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum right_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overright_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum below_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum above_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum front_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum back_path3DF_box3DF(PG_FUNCTION_ARGS);
+extern Datum overback_path3DF_box3DF(PG_FUNCTION_ARGS);
+
+extern Datum left_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overleft_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum right_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overright_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum below_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overbelow_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum above_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overabove_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum front_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overfront_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum back_path3DF_path3DF(PG_FUNCTION_ARGS);
+extern Datum overback_path3DF_path3DF(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ * Point patches (geo3D_pointpatch.c)
+ *****************************************************************************/
+
+extern PointPatch3D *pointpatch3D_make(Point3D *points, int npts, double scale);
+extern void pointpatch3D_decode(PointPatch3D *patch, Point3D *points);
+
+extern Datum pointpatch3D_in(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_out(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_recv(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_send(PG_FUNCTION_ARGS);
+
+extern Datum pointpatch3D_construct(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_quantize(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_npoints(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_boundbox(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_scale(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_points(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_explode(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_filter(PG_FUNCTION_ARGS);
+
+extern Datum overlap_pointpatch3D_box3D(PG_FUNCTION_ARGS);
+extern Datum contained_pointpatch3D_box3D(PG_FUNCTION_ARGS);
+extern Datum distance_pointpatch3D_point3D(PG_FUNCTION_ARGS);
+
+extern Datum pointpatch3D_pack_transfn(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_pack_finalfn(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ * Aggregates (geo3D_aggregates.c)
+ *****************************************************************************/
+
+extern Datum extent3D_point3D_transfn(PG_FUNCTION_ARGS);
+extern Datum extent3D_lseg3D_transfn(PG_FUNCTION_ARGS);
+extern Datum extent3D_box3D_transfn(PG_FUNCTION_ARGS);
+extern Datum extent3D_path3D_transfn(PG_FUNCTION_ARGS);
+extern Datum extent3D_poly3D_transfn(PG_FUNCTION_ARGS);
+extern Datum extent3D_sphere_transfn(PG_FUNCTION_ARGS);
+extern Datum extent3D_pointpatch3D_transfn(PG_FUNCTION_ARGS);
+extern Datum extent3D_combinefn(PG_FUNCTION_ARGS);
+
+extern Datum point3D_moments_transfn(PG_FUNCTION_ARGS);
+extern Datum point3D_moments_combinefn(PG_FUNCTION_ARGS);
+extern Datum centroid3D_finalfn(PG_FUNCTION_ARGS);
+extern Datum covariance3D_finalfn(PG_FUNCTION_ARGS);
+extern Datum principal_axes3D_finalfn(PG_FUNCTION_ARGS);
+extern Datum principal_variances3D_finalfn(PG_FUNCTION_ARGS);
+
+extern Datum path3D_collect_transfn(PG_FUNCTION_ARGS);
+extern Datum path3D_collect_finalfn(PG_FUNCTION_ARGS);
+extern Datum poly3D_collect_transfn(PG_FUNCTION_ARGS);
+extern Datum poly3D_collect_finalfn(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ * Well-Known Binary input and output (geo3D_wkb.c)
+ *****************************************************************************/
+
+extern Datum point3D_asbinary(PG_FUNCTION_ARGS);
+extern Datum lseg3D_asbinary(PG_FUNCTION_ARGS);
+extern Datum line3D_asbinary(PG_FUNCTION_ARGS);
+extern Datum box3D_asbinary(PG_FUNCTION_ARGS);
+extern Datum path3D_asbinary(PG_FUNCTION_ARGS);
+extern Datum poly3D_asbinary(PG_FUNCTION_ARGS);
+extern Datum sphere_asbinary(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_asbinary(PG_FUNCTION_ARGS);
+
+extern Datum point3D_fromwkb(PG_FUNCTION_ARGS);
+extern Datum lseg3D_fromwkb(PG_FUNCTION_ARGS);
+extern Datum line3D_fromwkb(PG_FUNCTION_ARGS);
+extern Datum box3D_fromwkb(PG_FUNCTION_ARGS);
+extern Datum path3D_fromwkb(PG_FUNCTION_ARGS);
+extern Datum poly3D_fromwkb(PG_FUNCTION_ARGS);
+extern Datum sphere_fromwkb(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_fromwkb(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ * Expanded Path3D and Polygon3D (geo3D_expanded.c)
+ *****************************************************************************/
+
+extern Datum expand_path3D(Datum d, MemoryContext parentcontext);
+extern Datum expand_poly3D(Datum d, MemoryContext parentcontext);
+extern ExpandedPoint3D *DatumGetExpandedPath3D(Datum d);
+extern ExpandedPoint3D *DatumGetExpandedPoly3D(Datum d);
+extern ExpandedPoint3D *DatumGetExpandedPoint3DIfAny(Datum d);
+extern void expanded_point3D_append(ExpandedPoint3D *ep, Point3D *points, int32 npts, Box3D *box);
+extern void expanded_point3D_set(ExpandedPoint3D *ep, int32 n, Point3D *point);
+
+extern Datum path3D_append(PG_FUNCTION_ARGS);
+extern Datum path3D_setpoint(PG_FUNCTION_ARGS);
+extern Datum poly3D_append(PG_FUNCTION_ARGS);
+extern Datum poly3D_setpoint(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ * Voxel sets (geo3D_voxel.c)
+ *****************************************************************************/
+
+extern Datum voxelset3D_in(PG_FUNCTION_ARGS);
+extern Datum voxelset3D_out(PG_FUNCTION_ARGS);
+extern Datum voxelset3D_recv(PG_FUNCTION_ARGS);
+extern Datum voxelset3D_send(PG_FUNCTION_ARGS);
+
+extern Datum voxelset3D_nvoxels(PG_FUNCTION_ARGS);
+extern Datum voxelset3D_voxelsize(PG_FUNCTION_ARGS);
+extern Datum voxelset3D_origin(PG_FUNCTION_ARGS);
+extern Datum voxelset3D_count(PG_FUNCTION_ARGS);
+extern Datum voxelset3D_voxels(PG_FUNCTION_ARGS);
+
+extern Datum voxelize3D_transfn(PG_FUNCTION_ARGS);
+extern Datum voxelize3D_combinefn(PG_FUNCTION_ARGS);
+extern Datum voxelize3D_serialfn(PG_FUNCTION_ARGS);
+extern Datum voxelize3D_deserialfn(PG_FUNCTION_ARGS);
+extern Datum voxelize3D_finalfn(PG_FUNCTION_ARGS);
+
+extern Datum voxelcell3D_in(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_out(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_recv(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_send(PG_FUNCTION_ARGS);
+
+extern Datum voxelcell3D_point3D(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_voxel(PG_FUNCTION_ARGS);
+extern Datum voxelcells3D_point3D(PG_FUNCTION_ARGS);
+extern Datum voxelcells3D_box3D(PG_FUNCTION_ARGS);
+
+extern Datum voxelcell3D_lt(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_le(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_eq(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_ne(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_ge(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_gt(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_cmp(PG_FUNCTION_ARGS);
+extern Datum voxelcell3D_hash(PG_FUNCTION_ARGS);
+
+extern Datum morton3D_key(PG_FUNCTION_ARGS);
+extern Datum hilbert3D_key(PG_FUNCTION_ARGS);
+extern Datum morton3D_ranges(PG_FUNCTION_ARGS);
+extern Datum hilbert3D_ranges(PG_FUNCTION_ARGS);
+extern Datum morton3D_within(PG_FUNCTION_ARGS);
+extern Datum hilbert3D_within(PG_FUNCTION_ARGS);
+
+extern Datum octcell3D_in(PG_FUNCTION_ARGS);
+extern Datum octcell3D_out(PG_FUNCTION_ARGS);
+extern Datum octcell3D_recv(PG_FUNCTION_ARGS);
+extern Datum octcell3D_send(PG_FUNCTION_ARGS);
+
+extern Datum octcell3D_point3D(PG_FUNCTION_ARGS);
+extern Datum octcell3D_voxelcell3D(PG_FUNCTION_ARGS);
+extern Datum octcell3D_from_id(PG_FUNCTION_ARGS);
+extern Datum octcell3D_id(PG_FUNCTION_ARGS);
+extern Datum octcell3D_level(PG_FUNCTION_ARGS);
+extern Datum octcell3D_voxel(PG_FUNCTION_ARGS);
+extern Datum octcell3D_parent(PG_FUNCTION_ARGS);
+extern Datum octcell3D_children(PG_FUNCTION_ARGS);
+extern Datum octcells3D_box3D(PG_FUNCTION_ARGS);
+extern Datum octcells3D_sphere(PG_FUNCTION_ARGS);
+extern Datum octcells3D_poly3D(PG_FUNCTION_ARGS);
+
+extern Datum octcell3D_neighbours(PG_FUNCTION_ARGS);
+extern Datum octcell3D_contains(PG_FUNCTION_ARGS);
+extern Datum octcell3D_contained(PG_FUNCTION_ARGS);
+extern Datum octcell3D_lt(PG_FUNCTION_ARGS);
+extern Datum octcell3D_le(PG_FUNCTION_ARGS);
+extern Datum octcell3D_eq(PG_FUNCTION_ARGS);
+extern Datum octcell3D_ne(PG_FUNCTION_ARGS);
+extern Datum octcell3D_ge(PG_FUNCTION_ARGS);
+extern Datum octcell3D_gt(PG_FUNCTION_ARGS);
+extern Datum octcell3D_cmp(PG_FUNCTION_ARGS);
+
+extern Datum octcell3D_hash(PG_FUNCTION_ARGS);
+extern Datum octcell3D_gin_extract_value(PG_FUNCTION_ARGS);
+extern Datum octcell3D_gin_extract_query(PG_FUNCTION_ARGS);
+extern Datum octcell3D_gin_consistent(PG_FUNCTION_ARGS);
+extern Datum partitioncell3D_point3D(PG_FUNCTION_ARGS);
+extern Datum partitioncell3D_lseg3D(PG_FUNCTION_ARGS);
+extern Datum partitioncell3D_box3D(PG_FUNCTION_ARGS);
+extern Datum partitioncell3D_path3D(PG_FUNCTION_ARGS);
+extern Datum partitioncell3D_poly3D(PG_FUNCTION_ARGS);
+extern Datum partitioncell3D_sphere(PG_FUNCTION_ARGS);
+extern Datum partitioncell3D_pointpatch3D(PG_FUNCTION_ARGS);
+extern Datum partitioncells3D(PG_FUNCTION_ARGS);
+
+extern uint64 *octcells3D_cover(Oid type, void *geom, double size,
+	int maxlevel, int maxcells, double margin, bool markinside, int *ncells);
+
+extern bool sfc3D_box_cells(Box3D *box, double size, uint32 *lo, uint32 *hi);
+extern int sfc3D_ranges(bool hilbert, uint32 *lo, uint32 *hi, int maxranges,
+	uint64 **result);
+
+extern uint64 partitioncell3D_id(const Box3D *box, double size, int level);
+extern uint64 *partitioncell3D_keys(const Box3D *box, double size, int level,
+	int maxkeys, int *nkeys);
+
+/* Partition pruning on partition cells (geo3D_partition.c) */
+
+extern void partition3D_register(void);
+
+/*****************************************************************************
+ * Clustering (geo3D_cluster.c)
+ *****************************************************************************/
+
+extern Datum dbscan3D(PG_FUNCTION_ARGS);
+extern Datum kmeans3D(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ * Spatial joins (geo3D_join.c)
+ *****************************************************************************/
+
+extern void spatialjoin3D_stats_add(SpatialJoin3DStats *stats, Box3D *box,
+	double size);
+extern SpatialJoin3D *spatialjoin3D_create(SpatialJoin3DStats *stats1,
+	SpatialJoin3DStats *stats2, Size maxbytes, SpatialJoin3DEmit emit,
+	void *arg);
+extern void spatialjoin3D_add(SpatialJoin3D *join, int side, ItemPointer tid,
+	char *value, int32 len, Box3D *box);
+extern void spatialjoin3D_run(SpatialJoin3D *join);
+extern void spatialjoin3D_free(SpatialJoin3D *join, SpatialJoin3DInstr *instr);
+extern bool spatialjoin3D_operator(const char *opname);
+
+extern Datum spatialjoin3D(PG_FUNCTION_ARGS);
+extern Datum knnjoin3D(PG_FUNCTION_ARGS);
+
+/* Custom scan for spatial joins (geo3D_joinpath.c) */
+
+extern void spatialjoin3D_register(void);
 
 /*****************************************************************************
  *	Support routines for the GiST access method (geo3D_gist_rtree.c)
@@ -2559,6 +3505,20 @@ extern Datum gist_sphere_compress(PG_FUNCTION_ARGS);
 extern Datum gist_sphere_consistent(PG_FUNCTION_ARGS);
 extern Datum gist_sphere_distance(PG_FUNCTION_ARGS);
 
+extern Datum gist_point3DF_compress(PG_FUNCTION_ARGS);
+extern Datum gist_point3DF_fetch(PG_FUNCTION_ARGS);
+extern Datum gist_point3DF_consistent(PG_FUNCTION_ARGS);
+extern Datum gist_point3DF_distance(PG_FUNCTION_ARGS);
+extern Datum gist_box3DF_compress(PG_FUNCTION_ARGS);
+extern Datum gist_box3DF_fetch(PG_FUNCTION_ARGS);
+extern Datum gist_box3DF_consistent(PG_FUNCTION_ARGS);
+extern Datum gist_box3DF_distance(PG_FUNCTION_ARGS);
+extern Datum gist_path3DF_compress(PG_FUNCTION_ARGS);
+extern Datum gist_path3DF_consistent(PG_FUNCTION_ARGS);
+extern Datum gist_path3DF_distance(PG_FUNCTION_ARGS);
+
+extern Datum gist_pointpatch3D_compress(PG_FUNCTION_ARGS);
+
 /*****************************************************************************
  *	Support routines for the SP-GiST octree access method (geo3D_spgist_octree.c)
  *****************************************************************************/
@@ -2569,6 +3529,22 @@ extern Datum spgist_octree_picksplit(PG_FUNCTION_ARGS);
 extern Datum spgist_octree_inner_consistent(PG_FUNCTION_ARGS);
 extern Datum spgist_octree_leaf_consistent(PG_FUNCTION_ARGS);
 
+extern Datum spgist_octreeF_choose(PG_FUNCTION_ARGS);
+extern Datum spgist_octreeF_picksplit(PG_FUNCTION_ARGS);
+extern Datum spgist_octreeF_inner_consistent(PG_FUNCTION_ARGS);
+extern Datum spgist_octreeF_leaf_consistent(PG_FUNCTION_ARGS);
+
+/*****************************************************************************
+ *	Support routines for the GIN octree access method (geo3D_gin_octree.c)
+ *****************************************************************************/
+
+extern Datum gin_box3D_extract_value(PG_FUNCTION_ARGS);
+extern Datum gin_poly3D_extract_value(PG_FUNCTION_ARGS);
+extern Datum gin_path3D_extract_value(PG_FUNCTION_ARGS);
+extern Datum gin_geo3D_extract_query(PG_FUNCTION_ARGS);
+extern Datum gin_geo3D_consistent(PG_FUNCTION_ARGS);
+extern Datum gin_geo3D_options(PG_FUNCTION_ARGS);
+
 /*****************************************************************************
  * Selectivity functions (geo3D_selfuncs.c)
  *****************************************************************************/
@@ -2580,6 +3556,23 @@ extern Datum positionjoinsel3D(PG_FUNCTION_ARGS);
 extern Datum contsel3D(PG_FUNCTION_ARGS);
 extern Datum contjoinsel3D(PG_FUNCTION_ARGS);
 
+/*****************************************************************************
+ * Planner support functions (geo3D_supportfn.c)
+ *****************************************************************************/
+
+extern Datum overlap3D_support(PG_FUNCTION_ARGS);
+extern Datum contain3D_support(PG_FUNCTION_ARGS);
+extern Datum contained3D_support(PG_FUNCTION_ARGS);
+extern Datum dwithin3D_support(PG_FUNCTION_ARGS);
+extern Datum cost3D_support(PG_FUNCTION_ARGS);
+extern Datum pointpatch3D_rows_support(PG_FUNCTION_ARGS);
+extern Datum voxelcells3D_rows_support(PG_FUNCTION_ARGS);
+extern Datum morton3D_within_support(PG_FUNCTION_ARGS);
+extern Datum hilbert3D_within_support(PG_FUNCTION_ARGS);
+extern Datum octcell3D_contains_support(PG_FUNCTION_ARGS);
+extern Datum octcell3D_contained_support(PG_FUNCTION_ARGS);
+extern Datum inplace3D_support(PG_FUNCTION_ARGS);
+
 #endif   /* GEO3D_DECLS_H */
 
 /*****************************************************************************/
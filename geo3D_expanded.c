@@ -0,0 +1,396 @@
+/*****************************************************************************
+ *
+ * geo3D_expanded.c
+ *	  Expanded representation of Path3D and Polygon3D
+ *
+ * Functions that edit a path or a polygon, such as path3D_append or the +
+ * operator on paths, must copy the whole value when given a flat varlena.
+ * They instead return a read-write expanded object, which PL/pgSQL keeps in
+ * the variable of an assignment such as
+ *		path := path3D_append(path, point);
+ * The points of the expanded object are kept in a Point3DBuilder, which
+ * grows geometrically and maintains the bounding box, and the object is
+ * flattened only when the value is stored or passed to a function that is
+ * not aware of it.
+ *
+ * PL/pgSQL passes the variable back as a read-write pointer, which the
+ * function edits in place so that such a loop runs in linear time, only
+ * from PostgreSQL 18 and only when the support function of the called
+ * function accepts a SupportRequestModifyInPlace, see inplace3D_support.
+ * Before, it passes a read-only pointer, and the function copies the points
+ * of the object directly into a new one without flattening it first.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <math.h>
+#include <float.h>
+
+#include <utils/memutils.h>
+#include "geo3D_decls.h"
+
+static Size EP3D_get_flat_size(ExpandedObjectHeader *eohptr);
+static void EP3D_flatten_into(ExpandedObjectHeader *eohptr,
+	void *result, Size allocated_size);
+
+static const ExpandedObjectMethods EP3D_methods =
+{
+	EP3D_get_flat_size,
+	EP3D_flatten_into
+};
+
+/*****************************************************************************
+ * Expansion and flattening
+ *****************************************************************************/
+
+/*
+ * Make an expanded object in its own memory context below parentcontext
+ * from the Path3D or Polygon3D d, which is either flat or a read-only
+ * expanded object whose builder is copied
+ */
+static ExpandedPoint3D *
+expanded_point3D_make(Datum d, MemoryContext parentcontext, bool ispoly)
+{
+	MemoryContext objcxt,
+				oldcxt;
+	ExpandedPoint3D *ep;
+	Point3D    *points;
+	Box3D	   *box;
+	int32		npts;
+
+	objcxt = AllocSetContextCreate(parentcontext, "expanded Path3D",
+		ALLOCSET_START_SMALL_SIZES);
+	ep = (ExpandedPoint3D *) MemoryContextAlloc(objcxt, sizeof(ExpandedPoint3D));
+	EOH_init_header(&ep->hdr, &EP3D_methods, objcxt);
+	ep->magic = EXPANDED_POINT3D_MAGIC;
+	ep->ispoly = ispoly;
+
+	if (VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d)))
+	{
+		ExpandedPoint3D *src = (ExpandedPoint3D *) DatumGetEOHP(d);
+
+		Assert(src->magic == EXPANDED_POINT3D_MAGIC && src->ispoly == ispoly);
+		ep->closed = src->closed;
+		points = POINT3D_BUILDER_POINTS(&src->builder);
+		npts = src->builder.npts;
+		/* The builder computes the box if it is not up to date */
+		box = src->bbox_valid ? &src->builder.boundbox : NULL;
+	}
+	else if (ispoly)
+	{
+		Polygon3D  *poly = DatumGetPolygon3DP(d);
+
+		ep->closed = TRUE;
+		points = poly->p;
+		npts = poly->npts;
+		box = &poly->boundbox;
+	}
+	else
+	{
+		Path3D	   *path = DatumGetPath3DP(d);
+
+		ep->closed = path->closed ? TRUE : FALSE;
+		points = path->p;
+		npts = path->npts;
+		box = &path->boundbox;
+	}
+
+	oldcxt = MemoryContextSwitchTo(objcxt);
+	point3D_builder_init(&ep->builder,
+		ispoly ? offsetof(Polygon3D, p) : offsetof(Path3D, p), npts);
+	MemoryContextSwitchTo(oldcxt);
+
+	point3D_builder_append(&ep->builder, points, npts, box);
+	ep->bbox_valid = TRUE;
+
+	return ep;
+}
+
+/*
+ * expand_path3D: Convert the Path3D d into a read-write expanded object
+ * allocated below parentcontext
+ */
+Datum
+expand_path3D(Datum d, MemoryContext parentcontext)
+{
+	ExpandedPoint3D *ep = expanded_point3D_make(d, parentcontext, FALSE);
+
+	return EOHPGetRWDatum(&ep->hdr);
+}
+
+/*
+ * expand_poly3D: Convert the Polygon3D d into a read-write expanded object
+ * allocated below parentcontext
+ */
+Datum
+expand_poly3D(Datum d, MemoryContext parentcontext)
+{
+	ExpandedPoint3D *ep = expanded_point3D_make(d, parentcontext, TRUE);
+
+	return EOHPGetRWDatum(&ep->hdr);
+}
+
+/*
+ * DatumGetExpandedPoint3DIfAny: Expanded object of the Path3D or Polygon3D
+ * d, or NULL if d is not expanded. The result is read-only unless d is a
+ * read-write pointer.
+ */
+ExpandedPoint3D *
+DatumGetExpandedPoint3DIfAny(Datum d)
+{
+	ExpandedPoint3D *ep;
+
+	if (!VARATT_IS_EXTERNAL_EXPANDED(DatumGetPointer(d)))
+		return NULL;
+	ep = (ExpandedPoint3D *) DatumGetEOHP(d);
+	Assert(ep->magic == EXPANDED_POINT3D_MAGIC);
+	return ep;
+}
+
+/*
+ * Expanded object that can be edited in place: d itself if it is a
+ * read-write pointer, otherwise a new one in the current memory context
+ */
+static ExpandedPoint3D *
+expanded_point3D_rw(Datum d, bool ispoly)
+{
+	ExpandedPoint3D *ep;
+
+	if (VARATT_IS_EXTERNAL_EXPANDED_RW(DatumGetPointer(d)))
+	{
+		ep = (ExpandedPoint3D *) DatumGetEOHP(d);
+		Assert(ep->magic == EXPANDED_POINT3D_MAGIC && ep->ispoly == ispoly);
+		return ep;
+	}
+	return expanded_point3D_make(d, CurrentMemoryContext, ispoly);
+}
+
+/*
+ * DatumGetExpandedPath3D: Read-write expanded object of the Path3D d,
+ * which is expanded if needed
+ */
+ExpandedPoint3D *
+DatumGetExpandedPath3D(Datum d)
+{
+	return expanded_point3D_rw(d, FALSE);
+}
+
+/*
+ * DatumGetExpandedPoly3D: Read-write expanded object of the Polygon3D d,
+ * which is expanded if needed
+ */
+ExpandedPoint3D *
+DatumGetExpandedPoly3D(Datum d)
+{
+	return expanded_point3D_rw(d, TRUE);
+}
+
+/*
+ * Recompute the bounding box after a point on its boundary was replaced
+ */
+static void
+expanded_point3D_make_bbox(ExpandedPoint3D *ep)
+{
+	Point3D    *points = POINT3D_BUILDER_POINTS(&ep->builder);
+	Box3D	   *box = &ep->builder.boundbox;
+	int			i;
+
+	box->low = box->high = points[0];
+	for (i = 1; i < ep->builder.npts; i++)
+	{
+		if (FPlt(points[i].x, box->low.x))
+			box->low.x = points[i].x;
+		if (FPgt(points[i].x, box->high.x))
+			box->high.x = points[i].x;
+		if (FPlt(points[i].y, box->low.y))
+			box->low.y = points[i].y;
+		if (FPgt(points[i].y, box->high.y))
+			box->high.y = points[i].y;
+		if (FPlt(points[i].z, box->low.z))
+			box->low.z = points[i].z;
+		if (FPgt(points[i].z, box->high.z))
+			box->high.z = points[i].z;
+	}
+	ep->bbox_valid = TRUE;
+}
+
+static Size
+EP3D_get_flat_size(ExpandedObjectHeader *eohptr)
+{
+	ExpandedPoint3D *ep = (ExpandedPoint3D *) eohptr;
+
+	Assert(ep->magic == EXPANDED_POINT3D_MAGIC);
+	return ep->builder.hdrsize + sizeof(Point3D) * ep->builder.npts;
+}
+
+static void
+EP3D_flatten_into(ExpandedObjectHeader *eohptr, void *result,
+	Size allocated_size)
+{
+	ExpandedPoint3D *ep = (ExpandedPoint3D *) eohptr;
+	void	   *flat;
+
+	Assert(allocated_size == EP3D_get_flat_size(eohptr));
+
+	if (!ep->bbox_valid)
+		expanded_point3D_make_bbox(ep);
+	if (ep->ispoly)
+		flat = poly3D_builder_finish(&ep->builder);
+	else
+		flat = path3D_builder_finish(&ep->builder, ep->closed);
+	memcpy(result, flat, allocated_size);
+}
+
+/*****************************************************************************
+ * Editing
+ *****************************************************************************/
+
+/*
+ * expanded_point3D_append: Append npts points with bounding box box, or
+ * NULL if unknown, to the expanded object
+ */
+void
+expanded_point3D_append(ExpandedPoint3D *ep, Point3D *points, int32 npts,
+	Box3D *box)
+{
+	/* The buffer of the builder is enlarged in the context of the object */
+	point3D_builder_append(&ep->builder, points, npts, box);
+}
+
+/*
+ * expanded_point3D_set: Replace the n-th point of the expanded object,
+ * counting from 1. The bounding box is only recomputed on flattening, and
+ * only if the replaced point was on its boundary.
+ */
+void
+expanded_point3D_set(ExpandedPoint3D *ep, int32 n, Point3D *point)
+{
+	Point3D    *points = POINT3D_BUILDER_POINTS(&ep->builder);
+	Point3D    *old;
+	Point3D		oldpoint;
+	Box3D	   *box = &ep->builder.boundbox;
+
+	if (n < 1 || n > ep->builder.npts)
+		ereport(ERROR,
+				(errcode(ERRCODE_ARRAY_SUBSCRIPT_ERROR),
+				 errmsg("Point number %d out of range 1..%d", n, ep->builder.npts)));
+
+	old = &points[n - 1];
+	oldpoint = *old;
+	*old = *point;
+
+	/*
+	 * Replacing a point may make a polygon or a closed path degenerate, in
+	 * which case the object is left unchanged, as required for editing it in
+	 * place
+	 */
+	if (ep->closed &&
+		!plist_test3noncollinearpts(points, ep->builder.npts))
+	{
+		*old = oldpoint;
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("Invalid %s specification: a %s requires at least 3 non collinear points",
+					ep->ispoly ? "polygon3D" : "path3D",
+					ep->ispoly ? "polygon" : "closed path")));
+	}
+
+	if (ep->bbox_valid &&
+		(!FPlt(box->low.x, oldpoint.x) || !FPlt(oldpoint.x, box->high.x) ||
+		 !FPlt(box->low.y, oldpoint.y) || !FPlt(oldpoint.y, box->high.y) ||
+		 !FPlt(box->low.z, oldpoint.z) || !FPlt(oldpoint.z, box->high.z)))
+		ep->bbox_valid = FALSE;
+
+	if (ep->bbox_valid)
+	{
+		if (FPlt(point->x, box->low.x))
+			box->low.x = point->x;
+		if (FPgt(point->x, box->high.x))
+			box->high.x = point->x;
+		if (FPlt(point->y, box->low.y))
+			box->low.y = point->y;
+		if (FPgt(point->y, box->high.y))
+			box->high.y = point->y;
+		if (FPlt(point->z, box->low.z))
+			box->low.z = point->z;
+		if (FPgt(point->z, box->high.z))
+			box->high.z = point->z;
+	}
+}
+
+/*
+ * path3D_append: Return the Path3D obtained by appending the Point3D to
+ * the Path3D
+ */
+Datum
+path3D_append(PG_FUNCTION_ARGS)
+{
+	ExpandedPoint3D *ep = DatumGetExpandedPath3D(PG_GETARG_DATUM(0));
+	Point3D    *point = PG_GETARG_POINT3D_P(1);
+
+	expanded_point3D_append(ep, point, 1, NULL);
+
+	PG_RETURN_DATUM(EOHPGetRWDatum(&ep->hdr));
+}
+
+PG_FUNCTION_INFO_V1(path3D_append);
+
+/*
+ * path3D_setpoint: Return the Path3D obtained by replacing the n-th point of
+ * the Path3D with the Point3D
+ */
+Datum
+path3D_setpoint(PG_FUNCTION_ARGS)
+{
+	ExpandedPoint3D *ep = DatumGetExpandedPath3D(PG_GETARG_DATUM(0));
+	int32		n = PG_GETARG_INT32(1);
+	Point3D    *point = PG_GETARG_POINT3D_P(2);
+
+	expanded_point3D_set(ep, n, point);
+
+	PG_RETURN_DATUM(EOHPGetRWDatum(&ep->hdr));
+}
+
+PG_FUNCTION_INFO_V1(path3D_setpoint);
+
+/*
+ * poly3D_append: Return the Polygon3D obtained by appending the Point3D to
+ * the vertices of the Polygon3D
+ */
+Datum
+poly3D_append(PG_FUNCTION_ARGS)
+{
+	ExpandedPoint3D *ep = DatumGetExpandedPoly3D(PG_GETARG_DATUM(0));
+	Point3D    *point = PG_GETARG_POINT3D_P(1);
+
+	expanded_point3D_append(ep, point, 1, NULL);
+
+	PG_RETURN_DATUM(EOHPGetRWDatum(&ep->hdr));
+}
+
+PG_FUNCTION_INFO_V1(poly3D_append);
+
+/*
+ * poly3D_setpoint: Return the Polygon3D obtained by replacing the n-th
+ * vertex of the Polygon3D with the Point3D
+ */
+Datum
+poly3D_setpoint(PG_FUNCTION_ARGS)
+{
+	ExpandedPoint3D *ep = DatumGetExpandedPoly3D(PG_GETARG_DATUM(0));
+	int32		n = PG_GETARG_INT32(1);
+	Point3D    *point = PG_GETARG_POINT3D_P(2);
+
+	expanded_point3D_set(ep, n, point);
+
+	PG_RETURN_DATUM(EOHPGetRWDatum(&ep->hdr));
+}
+
+PG_FUNCTION_INFO_V1(poly3D_setpoint);
+
+/*****************************************************************************/
@@ -0,0 +1,1001 @@
+/*****************************************************************************
+ *
+ * geo3D_float_types.c
+ *	  Single-precision 3D points, boxes, and paths
+ *
+ * The types Point3DF, Box3DF, and Path3DF store their coordinates as float4
+ * and thus halve the heap and TOAST size of Point3D, Box3D, and Path3D for
+ * data which is single precision at source, such as lidar or photogrammetry
+ * point clouds. They do not have their own geometric kernels: arguments are
+ * widened to the double-precision types, which is exact, and the _internal
+ * functions of the double-precision types are called, so that both families
+ * of types have exactly the same semantics.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <math.h>
+#include <limits.h>
+#include <float.h>
+
+#include <libpq/pqformat.h>
+#include <lib/stringinfo.h>
+#include <utils/builtins.h>
+#if PG_VERSION_NUM >= 120000
+#include <common/shortest_dec.h>
+#include <utils/float.h>
+#endif
+#include "geo3D_decls.h"
+
+static float4 float8_narrow(double val);
+static void point3DF_encode(StringInfo str, Point3DF *point);
+static void path3DF_make_bbox(Path3DF *path);
+static Path3DF *path3DF_alloc(int32 npts, int32 closed);
+
+/*****************************************************************************
+ * Conversion between the single- and the double-precision types
+ *****************************************************************************/
+
+/*
+ * float8_narrow: Convert a double to a float4, raising an error on overflow
+ * and underflow as the float8 to float4 cast does
+ */
+static float4
+float8_narrow(double val)
+{
+	float4		result = (float4) val;
+
+	if (isinf(result) && !isinf(val))
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("value out of range: overflow")));
+	if (result == 0.0 && val != 0.0)
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("value out of range: underflow")));
+	return result;
+}
+
+/*
+ * point3DF_point3D_internal: Widen the Point3DF into the Point3D given
+ * by the caller, which is returned
+ */
+Point3D *
+point3DF_point3D_internal(Point3DF *point, Point3D *result)
+{
+	result->x = point->x;
+	result->y = point->y;
+	result->z = point->z;
+	return result;
+}
+
+/*
+ * point3D_point3DF_internal: Narrow the Point3D into the Point3DF given
+ * by the caller, which is returned
+ */
+Point3DF *
+point3D_point3DF_internal(Point3D *point, Point3DF *result)
+{
+	result->x = float8_narrow(point->x);
+	result->y = float8_narrow(point->y);
+	result->z = float8_narrow(point->z);
+	return result;
+}
+
+Box3D *
+box3DF_box3D_internal(Box3DF *box, Box3D *result)
+{
+	point3DF_point3D_internal(&box->high, &result->high);
+	point3DF_point3D_internal(&box->low, &result->low);
+	return result;
+}
+
+Box3DF *
+box3D_box3DF_internal(Box3D *box, Box3DF *result)
+{
+	point3D_point3DF_internal(&box->high, &result->high);
+	point3D_point3DF_internal(&box->low, &result->low);
+	return result;
+}
+
+/*
+ * path3DF_path3D_internal: Form a Path3D from a Path3DF
+ *
+ * The bounding box of the Path3DF is made of float4 coordinates of its
+ * vertices, so it is also the bounding box of the widened path.
+ */
+Path3D *
+path3DF_path3D_internal(Path3DF *path)
+{
+	int			size = offsetof(Path3D, p) + sizeof(Point3D) * path->npts;
+	Path3D	   *result = (Path3D *) palloc(size);
+	int32		i;
+
+	SET_VARSIZE(result, size);
+	result->npts = path->npts;
+	result->closed = path->closed;
+	/* prevent instability in unused pad bytes */
+	result->dummy = 0;
+	box3DF_box3D_internal(&path->boundbox, &result->boundbox);
+	for (i = 0; i < path->npts; i++)
+		point3DF_point3D_internal(&path->p[i], &result->p[i]);
+
+	return result;
+}
+
+/*
+ * path3D_path3DF_internal: Form a Path3DF from a Path3D
+ *
+ * The bounding box is recomputed from the rounded vertices.
+ */
+Path3DF *
+path3D_path3DF_internal(Path3D *path)
+{
+	Path3DF    *result = path3DF_alloc(path->npts, path->closed);
+	int32		i;
+
+	for (i = 0; i < path->npts; i++)
+		point3D_point3DF_internal(&path->p[i], &result->p[i]);
+	path3DF_make_bbox(result);
+
+	return result;
+}
+
+/*----------------------------------------------------------
+ *	Widening of index queries
+ *---------------------------------------------------------*/
+
+/* Number of widened queries kept per index support function */
+#define GEO3DF_QUERY_CACHE_SIZE	8
+
+typedef struct
+{
+	int			group;			/* strategy group of the query */
+	Size		size;			/* size of the single-precision query */
+	void	   *queryf;			/* copy of the single-precision query */
+	Datum		query;			/* its double-precision counterpart */
+} Geo3DFQueryCacheEntry;
+
+typedef struct
+{
+	int			nentries;
+	int			next;			/* entry to evict when the cache is full */
+	Geo3DFQueryCacheEntry entries[GEO3DF_QUERY_CACHE_SIZE];
+} Geo3DFQueryCache;
+
+/*
+ * geo3DF_widen_query: Return the double-precision counterpart of the
+ * single-precision query of an index support function
+ *
+ * The support functions of the GiST and SP-GiST operator classes of the
+ * single-precision types are called once per index tuple with the same
+ * queries. The widened queries are thus cached in fn_extra, which avoids
+ * allocating a Path3D for every index tuple visited.
+ */
+Datum
+geo3DF_widen_query(FmgrInfo *flinfo, Datum query, int strategyGroup)
+{
+	Geo3DFQueryCache *cache = (Geo3DFQueryCache *) flinfo->fn_extra;
+	Geo3DFQueryCacheEntry *entry;
+	MemoryContext oldcxt;
+	void	   *queryf;
+	Size		size;
+	int			i;
+
+	switch (strategyGroup)
+	{
+		case Point3DStrategyNumberGroup:
+			queryf = DatumGetPoint3DFP(query);
+			size = sizeof(Point3DF);
+			break;
+		case Box3DStrategyNumberGroup:
+			queryf = DatumGetBox3DFP(query);
+			size = sizeof(Box3DF);
+			break;
+		case Path3DStrategyNumberGroup:
+			queryf = DatumGetPath3DFP(query);
+			size = VARSIZE(queryf);
+			break;
+		default:
+			elog(ERROR, "geo3DF_widen_query: unrecognized strategy group number: %d", strategyGroup);
+			return (Datum) 0;	/* keep compiler quiet */
+	}
+
+	if (cache == NULL)
+	{
+		cache = (Geo3DFQueryCache *) MemoryContextAllocZero(flinfo->fn_mcxt,
+			sizeof(Geo3DFQueryCache));
+		flinfo->fn_extra = cache;
+	}
+
+	for (i = 0; i < cache->nentries; i++)
+	{
+		entry = &cache->entries[i];
+		if (entry->group == strategyGroup && entry->size == size &&
+			memcmp(entry->queryf, queryf, size) == 0)
+		{
+			if (queryf != DatumGetPointer(query))
+				pfree(queryf);
+			return entry->query;
+		}
+	}
+
+	if (cache->nentries < GEO3DF_QUERY_CACHE_SIZE)
+		entry = &cache->entries[cache->nentries++];
+	else
+	{
+		entry = &cache->entries[cache->next];
+		cache->next = (cache->next + 1) % GEO3DF_QUERY_CACHE_SIZE;
+		pfree(entry->queryf);
+		pfree(DatumGetPointer(entry->query));
+	}
+
+	oldcxt = MemoryContextSwitchTo(flinfo->fn_mcxt);
+	entry->group = strategyGroup;
+	entry->size = size;
+	entry->queryf = palloc(size);
+	memcpy(entry->queryf, queryf, size);
+	switch (strategyGroup)
+	{
+		case Point3DStrategyNumberGroup:
+			entry->query = Point3DPGetDatum(point3DF_point3D_internal(
+				(Point3DF *) queryf, (Point3D *) palloc(sizeof(Point3D))));
+			break;
+		case Box3DStrategyNumberGroup:
+			entry->query = Box3DPGetDatum(box3DF_box3D_internal(
+				(Box3DF *) queryf, (Box3D *) palloc(sizeof(Box3D))));
+			break;
+		default:	/* Path3DStrategyNumberGroup */
+			entry->query = Path3DPGetDatum(path3DF_path3D_internal((Path3DF *) queryf));
+			break;
+	}
+	MemoryContextSwitchTo(oldcxt);
+
+	if (queryf != DatumGetPointer(query))
+		pfree(queryf);
+	return entry->query;
+}
+
+/*----------------------------------------------------------
+ *	Wrappers of the double-precision kernels
+ *---------------------------------------------------------*/
+
+/*
+ * GEO3DF_ARG_<type>(var, n) declares the variable var pointing to the
+ * double-precision counterpart of argument n. Points and boxes are widened
+ * on the stack, paths are widened in a palloc'd copy that is released by
+ * GEO3DF_FREE_<type>(var, n).
+ */
+#define GEO3DF_ARG_point3DF(var, n) \
+	Point3D		var##_d; \
+	Point3D	   *var = point3DF_point3D_internal(PG_GETARG_POINT3DF_P(n), &var##_d)
+#define GEO3DF_FREE_point3DF(var, n)	((void) 0)
+
+#define GEO3DF_ARG_box3DF(var, n) \
+	Box3D		var##_d; \
+	Box3D	   *var = box3DF_box3D_internal(PG_GETARG_BOX3DF_P(n), &var##_d)
+#define GEO3DF_FREE_box3DF(var, n)	((void) 0)
+
+#define GEO3DF_ARG_path3DF(var, n) \
+	Path3DF    *var##_f = PG_GETARG_PATH3DF_P(n); \
+	Path3D	   *var = path3DF_path3D_internal(var##_f)
+#define GEO3DF_FREE_path3DF(var, n) \
+	do { \
+		pfree(var); \
+		PG_FREE_IF_COPY(var##_f, n); \
+	} while (0)
+
+/*
+ * Define the SQL-callable function fname(t1, t2) returning, by means of the
+ * macro PG_RETURN_<ret>, the value of kernel applied to the widened arguments
+ */
+#define GEO3DF_BINARY_OP(fname, t1, t2, kernel, ctype, ret) \
+Datum \
+fname(PG_FUNCTION_ARGS) \
+{ \
+	GEO3DF_ARG_##t1(arg1, 0); \
+	GEO3DF_ARG_##t2(arg2, 1); \
+	ctype		result = kernel(arg1, arg2); \
+\
+	GEO3DF_FREE_##t1(arg1, 0); \
+	GEO3DF_FREE_##t2(arg2, 1); \
+	PG_RETURN_##ret(result); \
+} \
+\
+PG_FUNCTION_INFO_V1(fname)
+
+#define GEO3DF_BOOL_OP(fname, t1, t2, kernel) \
+	GEO3DF_BINARY_OP(fname, t1, t2, kernel, bool, BOOL)
+#define GEO3DF_FLOAT8_OP(fname, t1, t2, kernel) \
+	GEO3DF_BINARY_OP(fname, t1, t2, kernel, float8, FLOAT8)
+#define GEO3DF_INT32_OP(fname, t1, t2, kernel) \
+	GEO3DF_BINARY_OP(fname, t1, t2, kernel, int32, INT32)
+
+/*
+ * The b-tree comparison functions of a type
+ */
+#define GEO3DF_CMP_OP(fname, t, kernel, op) \
+Datum \
+fname(PG_FUNCTION_ARGS) \
+{ \
+	GEO3DF_ARG_##t(arg1, 0); \
+	GEO3DF_ARG_##t(arg2, 1); \
+	bool		result = kernel(arg1, arg2) op 0; \
+\
+	GEO3DF_FREE_##t(arg1, 0); \
+	GEO3DF_FREE_##t(arg2, 1); \
+	PG_RETURN_BOOL(result); \
+} \
+\
+PG_FUNCTION_INFO_V1(fname)
+
+#define GEO3DF_CMP_OPS(t, d) \
+	GEO3DF_INT32_OP(t##_cmp, t, t, d##_cmp_internal); \
+	GEO3DF_CMP_OP(t##_lt, t, d##_cmp_internal, <); \
+	GEO3DF_CMP_OP(t##_le, t, d##_cmp_internal, <=); \
+	GEO3DF_CMP_OP(t##_eq, t, d##_cmp_internal, ==); \
+	GEO3DF_CMP_OP(t##_ne, t, d##_cmp_internal, !=); \
+	GEO3DF_CMP_OP(t##_ge, t, d##_cmp_internal, >=); \
+	GEO3DF_CMP_OP(t##_gt, t, d##_cmp_internal, >)
+
+/*
+ * The relative position operators between two types
+ */
+#define GEO3DF_RELPOS_OPS(t1, t2, d1, d2) \
+	GEO3DF_BOOL_OP(left_##t1##_##t2, t1, t2, left_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(overleft_##t1##_##t2, t1, t2, overleft_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(right_##t1##_##t2, t1, t2, right_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(overright_##t1##_##t2, t1, t2, overright_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(below_##t1##_##t2, t1, t2, below_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(overbelow_##t1##_##t2, t1, t2, overbelow_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(above_##t1##_##t2, t1, t2, above_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(overabove_##t1##_##t2, t1, t2, overabove_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(front_##t1##_##t2, t1, t2, front_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(overfront_##t1##_##t2, t1, t2, overfront_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(back_##t1##_##t2, t1, t2, back_##d1##_##d2##_internal); \
+	GEO3DF_BOOL_OP(overback_##t1##_##t2, t1, t2, overback_##d1##_##d2##_internal)
+
+/***********************************************************************
+ * Routines for single-precision 3D points
+ ***********************************************************************/
+
+/* Maximum number of characters printed by float4_encode() */
+#define PF_MAXLEN (FLT_DIG+3+7+1)
+
+/*
+ * float4_encode: Append the float4 to the string as float4out does, that
+ * is, in the shortest form that reads back as the same value when
+ * extra_float_digits is positive
+ */
+static void
+float4_encode(StringInfo str, float4 x)
+{
+	int			ndig = FLT_DIG + extra_float_digits;
+
+	enlargeStringInfo(str, PF_MAXLEN);
+#if PG_VERSION_NUM >= 120000
+	if (extra_float_digits > 0)
+	{
+		str->len += float_to_shortest_decimal_buf(x, str->data + str->len);
+		return;
+	}
+#endif
+	if (ndig < 1)
+		ndig = 1;
+
+	str->len += snprintf(str->data + str->len, PF_MAXLEN + 1, "%.*g", ndig, x);
+}
+
+/*
+ * point3DF_encode: Append the Point3DF to the string as "(x,y,z)"
+ */
+static void
+point3DF_encode(StringInfo str, Point3DF *point)
+{
+	appendStringInfoCharMacro(str, '(');
+	float4_encode(str, point->x);
+	appendStringInfoCharMacro(str, ',');
+	float4_encode(str, point->y);
+	appendStringInfoCharMacro(str, ',');
+	float4_encode(str, point->z);
+	appendStringInfoCharMacro(str, ')');
+}
+
+/*
+ * point3DF_in: Read in the Point3DF from a string specification
+ *
+ * The input format is the one of Point3D
+ */
+Datum
+point3DF_in(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = DatumGetPoint3DP(DirectFunctionCall1(point3D_in,
+		PG_GETARG_DATUM(0)));
+	Point3DF   *result = (Point3DF *) palloc(sizeof(Point3DF));
+
+	point3D_point3DF_internal(point, result);
+	PG_RETURN_POINT3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(point3DF_in);
+
+/*
+ * point3DF_out: Convert internal Point3DF representation to character string
+ *
+ * Output format:
+ * 		"(x,y,z)"
+ */
+Datum
+point3DF_out(PG_FUNCTION_ARGS)
+{
+	Point3DF   *point = PG_GETARG_POINT3DF_P(0);
+	StringInfoData str;
+
+	initStringInfo(&str);
+	point3DF_encode(&str, point);
+	PG_RETURN_CSTRING(str.data);
+}
+
+PG_FUNCTION_INFO_V1(point3DF_out);
+
+/*
+ * point3DF_recv: Convert external binary representation to Point3DF
+ */
+Datum
+point3DF_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	Point3DF   *point = (Point3DF *) palloc(sizeof(Point3DF));
+
+	point->x = pq_getmsgfloat4(buf);
+	point->y = pq_getmsgfloat4(buf);
+	point->z = pq_getmsgfloat4(buf);
+	PG_RETURN_POINT3DF_P(point);
+}
+
+PG_FUNCTION_INFO_V1(point3DF_recv);
+
+/*
+ * point3DF_send: Convert Point3DF to binary representation
+ */
+Datum
+point3DF_send(PG_FUNCTION_ARGS)
+{
+	Point3DF   *point = PG_GETARG_POINT3DF_P(0);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	pq_sendfloat4(&buf, point->x);
+	pq_sendfloat4(&buf, point->y);
+	pq_sendfloat4(&buf, point->z);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(point3DF_send);
+
+/*
+ * point3DF_construct: Form a Point3DF from three float4
+ */
+Datum
+point3DF_construct(PG_FUNCTION_ARGS)
+{
+	Point3DF   *result = (Point3DF *) palloc(sizeof(Point3DF));
+
+	result->x = PG_GETARG_FLOAT4(0);
+	result->y = PG_GETARG_FLOAT4(1);
+	result->z = PG_GETARG_FLOAT4(2);
+	PG_RETURN_POINT3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(point3DF_construct);
+
+Datum
+point3DF_x(PG_FUNCTION_ARGS)
+{
+	Point3DF   *point = PG_GETARG_POINT3DF_P(0);
+
+	PG_RETURN_FLOAT4(point->x);
+}
+
+PG_FUNCTION_INFO_V1(point3DF_x);
+
+Datum
+point3DF_y(PG_FUNCTION_ARGS)
+{
+	Point3DF   *point = PG_GETARG_POINT3DF_P(0);
+
+	PG_RETURN_FLOAT4(point->y);
+}
+
+PG_FUNCTION_INFO_V1(point3DF_y);
+
+Datum
+point3DF_z(PG_FUNCTION_ARGS)
+{
+	Point3DF   *point = PG_GETARG_POINT3DF_P(0);
+
+	PG_RETURN_FLOAT4(point->z);
+}
+
+PG_FUNCTION_INFO_V1(point3DF_z);
+
+/*
+ * point3DF_point3D: Cast a Point3DF to a Point3D
+ */
+Datum
+point3DF_point3D(PG_FUNCTION_ARGS)
+{
+	Point3DF   *point = PG_GETARG_POINT3DF_P(0);
+
+	PG_RETURN_POINT3D_P(point3DF_point3D_internal(point,
+		(Point3D *) palloc(sizeof(Point3D))));
+}
+
+PG_FUNCTION_INFO_V1(point3DF_point3D);
+
+/*
+ * point3D_point3DF: Cast a Point3D to a Point3DF
+ */
+Datum
+point3D_point3DF(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = PG_GETARG_POINT3D_P(0);
+
+	PG_RETURN_POINT3DF_P(point3D_point3DF_internal(point,
+		(Point3DF *) palloc(sizeof(Point3DF))));
+}
+
+PG_FUNCTION_INFO_V1(point3D_point3DF);
+
+GEO3DF_BOOL_OP(point3DF_same, point3DF, point3DF, point3D_same_internal);
+GEO3DF_CMP_OPS(point3DF, point3D);
+
+/***********************************************************************
+ * Routines for single-precision 3D boxes
+ ***********************************************************************/
+
+/*
+ * box3DF_in: Read in the Box3DF from a string specification
+ *
+ * The input format is the one of Box3D
+ */
+Datum
+box3DF_in(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = DatumGetBox3DP(DirectFunctionCall1(box3D_in,
+		PG_GETARG_DATUM(0)));
+	Box3DF	   *result = (Box3DF *) palloc(sizeof(Box3DF));
+
+	box3D_box3DF_internal(box, result);
+	PG_RETURN_BOX3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(box3DF_in);
+
+/*
+ * box3DF_out: Convert internal Box3DF representation to character string
+ *
+ * Output format:
+ * 		"(f4, f4, f4), (f4, f4, f4)"
+ */
+Datum
+box3DF_out(PG_FUNCTION_ARGS)
+{
+	Box3DF	   *box = PG_GETARG_BOX3DF_P(0);
+	StringInfoData str;
+
+	initStringInfo(&str);
+	point3DF_encode(&str, &box->high);
+	appendStringInfoChar(&str, ',');
+	point3DF_encode(&str, &box->low);
+	PG_RETURN_CSTRING(str.data);
+}
+
+PG_FUNCTION_INFO_V1(box3DF_out);
+
+/*
+ * box3DF_recv: Convert external binary representation to Box3DF
+ */
+Datum
+box3DF_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	Box3DF	   *box = (Box3DF *) palloc(sizeof(Box3DF));
+	float4		tmp;
+
+	box->high.x = pq_getmsgfloat4(buf);
+	box->high.y = pq_getmsgfloat4(buf);
+	box->high.z = pq_getmsgfloat4(buf);
+	box->low.x = pq_getmsgfloat4(buf);
+	box->low.y = pq_getmsgfloat4(buf);
+	box->low.z = pq_getmsgfloat4(buf);
+
+	/* reorder corners if necessary... */
+	if (box->high.x < box->low.x)
+	{
+		tmp = box->high.x;
+		box->high.x = box->low.x;
+		box->low.x = tmp;
+	}
+	if (box->high.y < box->low.y)
+	{
+		tmp = box->high.y;
+		box->high.y = box->low.y;
+		box->low.y = tmp;
+	}
+	if (box->high.z < box->low.z)
+	{
+		tmp = box->high.z;
+		box->high.z = box->low.z;
+		box->low.z = tmp;
+	}
+
+	PG_RETURN_BOX3DF_P(box);
+}
+
+PG_FUNCTION_INFO_V1(box3DF_recv);
+
+/*
+ * box3DF_send: Convert Box3DF to binary representation
+ */
+Datum
+box3DF_send(PG_FUNCTION_ARGS)
+{
+	Box3DF	   *box = PG_GETARG_BOX3DF_P(0);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	pq_sendfloat4(&buf, box->high.x);
+	pq_sendfloat4(&buf, box->high.y);
+	pq_sendfloat4(&buf, box->high.z);
+	pq_sendfloat4(&buf, box->low.x);
+	pq_sendfloat4(&buf, box->low.y);
+	pq_sendfloat4(&buf, box->low.z);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(box3DF_send);
+
+/*
+ * box3DF_construct_pts: Form a Box3DF from two Point3DF
+ */
+Datum
+box3DF_construct_pts(PG_FUNCTION_ARGS)
+{
+	Point3DF   *point1 = PG_GETARG_POINT3DF_P(0);
+	Point3DF   *point2 = PG_GETARG_POINT3DF_P(1);
+	Box3DF	   *result = (Box3DF *) palloc(sizeof(Box3DF));
+
+	result->high.x = Max(point1->x, point2->x);
+	result->high.y = Max(point1->y, point2->y);
+	result->high.z = Max(point1->z, point2->z);
+	result->low.x = Min(point1->x, point2->x);
+	result->low.y = Min(point1->y, point2->y);
+	result->low.z = Min(point1->z, point2->z);
+	PG_RETURN_BOX3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(box3DF_construct_pts);
+
+Datum
+box3DF_high(PG_FUNCTION_ARGS)
+{
+	Box3DF	   *box = PG_GETARG_BOX3DF_P(0);
+	Point3DF   *result = (Point3DF *) palloc(sizeof(Point3DF));
+
+	*result = box->high;
+	PG_RETURN_POINT3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(box3DF_high);
+
+Datum
+box3DF_low(PG_FUNCTION_ARGS)
+{
+	Box3DF	   *box = PG_GETARG_BOX3DF_P(0);
+	Point3DF   *result = (Point3DF *) palloc(sizeof(Point3DF));
+
+	*result = box->low;
+	PG_RETURN_POINT3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(box3DF_low);
+
+/*
+ * box3DF_box3D: Cast a Box3DF to a Box3D
+ */
+Datum
+box3DF_box3D(PG_FUNCTION_ARGS)
+{
+	Box3DF	   *box = PG_GETARG_BOX3DF_P(0);
+
+	PG_RETURN_BOX3D_P(box3DF_box3D_internal(box, (Box3D *) palloc(sizeof(Box3D))));
+}
+
+PG_FUNCTION_INFO_V1(box3DF_box3D);
+
+/*
+ * box3D_box3DF: Cast a Box3D to a Box3DF
+ */
+Datum
+box3D_box3DF(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+
+	PG_RETURN_BOX3DF_P(box3D_box3DF_internal(box, (Box3DF *) palloc(sizeof(Box3DF))));
+}
+
+PG_FUNCTION_INFO_V1(box3D_box3DF);
+
+GEO3DF_BOOL_OP(box3DF_same, box3DF, box3DF, box3D_same_internal);
+GEO3DF_CMP_OPS(box3DF, box3D);
+
+/***********************************************************************
+ * Routines for single-precision 3D paths
+ ***********************************************************************/
+
+/*
+ * path3DF_alloc: Allocate a Path3DF of npts points
+ */
+static Path3DF *
+path3DF_alloc(int32 npts, int32 closed)
+{
+	Path3DF    *path;
+	int			size;
+
+	if (npts <= 0 || npts >= (int32) ((INT_MAX - offsetof(Path3DF, p)) / sizeof(Point3DF)))
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("Too many points requested")));
+
+	size = offsetof(Path3DF, p) + sizeof(Point3DF) * npts;
+	path = (Path3DF *) palloc(size);
+	SET_VARSIZE(path, size);
+	path->npts = npts;
+	path->closed = (closed ? 1 : 0);
+	return path;
+}
+
+/*
+ * path3DF_make_bbox: Make the smallest bounding box for the Path3DF
+ *
+ * Contrary to path3D_make_bbox, exact comparisons are used so that the
+ * box contains all the vertices
+ */
+static void
+path3DF_make_bbox(Path3DF *path)
+{
+	Box3DF	   *box = &path->boundbox;
+	int			i;
+
+	box->high = box->low = path->p[0];
+	for (i = 1; i < path->npts; i++)
+	{
+		if (path->p[i].x < box->low.x)
+			box->low.x = path->p[i].x;
+		if (path->p[i].x > box->high.x)
+			box->high.x = path->p[i].x;
+		if (path->p[i].y < box->low.y)
+			box->low.y = path->p[i].y;
+		if (path->p[i].y > box->high.y)
+			box->high.y = path->p[i].y;
+		if (path->p[i].z < box->low.z)
+			box->low.z = path->p[i].z;
+		if (path->p[i].z > box->high.z)
+			box->high.z = path->p[i].z;
+	}
+}
+
+/*
+ * path3DF_in: Read in the Path3DF from a string specification
+ *
+ * The input format is the one of Path3D
+ */
+Datum
+path3DF_in(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = DatumGetPath3DP(DirectFunctionCall1(path3D_in,
+		PG_GETARG_DATUM(0)));
+	Path3DF    *result = path3D_path3DF_internal(path);
+
+	pfree(path);
+	PG_RETURN_PATH3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(path3DF_in);
+
+/*
+ * path3DF_out: Convert internal Path3DF representation to character string
+ *
+ * Output format:
+ *		"[(x0,y0,z0),...,(xn,yn,zn)]" (open)
+ *		"((x0,y0,z0),...,(xn,yn,zn))" (closed)
+ */
+Datum
+path3DF_out(PG_FUNCTION_ARGS)
+{
+	Path3DF    *path = PG_GETARG_PATH3DF_P(0);
+	StringInfoData str;
+	int32		i;
+
+	initStringInfo(&str);
+	appendStringInfoChar(&str, path->closed ? '(' : '[');
+	for (i = 0; i < path->npts; i++)
+	{
+		if (i > 0)
+			appendStringInfoChar(&str, ',');
+		point3DF_encode(&str, &path->p[i]);
+	}
+	appendStringInfoChar(&str, path->closed ? ')' : ']');
+	PG_RETURN_CSTRING(str.data);
+}
+
+PG_FUNCTION_INFO_V1(path3DF_out);
+
+/*
+ * path3DF_recv: Convert external binary representation to Path3DF
+ *
+ * External representation is closed flag (a boolean byte), int32 number
+ * of points, and the points.
+ */
+Datum
+path3DF_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	Path3DF    *path;
+	int			closed;
+	int32		npts;
+	int32		i;
+
+	closed = pq_getmsgbyte(buf);
+	npts = pq_getmsgint(buf, sizeof(int32));
+	if (npts <= 0 || npts >= (int32) ((INT_MAX - offsetof(Path3DF, p)) / sizeof(Point3DF)))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+			 errmsg("Invalid number of points in external \"path3DF\" value")));
+
+	path = path3DF_alloc(npts, closed);
+	for (i = 0; i < npts; i++)
+	{
+		path->p[i].x = pq_getmsgfloat4(buf);
+		path->p[i].y = pq_getmsgfloat4(buf);
+		path->p[i].z = pq_getmsgfloat4(buf);
+	}
+
+	path3DF_make_bbox(path);
+
+	PG_RETURN_PATH3DF_P(path);
+}
+
+PG_FUNCTION_INFO_V1(path3DF_recv);
+
+/*
+ * path3DF_send: Convert Path3DF to binary representation
+ */
+Datum
+path3DF_send(PG_FUNCTION_ARGS)
+{
+	Path3DF    *path = PG_GETARG_PATH3DF_P(0);
+	StringInfoData buf;
+	int32		i;
+
+	pq_begintypsend(&buf);
+	pq_sendbyte(&buf, path->closed ? 1 : 0);
+	pq_sendint(&buf, path->npts, sizeof(int32));
+	for (i = 0; i < path->npts; i++)
+	{
+		pq_sendfloat4(&buf, path->p[i].x);
+		pq_sendfloat4(&buf, path->p[i].y);
+		pq_sendfloat4(&buf, path->p[i].z);
+	}
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(path3DF_send);
+
+Datum
+path3DF_npoints(PG_FUNCTION_ARGS)
+{
+	Path3DF    *path = PG_GETARG_PATH3DF_P(0);
+	int32		result = path->npts;
+
+	PG_FREE_IF_COPY(path, 0);
+	PG_RETURN_INT32(result);
+}
+
+PG_FUNCTION_INFO_V1(path3DF_npoints);
+
+Datum
+path3DF_boundbox(PG_FUNCTION_ARGS)
+{
+	Path3DF    *path = PG_GETARG_PATH3DF_P(0);
+	Box3DF	   *result = (Box3DF *) palloc(sizeof(Box3DF));
+
+	*result = path->boundbox;
+	PG_FREE_IF_COPY(path, 0);
+	PG_RETURN_BOX3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(path3DF_boundbox);
+
+/*
+ * path3DF_path3D: Cast a Path3DF to a Path3D
+ */
+Datum
+path3DF_path3D(PG_FUNCTION_ARGS)
+{
+	Path3DF    *path = PG_GETARG_PATH3DF_P(0);
+	Path3D	   *result = path3DF_path3D_internal(path);
+
+	PG_FREE_IF_COPY(path, 0);
+	PG_RETURN_PATH3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(path3DF_path3D);
+
+/*
+ * path3D_path3DF: Cast a Path3D to a Path3DF
+ */
+Datum
+path3D_path3DF(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	Path3DF    *result = path3D_path3DF_internal(path);
+
+	PG_FREE_IF_COPY(path, 0);
+	PG_RETURN_PATH3DF_P(result);
+}
+
+PG_FUNCTION_INFO_V1(path3D_path3DF);
+
+GEO3DF_BOOL_OP(path3DF_same, path3DF, path3DF, path3D_same_internal);
+GEO3DF_CMP_OPS(path3DF, path3D);
+
+/*****************************************************************************
+ * Topological operators
+ *****************************************************************************/
+
+GEO3DF_BOOL_OP(contain_box3DF_point3DF, box3DF, point3DF, contain_box3D_point3D_internal);
+GEO3DF_BOOL_OP(contain_box3DF_box3DF, box3DF, box3DF, contain_box3D_box3D_internal);
+GEO3DF_BOOL_OP(contain_box3DF_path3DF, box3DF, path3DF, contain_box3D_path3D_internal);
+GEO3DF_BOOL_OP(contain_path3DF_point3DF, path3DF, point3DF, contain_path3D_point3D_internal);
+GEO3DF_BOOL_OP(contain_path3DF_path3DF, path3DF, path3DF, contain_path3D_path3D_internal);
+
+GEO3DF_BOOL_OP(contained_point3DF_box3DF, point3DF, box3DF, contained_point3D_box3D_internal);
+GEO3DF_BOOL_OP(contained_point3DF_path3DF, point3DF, path3DF, contained_point3D_path3D_internal);
+GEO3DF_BOOL_OP(contained_box3DF_box3DF, box3DF, box3DF, contained_box3D_box3D_internal);
+GEO3DF_BOOL_OP(contained_path3DF_box3DF, path3DF, box3DF, contained_path3D_box3D_internal);
+GEO3DF_BOOL_OP(contained_path3DF_path3DF, path3DF, path3DF, contained_path3D_path3D_internal);
+
+GEO3DF_BOOL_OP(overlap_box3DF_box3DF, box3DF, box3DF, overlap_box3D_box3D_internal);
+
+GEO3DF_FLOAT8_OP(distance_point3DF_point3DF, point3DF, point3DF, dist_point3D_point3D);
+GEO3DF_FLOAT8_OP(distance_point3DF_box3DF, point3DF, box3DF, dist_point3D_box3D);
+GEO3DF_FLOAT8_OP(distance_point3DF_path3DF, point3DF, path3DF, dist_point3D_path3D);
+GEO3DF_FLOAT8_OP(distance_box3DF_point3DF, box3DF, point3DF, dist_box3D_point3D);
+GEO3DF_FLOAT8_OP(distance_box3DF_box3DF, box3DF, box3DF, dist_box3D_box3D);
+GEO3DF_FLOAT8_OP(distance_box3DF_path3DF, box3DF, path3DF, dist_box3D_path3D);
+GEO3DF_FLOAT8_OP(distance_path3DF_point3DF, path3DF, point3DF, dist_path3D_point3D);
+GEO3DF_FLOAT8_OP(distance_path3DF_box3DF, path3DF, box3DF, dist_path3D_box3D);
+GEO3DF_FLOAT8_OP(distance_path3DF_path3DF, path3DF, path3DF, dist_path3D_path3D);
+
+/*****************************************************************************
+ * Relative position operators
+ *****************************************************************************/
+
+GEO3DF_RELPOS_OPS(point3DF, point3DF, point3D, point3D);
+GEO3DF_RELPOS_OPS(point3DF, box3DF, point3D, box3D);
+GEO3DF_RELPOS_OPS(point3DF, path3DF, point3D, path3D);
+GEO3DF_RELPOS_OPS(box3DF, point3DF, box3D, point3D);
+GEO3DF_RELPOS_OPS(box3DF, box3DF, box3D, box3D);
+GEO3DF_RELPOS_OPS(box3DF, path3DF, box3D, path3D);
+GEO3DF_RELPOS_OPS(path3DF, point3DF, path3D, point3D);
+GEO3DF_RELPOS_OPS(path3DF, box3DF, path3D, box3D);
+GEO3DF_RELPOS_OPS(path3DF, path3DF, path3D, path3D);
+
+/*****************************************************************************/
@@ -0,0 +1,361 @@
+/*-------------------------------------------------------------------------
+ *
+ * geo3D_gin_octree.c
+ *	  Inverted octree index over Box3D, Polygon3D, and Path3D for GIN
+ *
+ * A geometry is indexed by the cells of the octree of the grid of
+ * OctCell3D covering it, which are computed by octcells3D_cover with at
+ * most max_cells cells, the depth of the cover adapting to the size and
+ * the shape of the geometry. Unlike the bounding boxes of an R-tree, which
+ * overlap almost all of each other for long or flat geometries, the
+ * cells of different geometries overlap only where the geometries are
+ * close to each other.
+ *
+ * A search window is covered in the same way, and a geometry may
+ * intersect it only if a cell of the geometry is an ancestor, a
+ * descendant, or the same as a cell of the window. As for the GIN operator
+ * class of OctCell3D, a geometry has as keys the identifiers of its cells
+ * and, shifted right by one bit, those of their ancestors, and a window
+ * searches the identifiers of its cells and of their ancestors, and, for
+ * the descendants, its cells shifted right by one bit.
+ *
+ * The cells stop at level OCTCELL3D_MAXLEVEL - 1, whose identifiers have
+ * the three lowest bits unset. The lowest bit of the identifier of a cell
+ * of a geometry is set if the cell is inside the geometry; a window
+ * intersecting the cell or one of its descendants then intersects the
+ * geometry, so that the search needs no recheck for the rows found by
+ * such keys, whereas the rows found only through cells crossing the
+ * boundary of the geometry are rechecked. Since polygons and paths have
+ * no inside, only boxes benefit from this.
+ *
+ * Geometries beyond the grid are also indexed by the key 0, which is not
+ * the key of any cell and is searched by the windows beyond the grid.
+ *
+ * From PostgreSQL 13, the operator classes take as parameters the size of
+ * the voxels of the grid and the maximum number of cells, e.g.,
+ *		CREATE INDEX ON pipes USING gin (geom gin_path3D_ops(voxel_size = 0.01))
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *-------------------------------------------------------------------------
+ */
+
+#include <postgres.h>
+
+#include <access/gin.h>
+#if PG_VERSION_NUM >= 130000
+#include <access/reloptions.h>
+#endif
+#include <access/stratnum.h>
+#include "geo3D_decls.h"
+
+/* Default parameters of the operator classes */
+#define GIN_GEO3D_VOXEL_SIZE	1.0
+#define GIN_GEO3D_MAX_CELLS		16
+
+/* Maximum level of the cells, leaving the lowest bit for marking them */
+#define GIN_GEO3D_MAX_LEVEL		(OCTCELL3D_MAXLEVEL - 1)
+
+/* Key of the geometries beyond the grid */
+#define GIN_GEO3D_OUTSIDE_KEY	0
+
+#if PG_VERSION_NUM >= 130000
+typedef struct
+{
+	int32		vl_len_;		/* varlena header (do not touch directly!) */
+	double		voxel_size;		/* size of the voxels of the grid */
+	int			max_cells;		/* maximum number of cells of a geometry */
+} GinGeo3DOptions;
+#endif
+
+/*
+ * Parameters of the operator class of the index
+ */
+static void
+gin_geo3D_params(FunctionCallInfo fcinfo, double *size, int *maxcells)
+{
+	*size = GIN_GEO3D_VOXEL_SIZE;
+	*maxcells = GIN_GEO3D_MAX_CELLS;
+#if PG_VERSION_NUM >= 130000
+	if (PG_HAS_OPCLASS_OPTIONS())
+	{
+		GinGeo3DOptions *options = (GinGeo3DOptions *) PG_GET_OPCLASS_OPTIONS();
+
+		*size = options->voxel_size;
+		*maxcells = options->max_cells;
+	}
+#endif
+}
+
+/*
+ * Is the box, expanded by the margin, beyond the grid of the size?
+ */
+static bool
+gin_geo3D_outside(const Box3D *box, double size, double margin)
+{
+	double		extent = (double) VOXELSET3D_OFFSET * size;
+
+	/* Written so that NaN coordinates are beyond the grid */
+	return !(box->low.x - margin >= -extent && box->high.x + margin < extent &&
+		box->low.y - margin >= -extent && box->high.y + margin < extent &&
+		box->low.z - margin >= -extent && box->high.z + margin < extent);
+}
+
+static int
+gin_geo3D_key_cmp(const void *a, const void *b)
+{
+	uint64		x = *(const uint64 *) a,
+				y = *(const uint64 *) b;
+
+	return (x < y) ? -1 : ((x > y) ? 1 : 0);
+}
+
+/*
+ * Sort the keys, remove the duplicates, and return them as datums
+ */
+static Datum *
+gin_geo3D_key_datums(uint64 *keys, int nkeys, int32 *nresult)
+{
+	Datum	   *result = (Datum *) palloc(sizeof(Datum) * Max(nkeys, 1));
+	int			i,
+				n = 0;
+
+	qsort(keys, nkeys, sizeof(uint64), gin_geo3D_key_cmp);
+	for (i = 0; i < nkeys; i++)
+	{
+		if (i == 0 || keys[i] != keys[i - 1])
+			result[n++] = Int64GetDatum((int64) keys[i]);
+	}
+	*nresult = n;
+	return result;
+}
+
+/*
+ * Keys of the geometry of the type, where InvalidOid stands for a sphere,
+ * either as indexed or as searched
+ */
+static Datum *
+gin_geo3D_keys(Oid type, void *geom, const Box3D *bbox, bool query,
+	FunctionCallInfo fcinfo, int32 *nkeys)
+{
+	double		size,
+				margin;
+	int			maxcells,
+				ncells,
+				nkeys1 = 0,
+				i,
+				l;
+	uint64	   *cells,
+			   *keys;
+
+	gin_geo3D_params(fcinfo, &size, &maxcells);
+
+	/*
+	 * Since the operators consider as intersecting the geometries closer
+	 * than EPSILON, the indexed ones are covered with the cells within
+	 * EPSILON of them
+	 */
+	margin = query ? 0.0 : EPSILON;
+	cells = octcells3D_cover(type, geom, size, GIN_GEO3D_MAX_LEVEL, maxcells,
+		margin, !query, &ncells);
+
+	keys = (uint64 *) palloc(sizeof(uint64) *
+		(ncells * (2 * GIN_GEO3D_MAX_LEVEL + 3) + 1));
+	for (i = 0; i < ncells; i++)
+	{
+		uint64		id = cells[i] & ~((uint64) 1);
+		int			level = octcell3D_id_level(id);
+
+		if (query)
+		{
+			/* The cell and its ancestors, inside the geometry or not */
+			for (l = 0; l <= level; l++)
+			{
+				uint64		ancestor = octcell3D_id_parent(id, l);
+
+				keys[nkeys1++] = ancestor;
+				keys[nkeys1++] = ancestor | 1;
+			}
+			/* Its descendants */
+			keys[nkeys1++] = id >> 1;
+		}
+		else
+		{
+			keys[nkeys1++] = cells[i];
+			for (l = 0; l < level; l++)
+				keys[nkeys1++] = octcell3D_id_parent(id, l) >> 1;
+		}
+	}
+	if (gin_geo3D_outside(bbox, size, margin))
+		keys[nkeys1++] = GIN_GEO3D_OUTSIDE_KEY;
+	pfree(cells);
+	return gin_geo3D_key_datums(keys, nkeys1, nkeys);
+}
+
+/*****************************************************************************/
+
+/*
+ * The GIN extractValue methods for box3D, polygon3D, and path3D
+ */
+Datum
+gin_box3D_extract_value(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	int32	   *nkeys = (int32 *) PG_GETARG_POINTER(1);
+
+	PG_RETURN_POINTER(gin_geo3D_keys(box3d_oid(), box, box, false, fcinfo,
+		nkeys));
+}
+
+PG_FUNCTION_INFO_V1(gin_box3D_extract_value);
+
+Datum
+gin_poly3D_extract_value(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	int32	   *nkeys = (int32 *) PG_GETARG_POINTER(1);
+
+	PG_RETURN_POINTER(gin_geo3D_keys(poly3d_oid(), poly, &poly->boundbox,
+		false, fcinfo, nkeys));
+}
+
+PG_FUNCTION_INFO_V1(gin_poly3D_extract_value);
+
+Datum
+gin_path3D_extract_value(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	int32	   *nkeys = (int32 *) PG_GETARG_POINTER(1);
+
+	PG_RETURN_POINTER(gin_geo3D_keys(path3d_oid(), path, &path->boundbox,
+		false, fcinfo, nkeys));
+}
+
+PG_FUNCTION_INFO_V1(gin_path3D_extract_value);
+
+/*
+ * The GIN extractQuery method, the type of the query being given by the
+ * group of the strategy
+ */
+Datum
+gin_geo3D_extract_query(PG_FUNCTION_ARGS)
+{
+	int32	   *nkeys = (int32 *) PG_GETARG_POINTER(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	Datum	   *keys;
+
+	switch (strategy / Geo3DStrategyNumberOffset)
+	{
+		case Box3DStrategyNumberGroup:
+		{
+			Box3D	   *box = PG_GETARG_BOX3D_P(0);
+
+			keys = gin_geo3D_keys(box3d_oid(), box, box, true, fcinfo, nkeys);
+			break;
+		}
+		case Path3DStrategyNumberGroup:
+		{
+			Path3D	   *path = PG_GETARG_PATH3D_P(0);
+
+			keys = gin_geo3D_keys(path3d_oid(), path, &path->boundbox, true,
+				fcinfo, nkeys);
+			break;
+		}
+		case Polygon3DStrategyNumberGroup:
+		{
+			Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+
+			keys = gin_geo3D_keys(poly3d_oid(), poly, &poly->boundbox, true,
+				fcinfo, nkeys);
+			break;
+		}
+		case SphereStrategyNumberGroup:
+		{
+			Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+			Box3D		bbox;
+
+			bbox.low.x = sphere->center.x - sphere->radius;
+			bbox.low.y = sphere->center.y - sphere->radius;
+			bbox.low.z = sphere->center.z - sphere->radius;
+			bbox.high.x = sphere->center.x + sphere->radius;
+			bbox.high.y = sphere->center.y + sphere->radius;
+			bbox.high.z = sphere->center.z + sphere->radius;
+			keys = gin_geo3D_keys(InvalidOid, sphere, &bbox, true, fcinfo,
+				nkeys);
+			break;
+		}
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+			keys = NULL;		/* keep compiler quiet */
+			break;
+	}
+	PG_RETURN_POINTER(keys);
+}
+
+PG_FUNCTION_INFO_V1(gin_geo3D_extract_query);
+
+/*
+ * The GIN consistent method. A row found by a key searching a cell inside
+ * the geometry is returned without a recheck, except for a sphere, since
+ * the operators only test whether some points of a sphere are in the
+ * geometry.
+ */
+Datum
+gin_geo3D_consistent(PG_FUNCTION_ARGS)
+{
+	bool	   *check = (bool *) PG_GETARG_POINTER(0);
+	StrategyNumber strategy = PG_GETARG_UINT16(1);
+	int32		nkeys = PG_GETARG_INT32(3);
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(5);
+	Datum	   *queryKeys = (Datum *) PG_GETARG_POINTER(6);
+	bool		exact = (strategy / Geo3DStrategyNumberOffset !=
+						 SphereStrategyNumberGroup),
+				result = false;
+	int32		i;
+
+	*recheck = true;
+	for (i = 0; i < nkeys; i++)
+	{
+		if (check[i])
+		{
+			result = true;
+			if (exact && (DatumGetInt64(queryKeys[i]) & 1))
+			{
+				*recheck = false;
+				break;
+			}
+		}
+	}
+	PG_RETURN_BOOL(result);
+}
+
+PG_FUNCTION_INFO_V1(gin_geo3D_consistent);
+
+/*
+ * The GIN options method, defining the parameters of the operator classes
+ * from PostgreSQL 13
+ */
+Datum
+gin_geo3D_options(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 130000
+	local_relopts *relopts = (local_relopts *) PG_GETARG_POINTER(0);
+
+	init_local_reloptions(relopts, sizeof(GinGeo3DOptions));
+	add_local_real_reloption(relopts, "voxel_size",
+		"size of the voxels of the grid of the octree",
+		GIN_GEO3D_VOXEL_SIZE, EPSILON, 1.0E+9,
+		offsetof(GinGeo3DOptions, voxel_size));
+	add_local_int_reloption(relopts, "max_cells",
+		"maximum number of cells covering a geometry",
+		GIN_GEO3D_MAX_CELLS, 8, 1024,
+		offsetof(GinGeo3DOptions, max_cells));
+#endif
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(gin_geo3D_options);
+
+/*****************************************************************************/
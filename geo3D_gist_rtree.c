@@ -2991,4 +2991,244 @@ gist_sphere_distance(PG_FUNCTION_ARGS)
 	PG_RETURN_FLOAT8(distance);
 }
 
+/**************************************************
+ * Single-precision types ops
+ *
+ * The keys of the single-precision types are the same double-precision
+ * boxes as those of Point3D, Box3D, and Path3D, so that the union, penalty,
+ * picksplit, and same methods of boxes are reused. The consistent and
+ * distance methods widen the query and call those of the double-precision
+ * types.
+ **************************************************/
+
+/*
+ * Call the consistent or distance method func of a double-precision type
+ * with the widened query of fcinfo
+ */
+static Datum
+gist_type3DF_call(PGFunction func, FunctionCallInfo fcinfo)
+{
+	StrategyNumber strategy = (StrategyNumber) PG_GETARG_UINT16(2);
+	Datum		query = geo3DF_widen_query(fcinfo->flinfo, PG_GETARG_DATUM(1),
+		strategy / Geo3DStrategyNumberOffset);
+
+	return DirectFunctionCall5(func, PG_GETARG_DATUM(0), query,
+		PG_GETARG_DATUM(2), PG_GETARG_DATUM(3), PG_GETARG_DATUM(4));
+}
+
+/*
+ * GiST compress method for point3DF
+ */
+Datum
+gist_point3DF_compress(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+
+	if (entry->leafkey)			/* Point3DF, actually */
+	{
+		Box3D	   *box = palloc(sizeof(Box3D));
+		Point3DF   *point = DatumGetPoint3DFP(entry->key);
+		GISTENTRY  *retval = palloc(sizeof(GISTENTRY));
+
+		point3DF_point3D_internal(point, &box->high);
+		box->low = box->high;
+
+		gistentryinit(*retval, Box3DPGetDatum(box),
+					  entry->rel, entry->page, entry->offset, FALSE);
+
+		PG_RETURN_POINTER(retval);
+	}
+
+	PG_RETURN_POINTER(entry);
+}
+
+PG_FUNCTION_INFO_V1(gist_point3DF_compress);
+
+/*
+ * GiST fetch method for point3DF
+ *
+ * The key was widened from a Point3DF and thus narrowing it is exact.
+ */
+Datum
+gist_point3DF_fetch(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	Box3D	   *in = DatumGetBox3DP(entry->key);
+	Point3DF   *r;
+	GISTENTRY  *retval;
+
+	retval = palloc(sizeof(GISTENTRY));
+
+	r = (Point3DF *) palloc(sizeof(Point3DF));
+	point3D_point3DF_internal(&in->high, r);
+	gistentryinit(*retval, PointerGetDatum(r),
+				  entry->rel, entry->page,
+				  entry->offset, FALSE);
+
+	PG_RETURN_POINTER(retval);
+}
+
+PG_FUNCTION_INFO_V1(gist_point3DF_fetch);
+
+Datum
+gist_point3DF_consistent(PG_FUNCTION_ARGS)
+{
+	return gist_type3DF_call(gist_point3D_consistent, fcinfo);
+}
+
+PG_FUNCTION_INFO_V1(gist_point3DF_consistent);
+
+Datum
+gist_point3DF_distance(PG_FUNCTION_ARGS)
+{
+	return gist_type3DF_call(gist_point3D_distance, fcinfo);
+}
+
+PG_FUNCTION_INFO_V1(gist_point3DF_distance);
+
+/*
+ * GiST compress method for box3DF
+ */
+Datum
+gist_box3DF_compress(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	GISTENTRY  *retval;
+
+	if (entry->leafkey)
+	{
+		Box3D	   *r = (Box3D *) palloc(sizeof(Box3D));
+
+		box3DF_box3D_internal(DatumGetBox3DFP(entry->key), r);
+
+		retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+		gistentryinit(*retval, PointerGetDatum(r),
+					  entry->rel, entry->page,
+					  entry->offset, FALSE);
+	}
+	else
+		retval = entry;
+	PG_RETURN_POINTER(retval);
+}
+
+PG_FUNCTION_INFO_V1(gist_box3DF_compress);
+
+/*
+ * GiST fetch method for box3DF
+ */
+Datum
+gist_box3DF_fetch(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	Box3DF	   *r;
+	GISTENTRY  *retval;
+
+	retval = palloc(sizeof(GISTENTRY));
+
+	r = (Box3DF *) palloc(sizeof(Box3DF));
+	box3D_box3DF_internal(DatumGetBox3DP(entry->key), r);
+	gistentryinit(*retval, PointerGetDatum(r),
+				  entry->rel, entry->page,
+				  entry->offset, FALSE);
+
+	PG_RETURN_POINTER(retval);
+}
+
+PG_FUNCTION_INFO_V1(gist_box3DF_fetch);
+
+Datum
+gist_box3DF_consistent(PG_FUNCTION_ARGS)
+{
+	return gist_type3DF_call(gist_box3D_consistent, fcinfo);
+}
+
+PG_FUNCTION_INFO_V1(gist_box3DF_consistent);
+
+Datum
+gist_box3DF_distance(PG_FUNCTION_ARGS)
+{
+	return gist_type3DF_call(gist_poly3D_distance, fcinfo);
+}
+
+PG_FUNCTION_INFO_V1(gist_box3DF_distance);
+
+/*
+ * GiST compress for path3DF: represent a path by its bounding box
+ */
+Datum
+gist_path3DF_compress(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	GISTENTRY  *retval;
+
+	if (entry->leafkey)
+	{
+		Path3DF    *in = DatumGetPath3DFP(entry->key);
+		Box3D	   *r;
+
+		r = (Box3D *) palloc(sizeof(Box3D));
+		box3DF_box3D_internal(&in->boundbox, r);
+
+		retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+		gistentryinit(*retval, PointerGetDatum(r),
+					  entry->rel, entry->page,
+					  entry->offset, FALSE);
+	}
+	else
+		retval = entry;
+	PG_RETURN_POINTER(retval);
+}
+
+PG_FUNCTION_INFO_V1(gist_path3DF_compress);
+
+Datum
+gist_path3DF_consistent(PG_FUNCTION_ARGS)
+{
+	return gist_type3DF_call(gist_type3D_consistent, fcinfo);
+}
+
+PG_FUNCTION_INFO_V1(gist_path3DF_consistent);
+
+Datum
+gist_path3DF_distance(PG_FUNCTION_ARGS)
+{
+	return gist_type3DF_call(gist_poly3D_distance, fcinfo);
+}
+
+PG_FUNCTION_INFO_V1(gist_path3DF_distance);
+
+/**************************************************
+ * Point patch ops
+ **************************************************/
+
+/*
+ * GiST compress for point patches: the key is the bounding box in the header,
+ * so only the header of a toasted patch is fetched.
+ */
+Datum
+gist_pointpatch3D_compress(PG_FUNCTION_ARGS)
+{
+	GISTENTRY  *entry = (GISTENTRY *) PG_GETARG_POINTER(0);
+	GISTENTRY  *retval;
+
+	if (entry->leafkey)
+	{
+		PointPatch3D *in = DatumGetPointPatch3DPHeader(entry->key);
+		Box3D	   *r;
+
+		r = (Box3D *) palloc(sizeof(Box3D));
+		memcpy((void *) r, (void *) &in->boundbox, sizeof(Box3D));
+
+		retval = (GISTENTRY *) palloc(sizeof(GISTENTRY));
+		gistentryinit(*retval, PointerGetDatum(r),
+					  entry->rel, entry->page,
+					  entry->offset, FALSE);
+	}
+	else
+		retval = entry;
+	PG_RETURN_POINTER(retval);
+}
+
+PG_FUNCTION_INFO_V1(gist_pointpatch3D_compress);
+
 /*-------------------------------------------------------------------------*/
@@ -0,0 +1,1447 @@
+/*****************************************************************************
+ *
+ * geo3D_join.c
+ *	  Spatial joins of 3D relations
+ *
+ * The function spatialjoin3D joins two relations on a spatial predicate
+ * with the Partition Based Spatial-Merge join (PBSM) of Patel and DeWitt.
+ * The intersection of the extents of the inputs is divided into a grid of
+ * tiles adapted to the number and the size of the objects, and the tiles
+ * are hashed into partitions sized so that a partition of both inputs fits
+ * in work_mem. Each object is copied to the partitions of the tiles that
+ * its bounding box overlaps, the partitions being spilled to temporary
+ * files when the memory used exceeds work_mem. Each partition is then
+ * joined with a plane sweep on the low x coordinate of the boxes. A pair
+ * found in several partitions is reported only in the partition of the
+ * tile containing the low corner of the intersection of the boxes, which
+ * is the reference point technique of Dittrich and Seeger.
+ *
+ * The function knnjoin3D returns for each row of a relation the k nearest
+ * rows of another one. The objects of the inner relation are kept in memory
+ * in a tree of bounding boxes built by recursive median splits, i.e., a
+ * kd-tree whose nodes have the box of their objects. The outer relation is
+ * read in batches sorted in Hilbert order of the center of the boxes, and
+ * the tree is searched for each row nearest child first, pruning the nodes
+ * farther than the k-th neighbour found so far. Since consecutive rows are
+ * close to each other, the search of a row starts with the bound given by
+ * the neighbours of the previous one, so that the first leaves visited do
+ * not have to be evaluated in full.
+ *
+ * The join itself is independent of where the objects come from, and is
+ * shared with the custom scan of geo3D_joinpath.c, which runs it on the
+ * tuples of the plans of the inputs of a join.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <math.h>
+#include <float.h>
+
+#include <catalog/namespace.h>
+#include <executor/spi.h>
+#include <funcapi.h>
+#include <miscadmin.h>
+#include <nodes/pg_list.h>
+#include <nodes/value.h>
+#include <storage/buffile.h>
+#include <utils/builtins.h>
+#include <utils/datum.h>
+#include <utils/lsyscache.h>
+#include <utils/memutils.h>
+#include <utils/tuplestore.h>
+#include "geo3D_decls.h"
+
+/* Number of rows fetched at a time from the inputs */
+#define SPATIALJOIN3D_BATCH			10000
+
+/* Number of tiles per partition, which balances skewed inputs */
+#define SPATIALJOIN3D_TILES_PER_PART	32
+
+/* Number of objects per tile, which keeps the plane sweep selective */
+#define SPATIALJOIN3D_OBJS_PER_TILE	256
+
+#define SPATIALJOIN3D_MAXTILES		1024	/* per dimension */
+#define SPATIALJOIN3D_MAXPARTS		4096
+
+/* Number of rows of the outer relation of a kNN join sorted at a time */
+#define KNNJOIN3D_BATCH				65536
+
+/* Number of objects in a leaf of the tree of the inner relation */
+#define KNNJOIN3D_LEAF				16
+
+/*
+ * Operators that can be evaluated by the join since they imply that the
+ * bounding boxes of their arguments intersect
+ */
+static const char *const spatialjoin3D_operators[] =
+{
+	"&&", "@>", "<@", "~=", "?#", NULL
+};
+
+/* The entries of an input in a partition */
+typedef struct
+{
+	StringInfoData buf;			/* entries kept in memory */
+	BufFile    *file;			/* entries spilled to disk, if any */
+	Size		filebytes;
+	int64		nentries;
+} SpatialJoin3DSide;
+
+typedef struct
+{
+	SpatialJoin3DSide side[2];
+} SpatialJoin3DPart;
+
+typedef struct
+{
+	Box3D		region;			/* where the objects of both inputs may meet */
+	double		tilesize[3];
+	int32		ntiles[3];
+	int32		nparts;
+} SpatialJoin3DGrid;
+
+struct SpatialJoin3D
+{
+	MemoryContext context;		/* context of the partitions */
+	SpatialJoin3DGrid grid;
+	SpatialJoin3DPart *parts;
+	int64	   *marks;			/* last object copied into each partition */
+	int64		seq;			/* number of objects added */
+	Size		membytes;		/* bytes of the entries kept in memory */
+	Size		maxbytes;
+	SpatialJoin3DEmit emit;
+	void	   *arg;
+	SpatialJoin3DInstr instr;
+};
+
+/* Arguments of the emit function of the SQL function */
+typedef struct
+{
+	MemoryContext predcontext;	/* reset after each call of the operator */
+	FmgrInfo	opfinfo;
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+} SpatialJoin3DFuncState;
+
+/* An object of the inner relation of a kNN join */
+typedef struct
+{
+	Box3D		box;
+	ItemPointerData tid;
+	Datum		value;
+} KnnJoin3DObject;
+
+/* A node of the tree of the inner relation */
+typedef struct
+{
+	Box3D		box;			/* box of the objects of the subtree */
+	int32		start;			/* objects of the subtree */
+	int32		end;
+	int32		left;			/* children, -1 for a leaf */
+	int32		right;
+} KnnJoin3DNode;
+
+typedef struct
+{
+	double		dist;
+	int32		object;
+} KnnJoin3DNeighbor;
+
+/* A row of the outer relation with its k nearest neighbours so far */
+typedef struct
+{
+	Box3D		box;
+	ItemPointerData tid;
+	Datum		value;
+	uint64		key;			/* Hilbert code of the center of the box */
+	double		seedbound;		/* bound of the k-th distance from the seeds */
+	int32		nneighbors;
+	KnnJoin3DNeighbor *neighbors;	/* max-heap on the distance */
+} KnnJoin3DQuery;
+
+typedef struct
+{
+	KnnJoin3DObject *objects;
+	int32		nobjects;
+	KnnJoin3DNode *nodes;
+	int32		nnodes;
+	int32		maxnodes;
+	int32		k;
+	int32	   *seeds;			/* neighbours of the last row searched */
+	int32		nseeds;
+	double	   *seeddists;
+	FmgrInfo	distfinfo;
+	MemoryContext distcontext;	/* reset after each distance */
+	Tuplestorestate *tupstore;
+	TupleDesc	tupdesc;
+} KnnJoin3DState;
+
+/*****************************************************************************
+ * Grid
+ *****************************************************************************/
+
+static inline int32
+spatialjoin3D_tile(double coord, double low, double size, int32 ntiles)
+{
+	double		t;
+
+	if (ntiles == 1)
+		return 0;
+	t = floor((coord - low) / size);
+	/* Written so that NaN goes to the first tile */
+	if (!(t > 0.0))
+		return 0;
+	return (t >= ntiles) ? ntiles - 1 : (int32) t;
+}
+
+/* Map a tile to a partition, hashing so that neighbouring tiles are spread */
+static inline int32
+spatialjoin3D_part(SpatialJoin3DGrid *grid, int32 tx, int32 ty, int32 tz)
+{
+	uint64		id = ((uint64) tx * grid->ntiles[1] + ty) * grid->ntiles[2] + tz;
+
+	id ^= id >> 33;
+	id *= UINT64CONST(0xff51afd7ed558ccd);
+	id ^= id >> 33;
+	return (int32) (id % grid->nparts);
+}
+
+/* Partition of the tile containing the point */
+static inline int32
+spatialjoin3D_point_part(SpatialJoin3DGrid *grid, double x, double y, double z)
+{
+	return spatialjoin3D_part(grid,
+		spatialjoin3D_tile(x, grid->region.low.x, grid->tilesize[0], grid->ntiles[0]),
+		spatialjoin3D_tile(y, grid->region.low.y, grid->tilesize[1], grid->ntiles[1]),
+		spatialjoin3D_tile(z, grid->region.low.z, grid->tilesize[2], grid->ntiles[2]));
+}
+
+/*
+ * Divide the region into about ntiles tiles of equal edges, but not smaller
+ * than twice the average size of the objects in each dimension, which would
+ * replicate most objects in several tiles
+ */
+static void
+spatialjoin3D_make_grid(SpatialJoin3DGrid *grid, double ntiles, double avgdim[3])
+{
+	double		extent[3];
+	double		vol = 1.0,
+				edge = 0.0;
+	int			ndims = 0,
+				i;
+
+	extent[0] = grid->region.high.x - grid->region.low.x;
+	extent[1] = grid->region.high.y - grid->region.low.y;
+	extent[2] = grid->region.high.z - grid->region.low.z;
+	for (i = 0; i < 3; i++)
+	{
+		if (extent[i] > 0.0)
+		{
+			vol *= extent[i];
+			ndims++;
+		}
+	}
+	if (ndims > 0)
+		edge = pow(vol / ntiles, 1.0 / ndims);
+
+	for (i = 0; i < 3; i++)
+	{
+		double		n = 1.0;
+
+		if (extent[i] > 0.0 && edge > 0.0)
+			n = ceil(extent[i] / Max(edge, 2.0 * avgdim[i]));
+		grid->ntiles[i] = (int32) Max(1.0, Min(n, SPATIALJOIN3D_MAXTILES));
+		grid->tilesize[i] = extent[i] / grid->ntiles[i];
+	}
+}
+
+/*****************************************************************************
+ * Partitions
+ *****************************************************************************/
+
+static void
+spatialjoin3D_write(BufFile *file, void *ptr, Size size)
+{
+#if PG_VERSION_NUM >= 160000
+	BufFileWrite(file, ptr, size);
+#else
+	if (BufFileWrite(file, ptr, size) != size)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not write to spatialjoin3D temporary file: %m")));
+#endif
+}
+
+static void
+spatialjoin3D_read(BufFile *file, void *ptr, Size size)
+{
+#if PG_VERSION_NUM >= 160000
+	BufFileReadExact(file, ptr, size);
+#else
+	if (BufFileRead(file, ptr, size) != size)
+		ereport(ERROR,
+				(errcode_for_file_access(),
+				 errmsg("could not read from spatialjoin3D temporary file: %m")));
+#endif
+}
+
+/* Write the entries of the side kept in memory to its temporary file */
+static void
+spatialjoin3D_flush(SpatialJoin3D *join, SpatialJoin3DSide *side)
+{
+	MemoryContext oldcontext;
+
+	if (side->buf.len == 0)
+		return;
+	if (side->file == NULL)
+		side->file = BufFileCreateTemp(false);
+	spatialjoin3D_write(side->file, side->buf.data, side->buf.len);
+	side->filebytes += side->buf.len;
+	join->membytes -= side->buf.len;
+
+	/* Release the memory rather than keeping the enlarged buffer */
+	oldcontext = MemoryContextSwitchTo(join->context);
+	pfree(side->buf.data);
+	initStringInfo(&side->buf);
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * Spill the largest sides to disk until half of work_mem is free, so that
+ * the following objects do not spill a side at each row
+ */
+static void
+spatialjoin3D_spill(SpatialJoin3D *join)
+{
+	while (join->membytes > join->maxbytes / 2)
+	{
+		SpatialJoin3DSide *largest = NULL;
+		int32		p;
+		int			s;
+
+		for (p = 0; p < join->grid.nparts; p++)
+		{
+			for (s = 0; s < 2; s++)
+			{
+				SpatialJoin3DSide *side = &join->parts[p].side[s];
+
+				if (largest == NULL || side->buf.len > largest->buf.len)
+					largest = side;
+			}
+		}
+		if (largest->buf.len == 0)
+			break;
+		spatialjoin3D_flush(join, largest);
+	}
+}
+
+static void
+spatialjoin3D_append(SpatialJoin3D *join, SpatialJoin3DSide *side,
+	SpatialJoin3DEntry *entry, char *value)
+{
+	Size		size = SPATIALJOIN3D_ENTRYSZ(entry->len);
+
+	if ((Size) side->buf.len + size >= MaxAllocSize / 2)
+		spatialjoin3D_flush(join, side);
+
+	enlargeStringInfo(&side->buf, size);
+	memset(side->buf.data + side->buf.len, 0, size);
+	memcpy(side->buf.data + side->buf.len, entry, sizeof(SpatialJoin3DEntry));
+	memcpy(side->buf.data + side->buf.len + SPATIALJOIN3D_HDRSZ, value,
+		entry->len);
+	side->buf.len += size;
+	side->nentries++;
+	join->instr.nentries++;
+
+	join->membytes += size;
+	if (join->membytes > join->maxbytes)
+		spatialjoin3D_spill(join);
+}
+
+
+/*****************************************************************************
+ * Join
+ *****************************************************************************/
+
+/*
+ * Add the bounding box and the size of an object to the statistics of an
+ * input
+ */
+void
+spatialjoin3D_stats_add(SpatialJoin3DStats *stats, Box3D *box, double size)
+{
+	stats->count++;
+	if (stats->count == 1)
+		stats->extent = *box;
+	else
+	{
+		stats->extent.low.x = Min(stats->extent.low.x, box->low.x);
+		stats->extent.low.y = Min(stats->extent.low.y, box->low.y);
+		stats->extent.low.z = Min(stats->extent.low.z, box->low.z);
+		stats->extent.high.x = Max(stats->extent.high.x, box->high.x);
+		stats->extent.high.y = Max(stats->extent.high.y, box->high.y);
+		stats->extent.high.z = Max(stats->extent.high.z, box->high.z);
+	}
+	stats->avgdim[0] += (box->high.x - box->low.x - stats->avgdim[0]) / stats->count;
+	stats->avgdim[1] += (box->high.y - box->low.y - stats->avgdim[1]) / stats->count;
+	stats->avgdim[2] += (box->high.z - box->low.z - stats->avgdim[2]) / stats->count;
+	stats->avgsize += (size - stats->avgsize) / stats->count;
+}
+
+/*
+ * Create the join of two inputs with the given statistics, using maxbytes
+ * of memory, where emit is called with arg for each candidate pair. Return
+ * NULL if no pair of objects can match.
+ */
+SpatialJoin3D *
+spatialjoin3D_create(SpatialJoin3DStats *stats1, SpatialJoin3DStats *stats2,
+	Size maxbytes, SpatialJoin3DEmit emit, void *arg)
+{
+	MemoryContext context,
+				oldcontext;
+	SpatialJoin3D *join;
+	SpatialJoin3DGrid *grid;
+	double		avgdim[3],
+				bytes;
+	int32		p;
+	int			i;
+
+	/* Only the intersection of the extents can contain matching pairs */
+	if (stats1->count == 0 || stats2->count == 0 ||
+		!inter_box3D_box3D(&stats1->extent, &stats2->extent))
+		return NULL;
+
+	context = AllocSetContextCreate(CurrentMemoryContext,
+		"spatialjoin3D", ALLOCSET_DEFAULT_SIZES);
+	oldcontext = MemoryContextSwitchTo(context);
+	join = (SpatialJoin3D *) palloc0(sizeof(SpatialJoin3D));
+	join->context = context;
+	join->maxbytes = maxbytes;
+	join->emit = emit;
+	join->arg = arg;
+
+	grid = &join->grid;
+	grid->region.low.x = Max(stats1->extent.low.x, stats2->extent.low.x) - EPSILON;
+	grid->region.low.y = Max(stats1->extent.low.y, stats2->extent.low.y) - EPSILON;
+	grid->region.low.z = Max(stats1->extent.low.z, stats2->extent.low.z) - EPSILON;
+	grid->region.high.x = Min(stats1->extent.high.x, stats2->extent.high.x) + EPSILON;
+	grid->region.high.y = Min(stats1->extent.high.y, stats2->extent.high.y) + EPSILON;
+	grid->region.high.z = Min(stats1->extent.high.z, stats2->extent.high.z) + EPSILON;
+
+	/* Half of the memory for the two sides of a partition being joined */
+	bytes = stats1->count * (SPATIALJOIN3D_HDRSZ + MAXALIGN(stats1->avgsize) +
+		sizeof(SpatialJoin3DEntry *)) +
+		stats2->count * (SPATIALJOIN3D_HDRSZ + MAXALIGN(stats2->avgsize) +
+		sizeof(SpatialJoin3DEntry *));
+	grid->nparts = (int32) Min(ceil(bytes / (maxbytes / 2)), SPATIALJOIN3D_MAXPARTS);
+	grid->nparts = Max(grid->nparts, 1);
+	for (i = 0; i < 3; i++)
+		avgdim[i] = Max(stats1->avgdim[i], stats2->avgdim[i]);
+	spatialjoin3D_make_grid(grid,
+		Max((double) grid->nparts * SPATIALJOIN3D_TILES_PER_PART,
+			(double) (stats1->count + stats2->count) / SPATIALJOIN3D_OBJS_PER_TILE),
+		avgdim);
+
+	join->parts = (SpatialJoin3DPart *) palloc0(sizeof(SpatialJoin3DPart) * grid->nparts);
+	join->marks = (int64 *) palloc0(sizeof(int64) * grid->nparts);
+	for (p = 0; p < grid->nparts; p++)
+	{
+		for (i = 0; i < 2; i++)
+			initStringInfo(&join->parts[p].side[i].buf);
+	}
+	join->instr.nparts = grid->nparts;
+	join->instr.ntiles = (int64) grid->ntiles[0] * grid->ntiles[1] * grid->ntiles[2];
+	MemoryContextSwitchTo(oldcontext);
+	return join;
+}
+
+/*
+ * Copy an object of the side 0 or 1 of the join into the partitions of the
+ * tiles overlapped by its box. The tid may be NULL. The box is enlarged by
+ * EPSILON since the boxes are compared with FPle.
+ */
+void
+spatialjoin3D_add(SpatialJoin3D *join, int side, ItemPointer tid,
+	char *value, int32 len, Box3D *box)
+{
+	SpatialJoin3DGrid *grid = &join->grid;
+	SpatialJoin3DEntry entry;
+	MemoryContext oldcontext;
+	int64		seq;
+	int32		lo[3],
+				hi[3],
+				tx,
+				ty,
+				tz;
+	double		ntiles;
+
+	if (!FPle(grid->region.low.x, box->high.x) || !FPle(box->low.x, grid->region.high.x) ||
+		!FPle(grid->region.low.y, box->high.y) || !FPle(box->low.y, grid->region.high.y) ||
+		!FPle(grid->region.low.z, box->high.z) || !FPle(box->low.z, grid->region.high.z))
+		return;
+
+	lo[0] = spatialjoin3D_tile(box->low.x - EPSILON, grid->region.low.x, grid->tilesize[0], grid->ntiles[0]);
+	lo[1] = spatialjoin3D_tile(box->low.y - EPSILON, grid->region.low.y, grid->tilesize[1], grid->ntiles[1]);
+	lo[2] = spatialjoin3D_tile(box->low.z - EPSILON, grid->region.low.z, grid->tilesize[2], grid->ntiles[2]);
+	hi[0] = spatialjoin3D_tile(box->high.x + EPSILON, grid->region.low.x, grid->tilesize[0], grid->ntiles[0]);
+	hi[1] = spatialjoin3D_tile(box->high.y + EPSILON, grid->region.low.y, grid->tilesize[1], grid->ntiles[1]);
+	hi[2] = spatialjoin3D_tile(box->high.z + EPSILON, grid->region.low.z, grid->tilesize[2], grid->ntiles[2]);
+
+	entry.box = *box;
+	if (tid != NULL)
+		entry.tid = *tid;
+	else
+		ItemPointerSetInvalid(&entry.tid);
+	entry.len = len;
+	seq = ++join->seq;
+
+	oldcontext = MemoryContextSwitchTo(join->context);
+	ntiles = (double) (hi[0] - lo[0] + 1) * (hi[1] - lo[1] + 1) * (hi[2] - lo[2] + 1);
+	if (ntiles >= (double) grid->nparts * SPATIALJOIN3D_TILES_PER_PART)
+	{
+		/* Large objects are copied to all partitions without looking at the tiles */
+		int32		p;
+
+		for (p = 0; p < grid->nparts; p++)
+			spatialjoin3D_append(join, &join->parts[p].side[side], &entry, value);
+	}
+	else
+	{
+		for (tx = lo[0]; tx <= hi[0]; tx++)
+			for (ty = lo[1]; ty <= hi[1]; ty++)
+				for (tz = lo[2]; tz <= hi[2]; tz++)
+				{
+					int32		p = spatialjoin3D_part(grid, tx, ty, tz);
+
+					if (join->marks[p] == seq)
+						continue;
+					join->marks[p] = seq;
+					spatialjoin3D_append(join, &join->parts[p].side[side], &entry, value);
+				}
+	}
+	MemoryContextSwitchTo(oldcontext);
+}
+
+static int
+spatialjoin3D_cmp(const void *a, const void *b)
+{
+	double		xa = (*(SpatialJoin3DEntry * const *) a)->box.low.x;
+	double		xb = (*(SpatialJoin3DEntry * const *) b)->box.low.x;
+
+	return (xa < xb) ? -1 : (xa > xb) ? 1 : 0;
+}
+
+/*
+ * Read the entries of the side into memory and return them sorted on the
+ * low x coordinate of their box
+ */
+static SpatialJoin3DEntry **
+spatialjoin3D_load(SpatialJoin3DSide *side)
+{
+	Size		total = side->filebytes + side->buf.len;
+	char	   *data = (char *) MemoryContextAllocHuge(CurrentMemoryContext,
+		Max(total, 1));
+	SpatialJoin3DEntry **entries;
+	char	   *ptr = data;
+	int64		i;
+
+	if (side->file != NULL)
+	{
+		if (BufFileSeek(side->file, 0, 0, SEEK_SET) != 0)
+			ereport(ERROR,
+					(errcode_for_file_access(),
+					 errmsg("could not rewind spatialjoin3D temporary file: %m")));
+		spatialjoin3D_read(side->file, data, side->filebytes);
+		BufFileClose(side->file);
+		side->file = NULL;
+	}
+	memcpy(data + side->filebytes, side->buf.data, side->buf.len);
+
+	entries = (SpatialJoin3DEntry **) MemoryContextAllocHuge(CurrentMemoryContext,
+		sizeof(SpatialJoin3DEntry *) * Max(side->nentries, 1));
+	for (i = 0; i < side->nentries; i++)
+	{
+		entries[i] = (SpatialJoin3DEntry *) ptr;
+		ptr += SPATIALJOIN3D_ENTRYSZ(entries[i]->len);
+	}
+	qsort(entries, side->nentries, sizeof(SpatialJoin3DEntry *), spatialjoin3D_cmp);
+	return entries;
+}
+
+/*
+ * Emit the pair if the boxes intersect and the pair belongs to the
+ * partition. The boxes are known to intersect on x.
+ */
+static void
+spatialjoin3D_test(SpatialJoin3D *join, int32 p, SpatialJoin3DEntry *r,
+	SpatialJoin3DEntry *s)
+{
+	if (!FPle(r->box.low.y, s->box.high.y) || !FPle(s->box.low.y, r->box.high.y) ||
+		!FPle(r->box.low.z, s->box.high.z) || !FPle(s->box.low.z, r->box.high.z))
+		return;
+	if (spatialjoin3D_point_part(&join->grid,
+			Max(r->box.low.x, s->box.low.x), Max(r->box.low.y, s->box.low.y),
+			Max(r->box.low.z, s->box.low.z)) != p)
+		return;
+
+	join->instr.ncandidates++;
+	join->emit(join->arg, r, s);
+}
+
+/* Join the two sides of the partition with a plane sweep on x */
+static void
+spatialjoin3D_sweep(SpatialJoin3D *join, int32 p)
+{
+	SpatialJoin3DPart *part = &join->parts[p];
+	SpatialJoin3DEntry **r,
+			  **s;
+	int64		nr = part->side[0].nentries,
+				ns = part->side[1].nentries,
+				i = 0,
+				j = 0,
+				k;
+
+	if (nr == 0 || ns == 0)
+		return;
+	r = spatialjoin3D_load(&part->side[0]);
+	s = spatialjoin3D_load(&part->side[1]);
+
+	while (i < nr && j < ns)
+	{
+		if (r[i]->box.low.x <= s[j]->box.low.x)
+		{
+			for (k = j; k < ns && FPle(s[k]->box.low.x, r[i]->box.high.x); k++)
+				spatialjoin3D_test(join, p, r[i], s[k]);
+			i++;
+		}
+		else
+		{
+			for (k = i; k < nr && FPle(r[k]->box.low.x, s[j]->box.high.x); k++)
+				spatialjoin3D_test(join, p, r[k], s[j]);
+			j++;
+		}
+		CHECK_FOR_INTERRUPTS();
+	}
+}
+
+/* Join the partitions once all the objects have been added */
+void
+spatialjoin3D_run(SpatialJoin3D *join)
+{
+	MemoryContext oldcontext;
+	int32		p;
+	int			i;
+
+	for (p = 0; p < join->grid.nparts; p++)
+	{
+		MemoryContext partcontext = AllocSetContextCreate(join->context,
+			"spatialjoin3D partition", ALLOCSET_DEFAULT_SIZES);
+
+		for (i = 0; i < 2; i++)
+		{
+			if (join->parts[p].side[i].file != NULL)
+				join->instr.nfiles++;
+		}
+		oldcontext = MemoryContextSwitchTo(partcontext);
+		spatialjoin3D_sweep(join, p);
+		MemoryContextSwitchTo(oldcontext);
+		MemoryContextDelete(partcontext);
+		for (i = 0; i < 2; i++)
+		{
+			SpatialJoin3DSide *side = &join->parts[p].side[i];
+
+			if (side->file != NULL)
+				BufFileClose(side->file);
+			side->file = NULL;
+			pfree(side->buf.data);
+			initStringInfo(&side->buf);
+			side->filebytes = 0;
+			side->nentries = 0;
+		}
+	}
+}
+
+/*
+ * Release the join, copying its counters into instr if it is not NULL.
+ * The join may be NULL if it was not created.
+ */
+void
+spatialjoin3D_free(SpatialJoin3D *join, SpatialJoin3DInstr *instr)
+{
+	int32		p;
+	int			i;
+
+	if (instr != NULL)
+	{
+		if (join != NULL)
+			*instr = join->instr;
+		else
+			memset(instr, 0, sizeof(SpatialJoin3DInstr));
+	}
+	if (join == NULL)
+		return;
+	for (p = 0; p < join->grid.nparts; p++)
+	{
+		for (i = 0; i < 2; i++)
+		{
+			if (join->parts[p].side[i].file != NULL)
+				BufFileClose(join->parts[p].side[i].file);
+		}
+	}
+	MemoryContextDelete(join->context);
+}
+
+/* Can the join evaluate the operator? */
+bool
+spatialjoin3D_operator(const char *opname)
+{
+	int			i;
+
+	for (i = 0; spatialjoin3D_operators[i] != NULL; i++)
+	{
+		if (strcmp(opname, spatialjoin3D_operators[i]) == 0)
+			return true;
+	}
+	return false;
+}
+
+/*****************************************************************************
+ * SQL function
+ *****************************************************************************/
+
+/*
+ * Return the query reading the column of the relation, whose columns are
+ * given by fmt
+ */
+static char *
+spatialjoin3D_query(const char *fmt, Oid relid, const char *colname)
+{
+	const char *col = quote_identifier(colname);
+	char	   *rel = quote_qualified_identifier(
+		get_namespace_name(get_rel_namespace(relid)), get_rel_name(relid));
+	StringInfoData query;
+
+	initStringInfo(&query);
+	appendStringInfo(&query, fmt, col, col);
+	appendStringInfo(&query, " FROM %s WHERE %s IS NOT NULL", rel, col);
+	return query.data;
+}
+
+static double
+spatialjoin3D_getfloat8(int col, double def)
+{
+	bool		isnull;
+	Datum		value = SPI_getbinval(SPI_tuptable->vals[0],
+		SPI_tuptable->tupdesc, col, &isnull);
+
+	return isnull ? def : DatumGetFloat8(value);
+}
+
+static void
+spatialjoin3D_stats(SpatialJoin3DStats *stats, Oid relid, const char *colname)
+{
+	char	   *rows = spatialjoin3D_query(
+		"SELECT boundbox(%s)::Box3D AS b, pg_column_size(%s) AS s", relid, colname);
+	StringInfoData query;
+	bool		isnull;
+	Datum		value;
+
+	initStringInfo(&query);
+	appendStringInfo(&query, "SELECT count(*), extent3D(b), avg(width(b)), "
+		"avg(height(b)), avg(depth(b)), avg(s)::float8 FROM (%s) AS t", rows);
+	if (SPI_execute(query.data, true, 1) != SPI_OK_SELECT || SPI_processed != 1)
+		elog(ERROR, "spatialjoin3D: could not compute the statistics of relation \"%s\"",
+			get_rel_name(relid));
+
+	memset(stats, 0, sizeof(SpatialJoin3DStats));
+	stats->count = DatumGetInt64(SPI_getbinval(SPI_tuptable->vals[0],
+		SPI_tuptable->tupdesc, 1, &isnull));
+	value = SPI_getbinval(SPI_tuptable->vals[0], SPI_tuptable->tupdesc, 2, &isnull);
+	if (!isnull)
+		stats->extent = *DatumGetBox3DP(value);
+	stats->avgdim[0] = spatialjoin3D_getfloat8(3, 0.0);
+	stats->avgdim[1] = spatialjoin3D_getfloat8(4, 0.0);
+	stats->avgdim[2] = spatialjoin3D_getfloat8(5, 0.0);
+	stats->avgsize = spatialjoin3D_getfloat8(6, 0.0);
+	SPI_freetuptable(SPI_tuptable);
+	pfree(query.data);
+	pfree(rows);
+}
+
+/* Copy the objects of an input into the partitions */
+static void
+spatialjoin3D_scan(SpatialJoin3D *join, int s, Oid relid,
+	const char *colname, int16 typlen)
+{
+	char	   *query = spatialjoin3D_query("SELECT ctid, %s, boundbox(%s)::Box3D",
+		relid, colname);
+	Portal		portal;
+	uint64		i;
+
+	portal = SPI_cursor_open_with_args(NULL, query, 0, NULL, NULL, NULL, true, 0);
+	for (;;)
+	{
+		SPI_cursor_fetch(portal, true, SPATIALJOIN3D_BATCH);
+		if (SPI_processed == 0)
+			break;
+		for (i = 0; i < SPI_processed; i++)
+		{
+			HeapTuple	tuple = SPI_tuptable->vals[i];
+			TupleDesc	tupdesc = SPI_tuptable->tupdesc;
+			bool		isnull;
+			ItemPointer tid = DatumGetItemPointer(SPI_getbinval(tuple, tupdesc, 1, &isnull));
+			Datum		value = SPI_getbinval(tuple, tupdesc, 2, &isnull);
+			Box3D	   *box = DatumGetBox3DP(SPI_getbinval(tuple, tupdesc, 3, &isnull));
+			char	   *ptr;
+
+			if (typlen == -1)
+			{
+				ptr = (char *) PG_DETOAST_DATUM(value);
+				spatialjoin3D_add(join, s, tid, ptr, VARSIZE(ptr), box);
+			}
+			else
+			{
+				ptr = DatumGetPointer(value);
+				spatialjoin3D_add(join, s, tid, ptr, typlen, box);
+			}
+			if (ptr != DatumGetPointer(value))
+				pfree(ptr);
+		}
+		SPI_freetuptable(SPI_tuptable);
+		CHECK_FOR_INTERRUPTS();
+	}
+	SPI_cursor_close(portal);
+	pfree(query);
+}
+
+/* Return the ctids of the candidate pair if the operator holds */
+static void
+spatialjoin3D_emit(void *arg, SpatialJoin3DEntry *r, SpatialJoin3DEntry *s)
+{
+	SpatialJoin3DFuncState *state = (SpatialJoin3DFuncState *) arg;
+	MemoryContext oldcontext;
+	Datum		values[2];
+	bool		nulls[2] = {false, false};
+	bool		match;
+
+	oldcontext = MemoryContextSwitchTo(state->predcontext);
+	match = DatumGetBool(FunctionCall2(&state->opfinfo,
+		PointerGetDatum(SPATIALJOIN3D_VALUE(r)),
+		PointerGetDatum(SPATIALJOIN3D_VALUE(s))));
+	MemoryContextSwitchTo(oldcontext);
+	MemoryContextReset(state->predcontext);
+	if (!match)
+		return;
+
+	values[0] = ItemPointerGetDatum(&r->tid);
+	values[1] = ItemPointerGetDatum(&s->tid);
+	tuplestore_putvalues(state->tupstore, state->tupdesc, values, nulls);
+}
+
+static void
+spatialjoin3D_column(Oid relid, const char *colname, Oid *typid, int16 *typlen)
+{
+	AttrNumber	attnum = get_attnum(relid, colname);
+	bool		typbyval;
+
+	if (attnum == InvalidAttrNumber)
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_COLUMN),
+				 errmsg("column \"%s\" of relation \"%s\" does not exist",
+					colname, get_rel_name(relid))));
+	*typid = get_atttype(relid, attnum);
+	get_typlenbyval(*typid, typlen, &typbyval);
+	if (typbyval || *typlen < -1)
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("spatialjoin3D does not support columns of type %s",
+					format_type_be(*typid))));
+}
+
+/*
+ * Set up the materialized result of the set-returning function
+ */
+static void
+spatialjoin3D_materialize(FunctionCallInfo fcinfo, Tuplestorestate **tupstore,
+	TupleDesc *tupdesc)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	MemoryContext oldcontext;
+	TupleDesc	desc;
+
+	if (rsinfo == NULL || !IsA(rsinfo, ReturnSetInfo) ||
+		!(rsinfo->allowedModes & SFRM_Materialize))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("set-valued function called in context that cannot accept a set")));
+	if (get_call_result_type(fcinfo, NULL, &desc) != TYPEFUNC_COMPOSITE)
+		elog(ERROR, "return type must be a row type");
+
+	oldcontext = MemoryContextSwitchTo(rsinfo->econtext->ecxt_per_query_memory);
+	*tupdesc = CreateTupleDescCopy(desc);
+	*tupstore = tuplestore_begin_heap(
+		(rsinfo->allowedModes & SFRM_Materialize_Random) != 0, false, work_mem);
+	rsinfo->returnMode = SFRM_Materialize;
+	rsinfo->setResult = *tupstore;
+	rsinfo->setDesc = *tupdesc;
+	MemoryContextSwitchTo(oldcontext);
+}
+
+/*
+ * spatialjoin3D: Return the ctids of the pairs of rows of the relations in
+ * arguments 0 and 2 whose columns in arguments 1 and 3 satisfy the operator
+ * in argument 4
+ */
+Datum
+spatialjoin3D(PG_FUNCTION_ARGS)
+{
+	Oid			relid[2];
+	char	   *colname[2];
+	char	   *opname = text_to_cstring(PG_GETARG_TEXT_PP(4));
+	Oid			typid[2];
+	int16		typlen[2];
+	Oid			opno;
+	SpatialJoin3DFuncState state;
+	SpatialJoin3DStats stats[2];
+	SpatialJoin3D *join;
+	int			i;
+
+	for (i = 0; i < 2; i++)
+	{
+		relid[i] = PG_GETARG_OID(2 * i);
+		colname[i] = text_to_cstring(PG_GETARG_TEXT_PP(2 * i + 1));
+		spatialjoin3D_column(relid[i], colname[i], &typid[i], &typlen[i]);
+	}
+
+	if (!spatialjoin3D_operator(opname))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("spatialjoin3D does not support operator %s", opname),
+				 errhint("Supported operators are &&, @>, <@, ~=, and ?#.")));
+	opno = OpernameGetOprid(list_make1(makeString(opname)), typid[0], typid[1]);
+	if (!OidIsValid(opno))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_FUNCTION),
+				 errmsg("operator does not exist: %s %s %s",
+					format_type_be(typid[0]), opname, format_type_be(typid[1]))));
+
+	memset(&state, 0, sizeof(SpatialJoin3DFuncState));
+	spatialjoin3D_materialize(fcinfo, &state.tupstore, &state.tupdesc);
+
+	state.predcontext = AllocSetContextCreate(CurrentMemoryContext,
+		"spatialjoin3D predicate", ALLOCSET_DEFAULT_SIZES);
+	fmgr_info(get_opcode(opno), &state.opfinfo);
+
+	if (SPI_connect() != SPI_OK_CONNECT)
+		elog(ERROR, "spatialjoin3D: SPI_connect failed");
+
+	for (i = 0; i < 2; i++)
+		spatialjoin3D_stats(&stats[i], relid[i], colname[i]);
+	join = spatialjoin3D_create(&stats[0], &stats[1], (Size) work_mem * 1024L,
+		spatialjoin3D_emit, &state);
+	if (join != NULL)
+	{
+		for (i = 0; i < 2; i++)
+			spatialjoin3D_scan(join, i, relid[i], colname[i], typlen[i]);
+		spatialjoin3D_run(join);
+		spatialjoin3D_free(join, NULL);
+	}
+
+	SPI_finish();
+	MemoryContextDelete(state.predcontext);
+	return (Datum) 0;
+}
+
+PG_FUNCTION_INFO_V1(spatialjoin3D);
+
+/*****************************************************************************
+ * kNN join
+ *****************************************************************************/
+
+/* Squared minimum distance between the boxes */
+static inline double
+knnjoin3D_boxdist2(Box3D *a, Box3D *b)
+{
+	double		dx = Max(Max(a->low.x - b->high.x, b->low.x - a->high.x), 0.0),
+				dy = Max(Max(a->low.y - b->high.y, b->low.y - a->high.y), 0.0),
+				dz = Max(Max(a->low.z - b->high.z, b->low.z - a->high.z), 0.0);
+
+	return dx * dx + dy * dy + dz * dz;
+}
+
+/* Can an object at the squared distance dist2 be closer than bound? */
+static inline bool
+knnjoin3D_within(double dist2, double bound)
+{
+	return isinf(bound) || dist2 <= (bound + EPSILON) * (bound + EPSILON);
+}
+
+static inline double
+knnjoin3D_center(Box3D *box, int axis)
+{
+	switch (axis)
+	{
+		case 0:
+			return (box->low.x + box->high.x) / 2.0;
+		case 1:
+			return (box->low.y + box->high.y) / 2.0;
+		default:
+			return (box->low.z + box->high.z) / 2.0;
+	}
+}
+
+static int
+knnjoin3D_object_cmp(const void *a, const void *b, void *arg)
+{
+	double		ca = knnjoin3D_center(&((KnnJoin3DObject *) a)->box, *(int *) arg);
+	double		cb = knnjoin3D_center(&((KnnJoin3DObject *) b)->box, *(int *) arg);
+
+	return (ca < cb) ? -1 : (ca > cb) ? 1 : 0;
+}
+
+static void
+knnjoin3D_union(Box3D *box, Box3D *other)
+{
+	box->low.x = Min(box->low.x, other->low.x);
+	box->low.y = Min(box->low.y, other->low.y);
+	box->low.z = Min(box->low.z, other->low.z);
+	box->high.x = Max(box->high.x, other->high.x);
+	box->high.y = Max(box->high.y, other->high.y);
+	box->high.z = Max(box->high.z, other->high.z);
+}
+
+/*
+ * Build the subtree of the objects from start to end, splitting them at the
+ * median of the centers along the longest side of their box, and return
+ * the number of its root
+ */
+static int32
+knnjoin3D_build(KnnJoin3DState *state, int32 start, int32 end)
+{
+	KnnJoin3DNode *node;
+	Box3D		box = state->objects[start].box;
+	int32		n,
+				i;
+
+	for (i = start + 1; i < end; i++)
+		knnjoin3D_union(&box, &state->objects[i].box);
+	if (state->nnodes == state->maxnodes)
+	{
+		state->maxnodes *= 2;
+		state->nodes = (KnnJoin3DNode *) repalloc_huge(state->nodes,
+			sizeof(KnnJoin3DNode) * state->maxnodes);
+	}
+	n = state->nnodes++;
+	node = &state->nodes[n];
+	node->box = box;
+	node->start = start;
+	node->end = end;
+	node->left = node->right = -1;
+
+	if (end - start > KNNJOIN3D_LEAF)
+	{
+		double		width = box.high.x - box.low.x,
+					height = box.high.y - box.low.y,
+					depth = box.high.z - box.low.z;
+		int			axis = (width >= height && width >= depth) ? 0 :
+						(height >= depth) ? 1 : 2;
+		int32		mid = start + (end - start) / 2,
+					left,
+					right;
+
+		qsort_arg(&state->objects[start], end - start, sizeof(KnnJoin3DObject),
+			knnjoin3D_object_cmp, &axis);
+		left = knnjoin3D_build(state, start, mid);
+		right = knnjoin3D_build(state, mid, end);
+		/* The array of nodes may have been moved */
+		state->nodes[n].left = left;
+		state->nodes[n].right = right;
+	}
+	return n;
+}
+
+/* Add the neighbour to the max-heap of the query if it is among the k nearest */
+static void
+knnjoin3D_add_neighbor(KnnJoin3DState *state, KnnJoin3DQuery *query,
+	int32 object, double dist)
+{
+	KnnJoin3DNeighbor *heap = query->neighbors;
+	int32		i,
+				child;
+
+	if (query->nneighbors < state->k)
+	{
+		/* Sift up the new neighbour */
+		i = query->nneighbors++;
+		while (i > 0 && heap[(i - 1) / 2].dist < dist)
+		{
+			heap[i] = heap[(i - 1) / 2];
+			i = (i - 1) / 2;
+		}
+		heap[i].dist = dist;
+		heap[i].object = object;
+		return;
+	}
+	if (dist >= heap[0].dist)
+		return;
+
+	/* Replace the farthest neighbour and sift it down */
+	i = 0;
+	while ((child = 2 * i + 1) < query->nneighbors)
+	{
+		if (child + 1 < query->nneighbors && heap[child + 1].dist > heap[child].dist)
+			child++;
+		if (heap[child].dist <= dist)
+			break;
+		heap[i] = heap[child];
+		i = child;
+	}
+	heap[i].dist = dist;
+	heap[i].object = object;
+}
+
+/*
+ * Bound of the distance to the k-th neighbour of the query, which is
+ * infinite while it has fewer neighbours and no bound from the seeds
+ */
+static inline double
+knnjoin3D_kth(KnnJoin3DState *state, KnnJoin3DQuery *query)
+{
+	return (query->nneighbors < state->k) ? query->seedbound :
+		Min(query->neighbors[0].dist, query->seedbound);
+}
+
+/* Squared maximum distance between the boxes */
+static inline double
+knnjoin3D_boxmaxdist2(Box3D *a, Box3D *b)
+{
+	double		dx = Max(a->high.x - b->low.x, b->high.x - a->low.x),
+				dy = Max(a->high.y - b->low.y, b->high.y - a->low.y),
+				dz = Max(a->high.z - b->low.z, b->high.z - a->low.z);
+
+	return dx * dx + dy * dy + dz * dz;
+}
+
+static int
+knnjoin3D_double_cmp(const void *a, const void *b)
+{
+	double		da = *(const double *) a;
+	double		db = *(const double *) b;
+
+	return (da < db) ? -1 : (da > db) ? 1 : 0;
+}
+
+/*
+ * Bound the k-th distance of the query by the k-th smallest maximum
+ * distance to the boxes of the neighbours of the last row searched, which
+ * is close to the query in Hilbert order
+ */
+static double
+knnjoin3D_seed(KnnJoin3DState *state, KnnJoin3DQuery *query)
+{
+	int32		i;
+
+	if (state->nseeds < state->k)
+		return get_float8_infinity();
+	for (i = 0; i < state->nseeds; i++)
+		state->seeddists[i] = knnjoin3D_boxmaxdist2(&query->box,
+			&state->objects[state->seeds[i]].box);
+	qsort(state->seeddists, state->nseeds, sizeof(double), knnjoin3D_double_cmp);
+	return sqrt(state->seeddists[state->k - 1]);
+}
+
+/*
+ * Search the subtree for the neighbours of the query, visiting the nearest
+ * child first
+ */
+static void
+knnjoin3D_visit(KnnJoin3DState *state, KnnJoin3DQuery *query, int32 n)
+{
+	KnnJoin3DNode *node = &state->nodes[n];
+	int32		i;
+
+	if (!knnjoin3D_within(knnjoin3D_boxdist2(&query->box, &node->box),
+			knnjoin3D_kth(state, query)))
+		return;
+
+	if (node->left >= 0)
+	{
+		int32		first = node->left,
+					second = node->right;
+
+		if (knnjoin3D_boxdist2(&query->box, &state->nodes[second].box) <
+			knnjoin3D_boxdist2(&query->box, &state->nodes[first].box))
+		{
+			first = node->right;
+			second = node->left;
+		}
+		knnjoin3D_visit(state, query, first);
+		knnjoin3D_visit(state, query, second);
+		return;
+	}
+
+	for (i = node->start; i < node->end; i++)
+	{
+		KnnJoin3DObject *object = &state->objects[i];
+		MemoryContext oldcontext;
+		double		dist;
+
+		if (!knnjoin3D_within(knnjoin3D_boxdist2(&query->box, &object->box),
+				knnjoin3D_kth(state, query)))
+			continue;
+		oldcontext = MemoryContextSwitchTo(state->distcontext);
+		dist = DatumGetFloat8(FunctionCall2(&state->distfinfo, query->value,
+			object->value));
+		MemoryContextSwitchTo(oldcontext);
+		MemoryContextReset(state->distcontext);
+		knnjoin3D_add_neighbor(state, query, i, dist);
+	}
+}
+
+static int
+knnjoin3D_neighbor_cmp(const void *a, const void *b)
+{
+	double		da = ((KnnJoin3DNeighbor *) a)->dist;
+	double		db = ((KnnJoin3DNeighbor *) b)->dist;
+
+	return (da < db) ? -1 : (da > db) ? 1 : 0;
+}
+
+/* Return the neighbours of the query by increasing distance */
+static void
+knnjoin3D_search(KnnJoin3DState *state, KnnJoin3DQuery *query)
+{
+	Datum		values[3];
+	bool		nulls[3] = {false, false, false};
+	int32		i;
+
+	query->nneighbors = 0;
+	query->seedbound = knnjoin3D_seed(state, query);
+	knnjoin3D_visit(state, query, 0);
+
+	qsort(query->neighbors, query->nneighbors, sizeof(KnnJoin3DNeighbor),
+		knnjoin3D_neighbor_cmp);
+	for (i = 0; i < query->nneighbors; i++)
+	{
+		values[0] = ItemPointerGetDatum(&query->tid);
+		values[1] = ItemPointerGetDatum(&state->objects[query->neighbors[i].object].tid);
+		values[2] = Float8GetDatum(query->neighbors[i].dist);
+		tuplestore_putvalues(state->tupstore, state->tupdesc, values, nulls);
+	}
+
+	/* The neighbours of the query seed the next one */
+	state->nseeds = query->nneighbors;
+	for (i = 0; i < query->nneighbors; i++)
+		state->seeds[i] = query->neighbors[i].object;
+}
+
+/* Read the objects of the inner relation and build their tree */
+static void
+knnjoin3D_load(KnnJoin3DState *state, Oid relid, const char *colname,
+	int16 typlen)
+{
+	char	   *query = spatialjoin3D_query("SELECT ctid, %s, boundbox(%s)::Box3D",
+		relid, colname);
+	int32		maxobjects = 1024;
+	Portal		portal;
+	uint64		i;
+
+	state->objects = (KnnJoin3DObject *) palloc(sizeof(KnnJoin3DObject) * maxobjects);
+	portal = SPI_cursor_open_with_args(NULL, query, 0, NULL, NULL, NULL, true, 0);
+	for (;;)
+	{
+		SPI_cursor_fetch(portal, true, SPATIALJOIN3D_BATCH);
+		if (SPI_processed == 0)
+			break;
+		for (i = 0; i < SPI_processed; i++)
+		{
+			HeapTuple	tuple = SPI_tuptable->vals[i];
+			TupleDesc	tupdesc = SPI_tuptable->tupdesc;
+			KnnJoin3DObject *object;
+			Datum		value;
+			bool		isnull;
+
+			if (state->nobjects == maxobjects)
+			{
+				if (maxobjects >= PG_INT32_MAX / 2)
+					ereport(ERROR,
+							(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+							 errmsg("too many rows in the inner relation of knnjoin3D")));
+				maxobjects *= 2;
+				state->objects = (KnnJoin3DObject *) repalloc_huge(state->objects,
+					sizeof(KnnJoin3DObject) * maxobjects);
+			}
+			object = &state->objects[state->nobjects++];
+			object->tid = *DatumGetItemPointer(SPI_getbinval(tuple, tupdesc, 1, &isnull));
+			object->box = *DatumGetBox3DP(SPI_getbinval(tuple, tupdesc, 3, &isnull));
+			/* Detoast the values once rather than at each distance */
+			value = SPI_getbinval(tuple, tupdesc, 2, &isnull);
+			object->value = (typlen == -1) ?
+				PointerGetDatum(PG_DETOAST_DATUM_COPY(value)) :
+				datumCopy(value, false, typlen);
+		}
+		SPI_freetuptable(SPI_tuptable);
+		CHECK_FOR_INTERRUPTS();
+	}
+	SPI_cursor_close(portal);
+	pfree(query);
+
+	if (state->nobjects > 0)
+	{
+		state->maxnodes = 2 * (state->nobjects / KNNJOIN3D_LEAF) + 1;
+		state->nodes = (KnnJoin3DNode *) palloc(sizeof(KnnJoin3DNode) * state->maxnodes);
+		knnjoin3D_build(state, 0, state->nobjects);
+	}
+}
+
+static int
+knnjoin3D_query_cmp(const void *a, const void *b)
+{
+	uint64		ka = ((KnnJoin3DQuery *) a)->key;
+	uint64		kb = ((KnnJoin3DQuery *) b)->key;
+
+	return (ka < kb) ? -1 : (ka > kb) ? 1 : 0;
+}
+
+/*
+ * Search the neighbours of the rows of the outer relation, sorting each
+ * batch in Hilbert order of the centers of their boxes in the extent of the
+ * batch so that consecutive rows are close to each other
+ */
+static void
+knnjoin3D_scan(KnnJoin3DState *state, Oid relid, const char *colname)
+{
+	char	   *query = spatialjoin3D_query("SELECT ctid, %s, boundbox(%s)::Box3D",
+		relid, colname);
+	KnnJoin3DQuery *queries = (KnnJoin3DQuery *) palloc(sizeof(KnnJoin3DQuery) *
+		KNNJOIN3D_BATCH);
+	KnnJoin3DNeighbor *neighbors = (KnnJoin3DNeighbor *) palloc(
+		sizeof(KnnJoin3DNeighbor) * state->k);
+	Portal		portal;
+	uint64		i;
+
+	state->seeds = (int32 *) palloc(sizeof(int32) * state->k);
+	state->seeddists = (double *) palloc(sizeof(double) * state->k);
+	state->nseeds = 0;
+	portal = SPI_cursor_open_with_args(NULL, query, 0, NULL, NULL, NULL, true, 0);
+	for (;;)
+	{
+		Box3D		extent;
+		double		scale[3];
+		int			j;
+
+		SPI_cursor_fetch(portal, true, KNNJOIN3D_BATCH);
+		if (SPI_processed == 0)
+			break;
+		for (i = 0; i < SPI_processed; i++)
+		{
+			HeapTuple	tuple = SPI_tuptable->vals[i];
+			TupleDesc	tupdesc = SPI_tuptable->tupdesc;
+			bool		isnull;
+
+			queries[i].tid = *DatumGetItemPointer(SPI_getbinval(tuple, tupdesc, 1, &isnull));
+			queries[i].value = SPI_getbinval(tuple, tupdesc, 2, &isnull);
+			queries[i].box = *DatumGetBox3DP(SPI_getbinval(tuple, tupdesc, 3, &isnull));
+			if (i == 0)
+				extent = queries[i].box;
+			else
+				knnjoin3D_union(&extent, &queries[i].box);
+		}
+
+		for (j = 0; j < 3; j++)
+		{
+			double		size = (j == 0) ? extent.high.x - extent.low.x :
+				(j == 1) ? extent.high.y - extent.low.y : extent.high.z - extent.low.z;
+
+			scale[j] = (size > 0.0) ? MORTON3D_MAXCELL / size : 0.0;
+		}
+		for (i = 0; i < SPI_processed; i++)
+			queries[i].key = hilbert3D_encode(
+				(uint32) ((knnjoin3D_center(&queries[i].box, 0) - extent.low.x) * scale[0]),
+				(uint32) ((knnjoin3D_center(&queries[i].box, 1) - extent.low.y) * scale[1]),
+				(uint32) ((knnjoin3D_center(&queries[i].box, 2) - extent.low.z) * scale[2]));
+		qsort(queries, SPI_processed, sizeof(KnnJoin3DQuery), knnjoin3D_query_cmp);
+
+		for (i = 0; i < SPI_processed; i++)
+		{
+			queries[i].neighbors = neighbors;
+			knnjoin3D_search(state, &queries[i]);
+			CHECK_FOR_INTERRUPTS();
+		}
+		SPI_freetuptable(SPI_tuptable);
+	}
+	SPI_cursor_close(portal);
+	pfree(neighbors);
+	pfree(queries);
+	pfree(query);
+}
+
+/*
+ * knnjoin3D: Return for each row of the relation in argument 0 the ctids of
+ * the k rows of the relation in argument 2, where k is given in argument 4,
+ * whose columns in arguments 1 and 3 are the nearest according to the <->
+ * operator, with their distance
+ */
+Datum
+knnjoin3D(PG_FUNCTION_ARGS)
+{
+	Oid			relid[2];
+	char	   *colname[2];
+	Oid			typid[2];
+	int16		typlen[2];
+	int32		k = PG_GETARG_INT32(4);
+	Oid			opno;
+	KnnJoin3DState state;
+	MemoryContext context,
+				oldcontext;
+	int			i;
+
+	for (i = 0; i < 2; i++)
+	{
+		relid[i] = PG_GETARG_OID(2 * i);
+		colname[i] = text_to_cstring(PG_GETARG_TEXT_PP(2 * i + 1));
+		spatialjoin3D_column(relid[i], colname[i], &typid[i], &typlen[i]);
+	}
+	if (k <= 0 || k > KNNJOIN3D_BATCH)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("number of neighbors must be between 1 and %d",
+					KNNJOIN3D_BATCH)));
+	opno = OpernameGetOprid(list_make1(makeString("<->")), typid[0], typid[1]);
+	if (!OidIsValid(opno))
+		ereport(ERROR,
+				(errcode(ERRCODE_UNDEFINED_FUNCTION),
+				 errmsg("operator does not exist: %s <-> %s",
+					format_type_be(typid[0]), format_type_be(typid[1]))));
+
+	memset(&state, 0, sizeof(KnnJoin3DState));
+	spatialjoin3D_materialize(fcinfo, &state.tupstore, &state.tupdesc);
+	state.k = k;
+	fmgr_info(get_opcode(opno), &state.distfinfo);
+	context = AllocSetContextCreate(CurrentMemoryContext,
+		"knnjoin3D", ALLOCSET_DEFAULT_SIZES);
+	state.distcontext = AllocSetContextCreate(CurrentMemoryContext,
+		"knnjoin3D distance", ALLOCSET_DEFAULT_SIZES);
+
+	if (SPI_connect() != SPI_OK_CONNECT)
+		elog(ERROR, "knnjoin3D: SPI_connect failed");
+	oldcontext = MemoryContextSwitchTo(context);
+	knnjoin3D_load(&state, relid[1], colname[1], typlen[1]);
+	if (state.nobjects > 0)
+		knnjoin3D_scan(&state, relid[0], colname[0]);
+	MemoryContextSwitchTo(oldcontext);
+	SPI_finish();
+
+	MemoryContextDelete(state.distcontext);
+	MemoryContextDelete(context);
+	return (Datum) 0;
+}
+
+PG_FUNCTION_INFO_V1(knnjoin3D);
+
+/*****************************************************************************/
@@ -0,0 +1,780 @@
+/*****************************************************************************
+ *
+ * geo3D_joinpath.c
+ *	  Custom scan provider for spatial joins of 3D relations
+ *
+ * Once the library is loaded, the planner is offered, for each inner join
+ * whose clauses compare a column of each input with an operator implying
+ * that the bounding boxes of its arguments intersect, e.g., a.geom &&
+ * b.geom, a custom path running the partition based spatial join of
+ * geo3D_join.c on the tuples of the cheapest paths of the inputs. Joins
+ * on a bounded distance, e.g., a.geom <-> b.geom < 2.0, which no other
+ * join method than a nested loop can evaluate, are offered the same path,
+ * the boxes of the inner input being expanded by the distance so that the
+ * grid replicates each inner object into the tiles of its neighbourhood,
+ * the exact distance being tested on the candidate pairs. The
+ * tuples of each input are staged in a tuplestore while the statistics of
+ * their boxes are gathered, which size the grid of the join, and then
+ * copied into its partitions. Each candidate pair is formed into a scan
+ * tuple on which the clauses of the join are evaluated. The path is costed
+ * from the estimated number of rows and width of the inputs and of the
+ * join, so that it competes with the nested loops with an inner GiST index
+ * scan that the planner would otherwise choose.
+ *
+ * Custom scans replacing joins need PostgreSQL 12 or later, where the
+ * provider is registered by _PG_init. The planner hook can be disabled
+ * with the configuration parameter geo3d.enable_pbsmjoin.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#if PG_VERSION_NUM >= 120000
+#include <math.h>
+
+#include <access/htup_details.h>
+#include <catalog/pg_type.h>
+#include <commands/explain.h>
+#include <executor/executor.h>
+#include <executor/tuptable.h>
+#include <miscadmin.h>
+#include <nodes/extensible.h>
+#include <nodes/makefuncs.h>
+#include <nodes/nodeFuncs.h>
+#include <nodes/pg_list.h>
+#include <nodes/value.h>
+#include <optimizer/cost.h>
+#include <optimizer/optimizer.h>
+#include <optimizer/pathnode.h>
+#include <optimizer/paths.h>
+#include <optimizer/restrictinfo.h>
+#include <optimizer/tlist.h>
+#include <parser/parse_func.h>
+#include <utils/guc.h>
+#include <utils/lsyscache.h>
+#include <utils/tuplestore.h>
+#endif
+#include "geo3D_decls.h"
+
+#if PG_VERSION_NUM >= 120000
+
+#define SPATIALJOIN3D_NAME		"SpatialJoin3D"
+
+/* Positions of the lists in the custom_private of the plan */
+#define SPATIALJOIN3D_PRIV_SIDES	0	/* input of each scan column */
+#define SPATIALJOIN3D_PRIV_ATTNOS	1	/* its attribute number in the input */
+#define SPATIALJOIN3D_PRIV_KEYS		2	/* attribute numbers of the keys */
+#define SPATIALJOIN3D_PRIV_FUNCS	3	/* boundbox functions of the keys */
+#define SPATIALJOIN3D_PRIV_DISTANCE	4	/* expansion of the inner boxes */
+
+static bool spatialjoin3D_enable_pbsmjoin = true;
+
+static set_join_pathlist_hook_type prev_set_join_pathlist_hook = NULL;
+
+typedef struct
+{
+	CustomScanState css;
+	int			natts;
+	int		   *sides;			/* input of each scan column */
+	AttrNumber *attnos;			/* its attribute number in the input */
+	AttrNumber	keys[2];
+	FmgrInfo	boundbox[2];
+	double		distance;		/* expansion of the inner boxes */
+	TupleTableSlot *slots[2];	/* tuples of the inputs in a candidate pair */
+	TupleTableSlot *resultslot;
+	Tuplestorestate *results;	/* scan tuples satisfying the clauses */
+	bool		built;
+	SpatialJoin3DInstr instr;
+} SpatialJoin3DScanState;
+
+static Plan *spatialjoin3D_plan(PlannerInfo *root, RelOptInfo *rel,
+	CustomPath *best_path, List *tlist, List *clauses, List *custom_plans);
+static Node *spatialjoin3D_create_state(CustomScan *cscan);
+static void spatialjoin3D_begin(CustomScanState *css, EState *estate, int eflags);
+static TupleTableSlot *spatialjoin3D_exec(CustomScanState *css);
+static void spatialjoin3D_end(CustomScanState *css);
+static void spatialjoin3D_rescan(CustomScanState *css);
+static void spatialjoin3D_explain(CustomScanState *css, List *ancestors,
+	ExplainState *es);
+
+static const CustomPathMethods spatialjoin3D_path_methods =
+{
+	SPATIALJOIN3D_NAME,
+	spatialjoin3D_plan
+};
+
+static const CustomScanMethods spatialjoin3D_scan_methods =
+{
+	SPATIALJOIN3D_NAME,
+	spatialjoin3D_create_state
+};
+
+static const CustomExecMethods spatialjoin3D_exec_methods =
+{
+	SPATIALJOIN3D_NAME,
+	spatialjoin3D_begin,
+	spatialjoin3D_exec,
+	spatialjoin3D_end,
+	spatialjoin3D_rescan,
+	NULL,						/* MarkPosCustomScan */
+	NULL,						/* RestrPosCustomScan */
+	NULL,						/* EstimateDSMCustomScan */
+	NULL,						/* InitializeDSMCustomScan */
+	NULL,						/* ReInitializeDSMCustomScan */
+	NULL,						/* InitializeWorkerCustomScan */
+	NULL,						/* ShutdownCustomScan */
+	spatialjoin3D_explain
+};
+
+/*****************************************************************************
+ * Planning
+ *****************************************************************************/
+
+/* Are all the expressions plain Vars? */
+static bool
+spatialjoin3D_vars_only(List *exprs)
+{
+	ListCell   *lc;
+
+	foreach(lc, exprs)
+	{
+		if (!IsA(lfirst(lc), Var))
+			return false;
+	}
+	return true;
+}
+
+/*
+ * Return the boundbox function of the type if it returns a Box3D, or
+ * InvalidOid
+ */
+static Oid
+spatialjoin3D_boundbox(Oid typid)
+{
+	Oid			funcid = LookupFuncName(list_make1(makeString("boundbox")), 1,
+		&typid, true);
+
+	if (!OidIsValid(funcid) || get_func_rettype(funcid) != box3d_oid())
+		return InvalidOid;
+	return funcid;
+}
+
+/*
+ * If the clause bounds the distance between two values, i.e., it is of the
+ * form a <-> b < d, a <-> b <= d, or their commuted forms, where d is a
+ * constant, return the distance expression and set the distance, otherwise
+ * return NULL. A negative or NaN distance is left to the other join
+ * methods.
+ */
+static OpExpr *
+spatialjoin3D_distance_clause(OpExpr *opexpr, double *distance)
+{
+	char	   *opname = get_opname(opexpr->opno);
+	Node	   *dist,
+			   *bound;
+	OpExpr	   *distexpr;
+	Const	   *c;
+
+	if (opname == NULL || list_length(opexpr->args) != 2)
+		return NULL;
+	if (strcmp(opname, "<") == 0 || strcmp(opname, "<=") == 0)
+	{
+		dist = (Node *) linitial(opexpr->args);
+		bound = (Node *) lsecond(opexpr->args);
+	}
+	else if (strcmp(opname, ">") == 0 || strcmp(opname, ">=") == 0)
+	{
+		dist = (Node *) lsecond(opexpr->args);
+		bound = (Node *) linitial(opexpr->args);
+	}
+	else
+		return NULL;
+	if (!IsA(dist, OpExpr) || !IsA(bound, Const))
+		return NULL;
+
+	distexpr = (OpExpr *) dist;
+	c = (Const *) bound;
+	opname = get_opname(distexpr->opno);
+	if (opname == NULL || strcmp(opname, "<->") != 0 ||
+		distexpr->opresulttype != FLOAT8OID ||
+		c->consttype != FLOAT8OID || c->constisnull)
+		return NULL;
+	*distance = DatumGetFloat8(c->constvalue);
+	if (!(*distance >= 0.0) || isinf(*distance))
+		return NULL;
+	return distexpr;
+}
+
+/*
+ * Cost the path. Both inputs are read in full before the first tuple is
+ * returned. Each object has its box computed twice and is copied into the
+ * staging tuplestore and into the partitions, which are sorted and spilled
+ * to disk when they exceed work_mem. The clauses are evaluated on each
+ * candidate pair, whose number is estimated by the rows of the join since
+ * the operators are selective on the boxes.
+ */
+static void
+spatialjoin3D_cost(PlannerInfo *root, CustomPath *cpath, Path *paths[2],
+	Oid funcs[2], List *quals)
+{
+	QualCost	qualcost;
+	Cost		startup = 0.0;
+	double		bytes = 0.0,
+				ncandidates = clamp_row_est(cpath->path.rows);
+	int			i;
+
+	for (i = 0; i < 2; i++)
+	{
+		double		rows = clamp_row_est(paths[i]->rows);
+
+		startup += paths[i]->total_cost;
+		startup += rows * (2 * get_func_cost(funcs[i]) * cpu_operator_cost +
+			2 * cpu_tuple_cost);
+		startup += rows * 2.0 * cpu_operator_cost * log2(Max(rows, 2.0));
+		bytes += rows * (SPATIALJOIN3D_HDRSZ +
+			MAXALIGN(paths[i]->pathtarget->width + MINIMAL_TUPLE_OVERHEAD));
+	}
+	/* Both the staging tuplestores and the partitions are written and read */
+	if (bytes > work_mem * 1024.0)
+		startup += 4.0 * seq_page_cost * ceil(bytes / BLCKSZ);
+
+	cost_qual_eval(&qualcost, quals, root);
+	startup += qualcost.startup +
+		ncandidates * (qualcost.per_tuple + cpu_tuple_cost);
+
+	cpath->path.startup_cost = startup;
+	cpath->path.total_cost = startup + cpath->path.rows *
+		(cpu_tuple_cost + cpath->path.pathtarget->cost.per_tuple);
+}
+
+/*
+ * Add a custom path for the inner join of outerrel and innerrel if one of
+ * its clauses can be evaluated by the spatial join
+ */
+static void
+spatialjoin3D_pathlist(PlannerInfo *root, RelOptInfo *joinrel,
+	RelOptInfo *outerrel, RelOptInfo *innerrel, JoinType jointype,
+	JoinPathExtraData *extra)
+{
+	CustomPath *cpath;
+	Path	   *paths[2];
+	Var		   *keys[2] = {NULL, NULL};
+	Oid			funcs[2] = {InvalidOid, InvalidOid};
+	double		distance = 0.0;
+	List	   *quals;
+	ListCell   *lc;
+
+	if (prev_set_join_pathlist_hook)
+		prev_set_join_pathlist_hook(root, joinrel, outerrel, innerrel,
+			jointype, extra);
+
+	if (!spatialjoin3D_enable_pbsmjoin || jointype != JOIN_INNER)
+		return;
+	paths[0] = outerrel->cheapest_total_path;
+	paths[1] = innerrel->cheapest_total_path;
+	if (paths[0] == NULL || paths[1] == NULL ||
+		paths[0]->param_info != NULL || paths[1]->param_info != NULL ||
+		!bms_is_empty(joinrel->lateral_relids))
+		return;
+
+	/* The scan tuple is built from the Vars of the inputs */
+	if (!spatialjoin3D_vars_only(joinrel->reltarget->exprs) ||
+		!spatialjoin3D_vars_only(outerrel->reltarget->exprs) ||
+		!spatialjoin3D_vars_only(innerrel->reltarget->exprs))
+		return;
+
+	foreach(lc, extra->restrictlist)
+	{
+		RestrictInfo *rinfo = lfirst_node(RestrictInfo, lc);
+		OpExpr	   *opexpr,
+				   *distexpr;
+		Var		   *left,
+				   *right;
+		char	   *opname;
+		double		clausedist = 0.0;
+
+		if (rinfo->pseudoconstant)
+			return;
+		if (keys[0] != NULL || !IsA(rinfo->clause, OpExpr))
+			continue;
+		opexpr = (OpExpr *) rinfo->clause;
+		distexpr = spatialjoin3D_distance_clause(opexpr, &clausedist);
+		if (distexpr != NULL)
+			opexpr = distexpr;
+		else
+		{
+			opname = get_opname(opexpr->opno);
+			if (opname == NULL || !spatialjoin3D_operator(opname))
+				continue;
+		}
+		if (list_length(opexpr->args) != 2 ||
+			!IsA(linitial(opexpr->args), Var) || !IsA(lsecond(opexpr->args), Var))
+			continue;
+		left = (Var *) linitial(opexpr->args);
+		right = (Var *) lsecond(opexpr->args);
+
+		if (bms_is_member(left->varno, outerrel->relids) &&
+			bms_is_member(right->varno, innerrel->relids))
+		{
+			keys[0] = left;
+			keys[1] = right;
+		}
+		else if (bms_is_member(right->varno, outerrel->relids) &&
+			bms_is_member(left->varno, innerrel->relids))
+		{
+			keys[0] = right;
+			keys[1] = left;
+		}
+		else
+			continue;
+
+		funcs[0] = spatialjoin3D_boundbox(keys[0]->vartype);
+		funcs[1] = spatialjoin3D_boundbox(keys[1]->vartype);
+		if (!OidIsValid(funcs[0]) || !OidIsValid(funcs[1]))
+			keys[0] = keys[1] = NULL;
+		else
+			distance = clausedist;
+	}
+	if (keys[0] == NULL)
+		return;
+
+	quals = extract_actual_clauses(extra->restrictlist, false);
+	if (!spatialjoin3D_vars_only(pull_var_clause((Node *) quals,
+			PVC_INCLUDE_PLACEHOLDERS)))
+		return;
+
+	cpath = makeNode(CustomPath);
+	cpath->path.pathtype = T_CustomScan;
+	cpath->path.parent = joinrel;
+	cpath->path.pathtarget = joinrel->reltarget;
+	cpath->path.param_info = NULL;
+	cpath->path.parallel_aware = false;
+	cpath->path.parallel_safe = false;
+	cpath->path.parallel_workers = 0;
+	cpath->path.rows = joinrel->rows;
+	cpath->path.pathkeys = NIL;
+#if PG_VERSION_NUM >= 180000
+	cpath->path.disabled_nodes = paths[0]->disabled_nodes +
+		paths[1]->disabled_nodes;
+#endif
+	cpath->flags = 0;
+	cpath->custom_paths = list_make2(paths[0], paths[1]);
+	cpath->custom_private = list_make4(extra->restrictlist,
+		list_make2(keys[0], keys[1]), list_make2_oid(funcs[0], funcs[1]),
+		makeFloat(psprintf("%.17g", distance)));
+	cpath->methods = &spatialjoin3D_path_methods;
+	spatialjoin3D_cost(root, cpath, paths, funcs, quals);
+
+	add_path(joinrel, &cpath->path);
+}
+
+/* Return the position of the Var in the target list of the plan, or 0 */
+static AttrNumber
+spatialjoin3D_find_var(Plan *plan, Var *var)
+{
+	ListCell   *lc;
+
+	foreach(lc, plan->targetlist)
+	{
+		TargetEntry *tle = lfirst_node(TargetEntry, lc);
+		Var		   *tvar = (Var *) tle->expr;
+
+		if (IsA(tvar, Var) && tvar->varno == var->varno &&
+			tvar->varattno == var->varattno)
+			return tle->resno;
+	}
+	return 0;
+}
+
+/*
+ * Create the plan of the path. The scan tuple holds the Vars of the target
+ * list and of the clauses of the join, each of them being taken from the
+ * tuple of the input whose target list contains it.
+ */
+static Plan *
+spatialjoin3D_plan(PlannerInfo *root, RelOptInfo *rel, CustomPath *best_path,
+	List *tlist, List *clauses, List *custom_plans)
+{
+	CustomScan *cscan = makeNode(CustomScan);
+	List	   *restrictlist = (List *) linitial(best_path->custom_private);
+	List	   *keys = (List *) lsecond(best_path->custom_private);
+	List	   *funcs = (List *) lthird(best_path->custom_private);
+	Node	   *distance = (Node *) lfourth(best_path->custom_private);
+	List	   *quals = extract_actual_clauses(restrictlist, false);
+	List	   *scan_tlist;
+	List	   *sides = NIL,
+			   *attnos = NIL,
+			   *keyattnos = NIL;
+	Plan	   *plans[2];
+	ListCell   *lc;
+	int			i;
+
+	plans[0] = (Plan *) linitial(custom_plans);
+	plans[1] = (Plan *) lsecond(custom_plans);
+
+	scan_tlist = add_to_flat_tlist(NIL, pull_var_clause((Node *) tlist,
+		PVC_INCLUDE_PLACEHOLDERS));
+	scan_tlist = add_to_flat_tlist(scan_tlist, pull_var_clause((Node *) quals,
+		PVC_INCLUDE_PLACEHOLDERS));
+	foreach(lc, scan_tlist)
+	{
+		Var		   *var = (Var *) lfirst_node(TargetEntry, lc)->expr;
+		AttrNumber	attno = 0;
+
+		for (i = 0; i < 2 && attno == 0; i++)
+		{
+			attno = spatialjoin3D_find_var(plans[i], var);
+			if (attno != 0)
+			{
+				sides = lappend_int(sides, i);
+				attnos = lappend_int(attnos, attno);
+			}
+		}
+		if (attno == 0)
+			elog(ERROR, "spatialjoin3D: variable not found in the inputs of the join");
+	}
+	for (i = 0; i < 2; i++)
+	{
+		AttrNumber	attno = spatialjoin3D_find_var(plans[i],
+			(Var *) list_nth(keys, i));
+
+		if (attno == 0)
+			elog(ERROR, "spatialjoin3D: join key not found in the input of the join");
+		keyattnos = lappend_int(keyattnos, attno);
+	}
+
+	cscan->scan.plan.targetlist = tlist;
+	cscan->scan.plan.qual = quals;
+	cscan->scan.scanrelid = 0;
+	cscan->flags = best_path->flags;
+	cscan->custom_plans = custom_plans;
+	cscan->custom_exprs = NIL;
+	cscan->custom_private = lappend(list_make4(sides, attnos, keyattnos,
+		list_copy(funcs)), copyObject(distance));
+	cscan->custom_scan_tlist = scan_tlist;
+	cscan->methods = &spatialjoin3D_scan_methods;
+	return &cscan->scan.plan;
+}
+
+/*****************************************************************************
+ * Execution
+ *****************************************************************************/
+
+static Node *
+spatialjoin3D_create_state(CustomScan *cscan)
+{
+	SpatialJoin3DScanState *node = (SpatialJoin3DScanState *)
+		newNode(sizeof(SpatialJoin3DScanState), T_CustomScanState);
+
+	node->css.methods = &spatialjoin3D_exec_methods;
+	return (Node *) node;
+}
+
+static void
+spatialjoin3D_begin(CustomScanState *css, EState *estate, int eflags)
+{
+	SpatialJoin3DScanState *node = (SpatialJoin3DScanState *) css;
+	CustomScan *cscan = (CustomScan *) css->ss.ps.plan;
+	List	   *sides = (List *) list_nth(cscan->custom_private, SPATIALJOIN3D_PRIV_SIDES);
+	List	   *attnos = (List *) list_nth(cscan->custom_private, SPATIALJOIN3D_PRIV_ATTNOS);
+	List	   *keys = (List *) list_nth(cscan->custom_private, SPATIALJOIN3D_PRIV_KEYS);
+	List	   *funcs = (List *) list_nth(cscan->custom_private, SPATIALJOIN3D_PRIV_FUNCS);
+	PlanState  *children[2];
+	int			i;
+
+	/* The inputs are read once into the partitions */
+	eflags &= ~(EXEC_FLAG_REWIND | EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK);
+	for (i = 0; i < 2; i++)
+	{
+		children[i] = ExecInitNode((Plan *) list_nth(cscan->custom_plans, i),
+			estate, eflags);
+		node->slots[i] = MakeSingleTupleTableSlot(ExecGetResultType(children[i]),
+			&TTSOpsMinimalTuple);
+		node->keys[i] = (AttrNumber) list_nth_int(keys, i);
+		fmgr_info(list_nth_oid(funcs, i), &node->boundbox[i]);
+	}
+	css->custom_ps = list_make2(children[0], children[1]);
+	node->distance = floatVal(list_nth(cscan->custom_private,
+		SPATIALJOIN3D_PRIV_DISTANCE));
+
+	node->natts = list_length(sides);
+	node->sides = (int *) palloc(sizeof(int) * Max(node->natts, 1));
+	node->attnos = (AttrNumber *) palloc(sizeof(AttrNumber) * Max(node->natts, 1));
+	for (i = 0; i < node->natts; i++)
+	{
+		node->sides[i] = list_nth_int(sides, i);
+		node->attnos[i] = (AttrNumber) list_nth_int(attnos, i);
+	}
+	node->resultslot = MakeSingleTupleTableSlot(
+		css->ss.ss_ScanTupleSlot->tts_tupleDescriptor, &TTSOpsMinimalTuple);
+}
+
+/*
+ * Form the scan tuple of the candidate pair and keep it if the clauses of
+ * the join hold
+ */
+static void
+spatialjoin3D_scan_emit(void *arg, SpatialJoin3DEntry *r, SpatialJoin3DEntry *s)
+{
+	SpatialJoin3DScanState *node = (SpatialJoin3DScanState *) arg;
+	TupleTableSlot *scanslot = node->css.ss.ss_ScanTupleSlot;
+	ExprContext *econtext = node->css.ss.ps.ps_ExprContext;
+	int			i;
+
+	ExecStoreMinimalTuple((MinimalTuple) SPATIALJOIN3D_VALUE(r), node->slots[0], false);
+	ExecStoreMinimalTuple((MinimalTuple) SPATIALJOIN3D_VALUE(s), node->slots[1], false);
+	ExecClearTuple(scanslot);
+	for (i = 0; i < node->natts; i++)
+		scanslot->tts_values[i] = slot_getattr(node->slots[node->sides[i]],
+			node->attnos[i], &scanslot->tts_isnull[i]);
+	ExecStoreVirtualTuple(scanslot);
+
+	econtext->ecxt_scantuple = scanslot;
+	if (ExecQual(node->css.ss.ps.qual, econtext))
+		tuplestore_puttupleslot(node->results, scanslot);
+	else
+		InstrCountFiltered1(node, 1);
+	ResetExprContext(econtext);
+}
+
+/*
+ * Compute the box of the key of a tuple of the input. The boxes of the
+ * inner input are expanded by the distance of a distance clause, so that
+ * they intersect the boxes of the outer objects within the distance.
+ */
+static Box3D *
+spatialjoin3D_key_box(SpatialJoin3DScanState *node, int side, Datum value)
+{
+	Box3D	   *box = (Box3D *) palloc(sizeof(Box3D));
+
+	*box = *DatumGetBox3DP(FunctionCall1(&node->boundbox[side], value));
+	if (side == 1 && node->distance > 0.0)
+	{
+		box->low.x -= node->distance;
+		box->low.y -= node->distance;
+		box->low.z -= node->distance;
+		box->high.x += node->distance;
+		box->high.y += node->distance;
+		box->high.z += node->distance;
+	}
+	return box;
+}
+
+/*
+ * Read the input into a tuplestore, gathering the statistics of the boxes
+ * of its keys. The rows whose key is null cannot satisfy the operator.
+ */
+static Tuplestorestate *
+spatialjoin3D_stage(SpatialJoin3DScanState *node, int side,
+	SpatialJoin3DStats *stats)
+{
+	PlanState  *child = (PlanState *) list_nth(node->css.custom_ps, side);
+	ExprContext *econtext = node->css.ss.ps.ps_ExprContext;
+	Tuplestorestate *store = tuplestore_begin_heap(false, false, work_mem);
+
+	memset(stats, 0, sizeof(SpatialJoin3DStats));
+	for (;;)
+	{
+		TupleTableSlot *slot = ExecProcNode(child);
+		MemoryContext oldcontext;
+		Datum		value;
+		bool		isnull;
+
+		if (TupIsNull(slot))
+			break;
+		value = slot_getattr(slot, node->keys[side], &isnull);
+		if (isnull)
+			continue;
+		oldcontext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+		spatialjoin3D_stats_add(stats, spatialjoin3D_key_box(node, side, value),
+			MINIMAL_TUPLE_OVERHEAD + child->plan->plan_width);
+		MemoryContextSwitchTo(oldcontext);
+		tuplestore_puttupleslot(store, slot);
+		ResetExprContext(econtext);
+	}
+	return store;
+}
+
+/* Run the join on the inputs, keeping the scan tuples of the result */
+static void
+spatialjoin3D_build(SpatialJoin3DScanState *node)
+{
+	ExprContext *econtext = node->css.ss.ps.ps_ExprContext;
+	Tuplestorestate *stores[2];
+	SpatialJoin3DStats stats[2];
+	SpatialJoin3D *join;
+	int			i;
+
+	if (node->results == NULL)
+		node->results = tuplestore_begin_heap(false, false, work_mem);
+	else
+		tuplestore_clear(node->results);
+
+	for (i = 0; i < 2; i++)
+		stores[i] = spatialjoin3D_stage(node, i, &stats[i]);
+	join = spatialjoin3D_create(&stats[0], &stats[1], (Size) work_mem * 1024L,
+		spatialjoin3D_scan_emit, node);
+	if (join != NULL)
+	{
+		for (i = 0; i < 2; i++)
+		{
+			while (tuplestore_gettupleslot(stores[i], true, false, node->slots[i]))
+			{
+				MemoryContext oldcontext;
+				MinimalTuple tuple;
+				bool		shouldfree;
+				Datum		value;
+				bool		isnull;
+
+				tuple = ExecFetchSlotMinimalTuple(node->slots[i], &shouldfree);
+				value = slot_getattr(node->slots[i], node->keys[i], &isnull);
+				oldcontext = MemoryContextSwitchTo(econtext->ecxt_per_tuple_memory);
+				spatialjoin3D_add(join, i, NULL, (char *) tuple, tuple->t_len,
+					spatialjoin3D_key_box(node, i, value));
+				MemoryContextSwitchTo(oldcontext);
+				if (shouldfree)
+					pfree(tuple);
+				ResetExprContext(econtext);
+			}
+			tuplestore_end(stores[i]);
+			stores[i] = NULL;
+			CHECK_FOR_INTERRUPTS();
+		}
+		spatialjoin3D_run(join);
+	}
+	for (i = 0; i < 2; i++)
+	{
+		if (stores[i] != NULL)
+			tuplestore_end(stores[i]);
+	}
+	spatialjoin3D_free(join, &node->instr);
+	node->built = true;
+}
+
+static TupleTableSlot *
+spatialjoin3D_exec(CustomScanState *css)
+{
+	SpatialJoin3DScanState *node = (SpatialJoin3DScanState *) css;
+	TupleTableSlot *scanslot = css->ss.ss_ScanTupleSlot;
+	ExprContext *econtext = css->ss.ps.ps_ExprContext;
+
+	if (!node->built)
+		spatialjoin3D_build(node);
+
+	if (!tuplestore_gettupleslot(node->results, true, false, node->resultslot))
+		return NULL;
+
+	/* The scan slot points to the tuple in the tuplestore */
+	slot_getallattrs(node->resultslot);
+	ExecClearTuple(scanslot);
+	memcpy(scanslot->tts_values, node->resultslot->tts_values,
+		sizeof(Datum) * node->natts);
+	memcpy(scanslot->tts_isnull, node->resultslot->tts_isnull,
+		sizeof(bool) * node->natts);
+	ExecStoreVirtualTuple(scanslot);
+
+	if (css->ss.ps.ps_ProjInfo == NULL)
+		return scanslot;
+	ResetExprContext(econtext);
+	econtext->ecxt_scantuple = scanslot;
+	return ExecProject(css->ss.ps.ps_ProjInfo);
+}
+
+static void
+spatialjoin3D_end(CustomScanState *css)
+{
+	SpatialJoin3DScanState *node = (SpatialJoin3DScanState *) css;
+	ListCell   *lc;
+	int			i;
+
+	if (node->results != NULL)
+		tuplestore_end(node->results);
+	node->results = NULL;
+	for (i = 0; i < 2; i++)
+		ExecDropSingleTupleTableSlot(node->slots[i]);
+	ExecDropSingleTupleTableSlot(node->resultslot);
+	foreach(lc, css->custom_ps)
+		ExecEndNode((PlanState *) lfirst(lc));
+}
+
+/*
+ * Rescan the result, unless a parameter of the inputs changed, in which
+ * case the join is run again on the rescanned inputs
+ */
+static void
+spatialjoin3D_rescan(CustomScanState *css)
+{
+	SpatialJoin3DScanState *node = (SpatialJoin3DScanState *) css;
+	ListCell   *lc;
+
+	if (node->built && css->ss.ps.chgParam == NULL)
+	{
+		tuplestore_rescan(node->results);
+		return;
+	}
+
+	node->built = false;
+	foreach(lc, css->custom_ps)
+	{
+		PlanState  *child = (PlanState *) lfirst(lc);
+
+		if (css->ss.ps.chgParam != NULL)
+			UpdateChangedParamSet(child, css->ss.ps.chgParam);
+		if (child->chgParam == NULL)
+			ExecReScan(child);
+	}
+}
+
+static void
+spatialjoin3D_explain(CustomScanState *css, List *ancestors, ExplainState *es)
+{
+	SpatialJoin3DScanState *node = (SpatialJoin3DScanState *) css;
+
+	if (!es->analyze || !node->built)
+		return;
+	ExplainPropertyInteger("Partitions", NULL, node->instr.nparts, es);
+	ExplainPropertyInteger("Tiles", NULL, node->instr.ntiles, es);
+	ExplainPropertyInteger("Partition Entries", NULL, node->instr.nentries, es);
+	ExplainPropertyInteger("Spilled Partitions", NULL, node->instr.nfiles, es);
+	ExplainPropertyInteger("Candidate Pairs", NULL, node->instr.ncandidates, es);
+}
+
+#endif							/* PG_VERSION_NUM >= 120000 */
+
+/*****************************************************************************
+ * Registration
+ *****************************************************************************/
+
+/*
+ * Install the planner hook of the custom scan, which is called once by
+ * _PG_init when the library is loaded
+ */
+void
+spatialjoin3D_register(void)
+{
+#if PG_VERSION_NUM >= 120000
+	DefineCustomBoolVariable("geo3d.enable_pbsmjoin",
+		"Enables the planner's use of partition based spatial joins.",
+		NULL,
+		&spatialjoin3D_enable_pbsmjoin,
+		true,
+		PGC_USERSET,
+		0,
+		NULL, NULL, NULL);
+#if PG_VERSION_NUM >= 150000
+	MarkGUCPrefixReserved("geo3d");
+#else
+	EmitWarningsOnPlaceholders("geo3d");
+#endif
+
+	RegisterCustomScanMethods(&spatialjoin3D_scan_methods);
+	prev_set_join_pathlist_hook = set_join_pathlist_hook;
+	set_join_pathlist_hook = spatialjoin3D_pathlist;
+#endif
+}
+
+/*****************************************************************************/
@@ -0,0 +1,438 @@
+/*****************************************************************************
+ *
+ * geo3D_partition.c
+ *	  Partition pruning of relations partitioned by the cells of a 3D column
+ *
+ * A relation whose rows are routed to its partitions by the cell of the
+ * octree containing their geometry, e.g., PARTITION BY HASH
+ * (partitioncell3D(geom, 10.0, 8)), cannot be pruned by the planner on
+ * spatial predicates such as geom && box, which do not mention the
+ * partition key. Once the library is loaded, a planner hook adds to each
+ * such predicate of the WHERE clause or of an inner join that compares the
+ * column with a constant the condition that the partition key is one of
+ * those of the geometries intersecting the bounding box of the constant,
+ * as computed by partitioncells3D, from which the planner prunes the
+ * partitions. The added condition is implied by the predicate, so that
+ * the result of the query is unchanged. The predicates are the functions
+ * behind the topological operators, whose arguments have intersecting
+ * bounding boxes when they hold, recognized by their planner support
+ * function, and dwithin3D, whose distance expands the box. Predicates
+ * whose box intersects more than PARTITION3D_MAXKEYS cells add no
+ * condition, as the partitions would hardly be pruned. Parameters of
+ * prepared statements are not constants for the hook, queries on them
+ * can compare the partition key with partitioncells3D explicitly.
+ *
+ * The planner hook needs PostgreSQL 12 or later, where it is installed by
+ * _PG_init. It can be disabled with the configuration parameter
+ * geo3d.enable_partition_pruning.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#if PG_VERSION_NUM >= 120000
+#include <math.h>
+
+#include <access/stratnum.h>
+#include <access/table.h>
+#include <access/htup_details.h>
+#include <catalog/pg_class.h>
+#include <catalog/pg_type.h>
+#include <nodes/makefuncs.h>
+#include <nodes/nodeFuncs.h>
+#include <nodes/value.h>
+#include <optimizer/optimizer.h>
+#include <optimizer/planner.h>
+#include <parser/parse_func.h>
+#include <parser/parsetree.h>
+#include <rewrite/rewriteManip.h>
+#include <utils/array.h>
+#include <utils/guc.h>
+#include <utils/lsyscache.h>
+#include <utils/partcache.h>
+#include <utils/rel.h>
+#include <utils/syscache.h>
+#endif
+#include "geo3D_decls.h"
+
+#if PG_VERSION_NUM >= 120000
+
+/* Maximum number of partition keys of the condition added to a predicate */
+#define PARTITION3D_MAXKEYS		1024
+
+static bool partition3D_enable_pruning = true;
+
+static planner_hook_type prev_planner_hook = NULL;
+
+/*
+ * Name of the function if it belongs to the extension, i.e., to the
+ * namespace of its type Box3D, so that functions of the same name in other
+ * schemas are not taken for those of the extension, or NULL otherwise
+ */
+static char *
+partition3D_func_name(Oid funcid)
+{
+	HeapTuple	tp;
+	Oid			nspid;
+
+	if (!OidIsValid(funcid))
+		return NULL;
+	tp = SearchSysCache1(TYPEOID, ObjectIdGetDatum(box3d_oid()));
+	if (!HeapTupleIsValid(tp))
+		return NULL;
+	nspid = ((Form_pg_type) GETSTRUCT(tp))->typnamespace;
+	ReleaseSysCache(tp);
+	if (get_func_namespace(funcid) != nspid)
+		return NULL;
+	return get_func_name(funcid);
+}
+
+/*
+ * Number of arguments of the predicate of the function, 2 for the binary
+ * predicates and 3 for dwithin3D, or 0 if it is not known to imply that
+ * the bounding boxes of its arguments intersect
+ */
+static int
+partition3D_predicate(Oid funcid)
+{
+	char	   *name = partition3D_func_name(get_func_support(funcid));
+
+	if (name == NULL)
+		return 0;
+	if (strcmp(name, "dwithin3d_support") == 0)
+		return 3;
+	if (strcmp(name, "overlap3d_support") == 0 ||
+		strcmp(name, "contain3d_support") == 0 ||
+		strcmp(name, "contained3d_support") == 0)
+		return 2;
+	return 0;
+}
+
+/*
+ * Find the call of partitioncell3D on the attribute in the partition key
+ * of the relation, returning a copy of it together with its voxel size
+ * and level, and the operator family and strategy of the key, or false if
+ * there is none
+ */
+static bool
+partition3D_key(Relation rel, AttrNumber attno, FuncExpr **keyexpr,
+	double *size, int *level, Oid *opfamily, char *strategy)
+{
+	PartitionKey key = RelationGetPartitionKey(rel);
+	int			nexprs = 0,
+				i;
+
+	if (key == NULL)
+		return false;
+	for (i = 0; i < key->partnatts; i++)
+	{
+		FuncExpr   *expr;
+		Node	   *arg;
+		Const	   *sizearg,
+				   *levelarg;
+		char	   *name;
+
+		if (key->partattrs[i] != 0)
+			continue;
+		expr = (FuncExpr *) list_nth(key->partexprs, nexprs++);
+		if (!IsA(expr, FuncExpr) || list_length(expr->args) != 3 ||
+			key->parttypid[i] != INT8OID)
+			continue;
+		name = partition3D_func_name(expr->funcid);
+		if (name == NULL || strcmp(name, "partitioncell3d") != 0)
+			continue;
+		arg = (Node *) linitial(expr->args);
+		sizearg = (Const *) lsecond(expr->args);
+		levelarg = (Const *) lthird(expr->args);
+		if (!IsA(arg, Var) || ((Var *) arg)->varattno != attno ||
+			!IsA(sizearg, Const) || sizearg->constisnull ||
+			sizearg->consttype != FLOAT8OID ||
+			!IsA(levelarg, Const) || levelarg->constisnull ||
+			levelarg->consttype != INT4OID)
+			continue;
+		*size = DatumGetFloat8(sizearg->constvalue);
+		*level = DatumGetInt32(levelarg->constvalue);
+		if (!(*size > 0.0) || isinf(*size) || *level < 0 ||
+			*level > OCTCELL3D_MAXLEVEL)
+			continue;
+		*keyexpr = (FuncExpr *) copyObject(expr);
+		*opfamily = key->partopfamily[i];
+		*strategy = key->strategy;
+		return true;
+	}
+	return false;
+}
+
+/*
+ * Bounding box of the value of the expression, expanded by the value of
+ * the distance if any, or false if they are not constant or if the type of
+ * the expression has no bounding box
+ */
+static bool
+partition3D_window(Node *expr, Node *dist, Box3D *box)
+{
+	Const	   *value;
+	double		d = 0.0;
+	Oid			type,
+				funcid;
+
+	if (dist != NULL)
+	{
+		value = (Const *) eval_const_expressions(NULL, dist);
+		if (!IsA(value, Const) || value->constisnull ||
+			value->consttype != FLOAT8OID)
+			return false;
+		d = DatumGetFloat8(value->constvalue);
+		/* Written so that NaN fails the test */
+		if (!(d >= 0.0))
+			return false;
+	}
+
+	value = (Const *) eval_const_expressions(NULL, expr);
+	if (!IsA(value, Const) || value->constisnull)
+		return false;
+	type = value->consttype;
+	if (type == box3d_oid())
+		*box = *DatumGetBox3DP(value->constvalue);
+	else
+	{
+		funcid = LookupFuncName(list_make1(makeString("boundbox")), 1, &type,
+			true);
+		if (partition3D_func_name(funcid) == NULL ||
+			get_func_rettype(funcid) != box3d_oid())
+			return false;
+		*box = *DatumGetBox3DP(OidFunctionCall1(funcid, value->constvalue));
+	}
+	if (isnan(box->low.x) || isnan(box->low.y) || isnan(box->low.z) ||
+		isnan(box->high.x) || isnan(box->high.y) || isnan(box->high.z))
+		return false;
+
+	box->low.x -= d;
+	box->low.y -= d;
+	box->low.z -= d;
+	box->high.x += d;
+	box->high.y += d;
+	box->high.z += d;
+	return true;
+}
+
+/*
+ * Condition on the partition key of the relation of the variable implied
+ * by a predicate comparing it with the other expression, or NULL if there
+ * is none
+ */
+static Expr *
+partition3D_var_cond(Query *query, Var *var, Node *other, Node *dist)
+{
+	RangeTblEntry *rte = rt_fetch(var->varno, query->rtable);
+	Relation	rel;
+	FuncExpr   *keyexpr;
+	ScalarArrayOpExpr *saop;
+	ArrayType  *array;
+	Datum	   *elems;
+	uint64	   *ids;
+	Box3D		box;
+	double		size;
+	int			level,
+				nkeys,
+				i;
+	Oid			opfamily,
+				eqop;
+	char		strategy;
+	bool		found;
+
+	if (rte->rtekind != RTE_RELATION ||
+		rte->relkind != RELKIND_PARTITIONED_TABLE)
+		return NULL;
+
+	/* The relation is already locked by the parser */
+	rel = table_open(rte->relid, NoLock);
+	found = partition3D_key(rel, var->varattno, &keyexpr, &size, &level,
+		&opfamily, &strategy);
+	table_close(rel, NoLock);
+	if (!found || !partition3D_window(other, dist, &box))
+		return NULL;
+
+	eqop = get_opfamily_member(opfamily, INT8OID, INT8OID,
+		strategy == PARTITION_STRATEGY_HASH ?
+		HTEqualStrategyNumber : BTEqualStrategyNumber);
+	ids = partitioncell3D_keys(&box, size, level, PARTITION3D_MAXKEYS, &nkeys);
+	if (!OidIsValid(eqop) || ids == NULL)
+		return NULL;
+
+	elems = (Datum *) palloc(sizeof(Datum) * nkeys);
+	for (i = 0; i < nkeys; i++)
+		elems[i] = Int64GetDatum((int64) ids[i]);
+	array = construct_array(elems, nkeys, INT8OID, sizeof(int64),
+		FLOAT8PASSBYVAL, 'd');
+
+	/* The variables of the partition key refer to the relation as 1 */
+	ChangeVarNodes((Node *) keyexpr, 1, var->varno, 0);
+	saop = makeNode(ScalarArrayOpExpr);
+	saop->opno = eqop;
+	saop->opfuncid = get_opcode(eqop);
+	saop->useOr = true;
+	saop->inputcollid = InvalidOid;
+	saop->args = list_make2(keyexpr,
+		makeConst(INT8ARRAYOID, -1, InvalidOid, -1, PointerGetDatum(array),
+			false, false));
+	saop->location = -1;
+	return (Expr *) saop;
+}
+
+/*
+ * Condition on a partition key implied by the clause, or NULL if there is
+ * none
+ */
+static Expr *
+partition3D_clause_cond(Query *query, Node *clause)
+{
+	List	   *args;
+	Oid			funcid;
+	int			nargs,
+				i;
+
+	if (IsA(clause, OpExpr))
+	{
+		set_opfuncid((OpExpr *) clause);
+		funcid = ((OpExpr *) clause)->opfuncid;
+		args = ((OpExpr *) clause)->args;
+	}
+	else if (IsA(clause, FuncExpr))
+	{
+		funcid = ((FuncExpr *) clause)->funcid;
+		args = ((FuncExpr *) clause)->args;
+	}
+	else
+		return NULL;
+
+	nargs = partition3D_predicate(funcid);
+	if (nargs == 0 || list_length(args) != nargs)
+		return NULL;
+	for (i = 0; i < 2; i++)
+	{
+		Var		   *var = (Var *) list_nth(args, i);
+		Expr	   *cond;
+
+		if (!IsA(var, Var) || var->varlevelsup != 0)
+			continue;
+		cond = partition3D_var_cond(query, var, (Node *) list_nth(args, 1 - i),
+			(nargs == 3) ? (Node *) lthird(args) : NULL);
+		if (cond != NULL)
+			return cond;
+	}
+	return NULL;
+}
+
+/*
+ * Add to the qualification of the query the conditions on the partition
+ * keys implied by its conjuncts
+ */
+static Node *
+partition3D_quals(Query *query, Node *quals)
+{
+	List	   *clauses = make_ands_implicit((Expr *) quals);
+	List	   *conds = NIL;
+	ListCell   *lc;
+
+	foreach(lc, clauses)
+	{
+		Expr	   *cond = partition3D_clause_cond(query, (Node *) lfirst(lc));
+
+		if (cond != NULL)
+			conds = lappend(conds, cond);
+	}
+	if (conds == NIL)
+		return quals;
+	return (Node *) make_ands_explicit(list_concat(clauses, conds));
+}
+
+/*
+ * Walk the query and its subqueries, adding the conditions on the
+ * partition keys to their WHERE clause and to the clauses of their inner
+ * joins
+ */
+static bool
+partition3D_walker(Node *node, void *context)
+{
+	if (node == NULL)
+		return false;
+	if (IsA(node, Query))
+	{
+		Query	   *query = (Query *) node;
+
+		if (query->jointree != NULL)
+			query->jointree->quals = partition3D_quals(query,
+				query->jointree->quals);
+		return query_tree_walker(query, partition3D_walker, (void *) query, 0);
+	}
+	if (IsA(node, JoinExpr) && ((JoinExpr *) node)->jointype == JOIN_INNER)
+	{
+		JoinExpr   *join = (JoinExpr *) node;
+
+		join->quals = partition3D_quals((Query *) context, join->quals);
+	}
+	return expression_tree_walker(node, partition3D_walker, context);
+}
+
+/*
+ * Planner hook adding the conditions on the partition keys before planning
+ * the query
+ */
+#if PG_VERSION_NUM >= 130000
+static PlannedStmt *
+partition3D_planner(Query *parse, const char *query_string, int cursorOptions,
+	ParamListInfo boundParams)
+#else
+static PlannedStmt *
+partition3D_planner(Query *parse, int cursorOptions, ParamListInfo boundParams)
+#endif
+{
+	if (partition3D_enable_pruning)
+		(void) partition3D_walker((Node *) parse, NULL);
+
+#if PG_VERSION_NUM >= 130000
+	if (prev_planner_hook)
+		return prev_planner_hook(parse, query_string, cursorOptions,
+			boundParams);
+	return standard_planner(parse, query_string, cursorOptions, boundParams);
+#else
+	if (prev_planner_hook)
+		return prev_planner_hook(parse, cursorOptions, boundParams);
+	return standard_planner(parse, cursorOptions, boundParams);
+#endif
+}
+
+#endif							/* PG_VERSION_NUM >= 120000 */
+
+/*****************************************************************************
+ * Registration
+ *****************************************************************************/
+
+/*
+ * Install the planner hook of partition pruning, which is called once by
+ * _PG_init when the library is loaded
+ */
+void
+partition3D_register(void)
+{
+#if PG_VERSION_NUM >= 120000
+	DefineCustomBoolVariable("geo3d.enable_partition_pruning",
+		"Enables partition pruning on spatial predicates of relations partitioned by partitioncell3D.",
+		NULL,
+		&partition3D_enable_pruning,
+		true,
+		PGC_USERSET,
+		0,
+		NULL, NULL, NULL);
+
+	prev_planner_hook = planner_hook;
+	planner_hook = partition3D_planner;
+#endif
+}
+
+/*****************************************************************************/
@@ -0,0 +1,853 @@
+/*****************************************************************************
+ *
+ * geo3D_pointpatch.c
+ *	  Patches of 3D points
+ *
+ * A PointPatch3D stores a set of points in a single value so that point
+ * clouds with billions of points do not pay a tuple header for each of
+ * them. Its header keeps the number of points and their bounding box,
+ * which is all the GiST index needs. Optionally, the points are quantized
+ * to a given scale and delta-encoded, which further reduces the patch to
+ * a few bytes per point for spatially coherent patches. The aggregate
+ * pointpatch3D_pack builds such patches by sorting the points on their
+ * Morton code.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <ctype.h>
+#include <math.h>
+#include <limits.h>
+#include <float.h>
+
+#include <catalog/namespace.h>
+#include <funcapi.h>
+#include <libpq/pqformat.h>
+#include <utils/array.h>
+#include <utils/builtins.h>
+#include "geo3D_decls.h"
+
+/* Maximum number of bytes of the encoding of a quantized point */
+#define POINTPATCH3D_MAXQBYTES	(3 * 10)
+
+static void pointpatch3D_check_npts(int npts);
+static void pointpatch3D_check_scale(double scale);
+static Point3D *pointpatch3D_points_internal(PointPatch3D *patch);
+static void pointpatch3D_make_bbox(Box3D *box, Point3D *points, int npts);
+
+/*****************************************************************************
+ * Encoding and decoding
+ *****************************************************************************/
+
+Oid POINTPATCH3D_OID = InvalidOid ;
+Oid pointpatch3d_oid()
+{
+	if (POINTPATCH3D_OID == InvalidOid)
+		POINTPATCH3D_OID = TypenameGetTypid("pointpatch3d") ;
+	return POINTPATCH3D_OID ;
+}
+
+/*
+ * Write the zigzag varint encoding of val at buf, return the number of
+ * bytes written
+ */
+static inline int
+varint_encode(int64 val, unsigned char *buf)
+{
+	uint64		zz = ((uint64) val << 1) ^ (uint64) (val >> 63);
+	int			n = 0;
+
+	while (zz >= 0x80)
+	{
+		buf[n++] = (unsigned char) (zz | 0x80);
+		zz >>= 7;
+	}
+	buf[n++] = (unsigned char) zz;
+	return n;
+}
+
+/*
+ * Read a zigzag varint at *buf and advance *buf past it
+ */
+static inline int64
+varint_decode(const unsigned char **buf)
+{
+	const unsigned char *p = *buf;
+	uint64		zz = 0;
+	int			shift = 0;
+
+	while (*p & 0x80)
+	{
+		zz |= (uint64) (*p++ & 0x7f) << shift;
+		shift += 7;
+	}
+	zz |= (uint64) (*p++) << shift;
+	*buf = p;
+	return (int64) (zz >> 1) ^ -((int64) (zz & 1));
+}
+
+static void
+pointpatch3D_check_npts(int npts)
+{
+	if (npts <= 0 || npts > POINTPATCH3D_MAXPTS)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("A point patch must have between 1 and %d points", POINTPATCH3D_MAXPTS)));
+}
+
+static void
+pointpatch3D_check_scale(double scale)
+{
+	if (scale < 0.0 || isinf(scale) || isnan(scale))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("The scale of a point patch must be a positive number or 0")));
+}
+
+static void
+pointpatch3D_make_bbox(Box3D *box, Point3D *points, int npts)
+{
+	int			i;
+
+	box->high = box->low = points[0];
+	for (i = 1; i < npts; i++)
+	{
+		if (points[i].x < box->low.x)
+			box->low.x = points[i].x;
+		if (points[i].x > box->high.x)
+			box->high.x = points[i].x;
+		if (points[i].y < box->low.y)
+			box->low.y = points[i].y;
+		if (points[i].y > box->high.y)
+			box->high.y = points[i].y;
+		if (points[i].z < box->low.z)
+			box->low.z = points[i].z;
+		if (points[i].z > box->high.z)
+			box->high.z = points[i].z;
+	}
+}
+
+/*
+ * Quantize the coordinate value to a multiple of scale from origin
+ *
+ * The negated test also catches the NaN quotients of infinite or NaN
+ * coordinates, whose conversion to an integer is undefined.
+ */
+static inline int64
+pointpatch3D_quantize_coord(double value, double origin, double scale)
+{
+	double		q = rint((value - origin) / scale);
+
+	if (!(q >= 0.0 && q <= (double) PG_UINT32_MAX))
+	{
+		if (isinf(value) || isnan(value) || isinf(origin) || isnan(origin))
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("Cannot quantize a point patch with infinite or NaN coordinates")));
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("Scale %g is too small for the extent of the point patch", scale)));
+	}
+	return (int64) q;
+}
+
+/*
+ * pointpatch3D_make: Form a PointPatch3D from an array of points, quantized
+ * to the given scale if it is positive
+ *
+ * The bounding box of a quantized patch is the one of the quantized points
+ * so that it is exact for the points that are returned.
+ */
+PointPatch3D *
+pointpatch3D_make(Point3D *points, int npts, double scale)
+{
+	PointPatch3D *result;
+	Box3D		box;
+	int			size;
+
+	pointpatch3D_check_npts(npts);
+	pointpatch3D_make_bbox(&box, points, npts);
+
+	if (scale > 0.0)
+	{
+		unsigned char *buf = palloc(POINTPATCH3D_MAXQBYTES * npts);
+		int64		prevx = 0,
+					prevy = 0,
+					prevz = 0,
+					maxx = 0,
+					maxy = 0,
+					maxz = 0;
+		int			len = 0;
+		int			i;
+
+		for (i = 0; i < npts; i++)
+		{
+			int64		qx = pointpatch3D_quantize_coord(points[i].x, box.low.x, scale),
+						qy = pointpatch3D_quantize_coord(points[i].y, box.low.y, scale),
+						qz = pointpatch3D_quantize_coord(points[i].z, box.low.z, scale);
+
+			len += varint_encode(qx - prevx, buf + len);
+			len += varint_encode(qy - prevy, buf + len);
+			len += varint_encode(qz - prevz, buf + len);
+			prevx = qx;
+			prevy = qy;
+			prevz = qz;
+			maxx = Max(maxx, qx);
+			maxy = Max(maxy, qy);
+			maxz = Max(maxz, qz);
+		}
+
+		size = POINTPATCH3D_HDRSZ + len;
+		result = (PointPatch3D *) palloc0(size);
+		result->flags = POINTPATCH3D_QUANTIZED;
+		result->scale = scale;
+		result->boundbox.low = box.low;
+		result->boundbox.high.x = box.low.x + maxx * scale;
+		result->boundbox.high.y = box.low.y + maxy * scale;
+		result->boundbox.high.z = box.low.z + maxz * scale;
+		memcpy(result->data, buf, len);
+		pfree(buf);
+	}
+	else
+	{
+		size = POINTPATCH3D_HDRSZ + sizeof(Point3D) * npts;
+		result = (PointPatch3D *) palloc0(size);
+		result->boundbox = box;
+		memcpy(result->data, points, sizeof(Point3D) * npts);
+	}
+
+	SET_VARSIZE(result, size);
+	result->npts = npts;
+	return result;
+}
+
+/*
+ * pointpatch3D_decode: Write the points of the PointPatch3D into the array
+ * given by the caller, which has room for patch->npts points
+ */
+void
+pointpatch3D_decode(PointPatch3D *patch, Point3D *points)
+{
+	const unsigned char *buf = (const unsigned char *) patch->data;
+	Point3D    *origin = &patch->boundbox.low;
+	double		scale = patch->scale;
+	int64		qx = 0,
+				qy = 0,
+				qz = 0;
+	int			i;
+
+	if (!(patch->flags & POINTPATCH3D_QUANTIZED))
+	{
+		memcpy(points, patch->data, sizeof(Point3D) * patch->npts);
+		return;
+	}
+
+	for (i = 0; i < patch->npts; i++)
+	{
+		qx += varint_decode(&buf);
+		qy += varint_decode(&buf);
+		qz += varint_decode(&buf);
+		points[i].x = origin->x + qx * scale;
+		points[i].y = origin->y + qy * scale;
+		points[i].z = origin->z + qz * scale;
+	}
+}
+
+/*
+ * Return the points of the PointPatch3D, which point into the patch when it
+ * is not quantized
+ */
+static Point3D *
+pointpatch3D_points_internal(PointPatch3D *patch)
+{
+	Point3D    *result;
+
+	if (!(patch->flags & POINTPATCH3D_QUANTIZED))
+		return (Point3D *) patch->data;
+
+	result = (Point3D *) palloc(sizeof(Point3D) * patch->npts);
+	pointpatch3D_decode(patch, result);
+	return result;
+}
+
+/*****************************************************************************
+ * Input and output functions
+ *****************************************************************************/
+
+/*
+ * pointpatch3D_in: Read in the PointPatch3D from a string specification
+ *
+ * The input format is the one of Path3D, e.g., "[(x0,y0,z0),...,(xn,yn,zn)]",
+ * optionally followed by "@scale" for quantizing the points to this scale.
+ * Since the points of a quantized patch are multiples of its scale from the
+ * low corner of their bounding box, quantizing them again is lossless.
+ */
+Datum
+pointpatch3D_in(PG_FUNCTION_ARGS)
+{
+	char	   *str = pstrdup(PG_GETARG_CSTRING(0));
+	char	   *at = strrchr(str, '@');
+	double		scale = 0.0;
+	Path3D	   *path;
+	PointPatch3D *result;
+
+	if (at != NULL)
+	{
+		char	   *start = at + 1;
+		char	   *s;
+
+		*at = '\0';
+		while (isspace((unsigned char) *start))
+			start++;
+		if (!single_decode(start, &scale, &s) || s == start || *s != '\0')
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+					 errmsg("Invalid input syntax for type pointpatch3D: \"%s\"",
+						PG_GETARG_CSTRING(0))));
+		pointpatch3D_check_scale(scale);
+	}
+
+	path = DatumGetPath3DP(DirectFunctionCall1(path3D_in, CStringGetDatum(str)));
+	result = pointpatch3D_make(path->p, path->npts, scale);
+	pfree(path);
+	pfree(str);
+	PG_RETURN_POINTPATCH3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_in);
+
+/*
+ * pointpatch3D_out: Convert internal PointPatch3D representation to
+ * character string
+ *
+ * Output format:
+ *		"[(x0,y0,z0),...,(xn,yn,zn)]" (unquantized)
+ *		"[(x0,y0,z0),...,(xn,yn,zn)]@scale" (quantized)
+ */
+Datum
+pointpatch3D_out(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_P(0);
+	int			size = offsetof(Path3D, p) + sizeof(Point3D) * patch->npts;
+	Path3D	   *path = (Path3D *) palloc0(size);
+	StringInfoData str;
+
+	SET_VARSIZE(path, size);
+	path->npts = patch->npts;
+	path->closed = FALSE;
+	path->boundbox = patch->boundbox;
+	pointpatch3D_decode(patch, path->p);
+
+	initStringInfo(&str);
+	appendStringInfoString(&str,
+		DatumGetCString(DirectFunctionCall1(path3D_out, Path3DPGetDatum(path))));
+	if (patch->flags & POINTPATCH3D_QUANTIZED)
+	{
+		appendStringInfoChar(&str, '@');
+		single_encode(patch->scale, &str);
+	}
+	pfree(path);
+	PG_RETURN_CSTRING(str.data);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_out);
+
+/*
+ * pointpatch3D_recv: Convert external binary representation to PointPatch3D
+ *
+ * External representation is int32 number of points, float8 scale, which
+ * is 0 for unquantized patches, and the points. As for the text format, the
+ * points of a quantized patch are quantized again to its scale.
+ */
+Datum
+pointpatch3D_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	PointPatch3D *result;
+	Point3D    *points;
+	int32		npts;
+	double		scale;
+
+	npts = pq_getmsgint(buf, sizeof(int32));
+	if (npts <= 0 || npts > POINTPATCH3D_MAXPTS)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+			 errmsg("Invalid number of points in external \"pointpatch3D\" value")));
+	scale = pq_getmsgfloat8(buf);
+	if (scale < 0.0 || isinf(scale) || isnan(scale))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+			 errmsg("Invalid scale in external \"pointpatch3D\" value")));
+
+	/* pointpatch3D_make computes the exact bounding box of the points */
+	points = (Point3D *) palloc(sizeof(Point3D) * npts);
+	point3D_array_recv(buf, points, npts, NULL);
+
+	result = pointpatch3D_make(points, npts, scale);
+	pfree(points);
+	PG_RETURN_POINTPATCH3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_recv);
+
+/*
+ * pointpatch3D_send: Convert PointPatch3D to binary representation
+ */
+Datum
+pointpatch3D_send(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_P(0);
+	Point3D    *points = pointpatch3D_points_internal(patch);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, patch->npts, sizeof(int32));
+	pq_sendfloat8(&buf, (patch->flags & POINTPATCH3D_QUANTIZED) ?
+		patch->scale : 0.0);
+	point3D_array_send(&buf, points, patch->npts);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_send);
+
+/*****************************************************************************
+ * Constructors and accessors
+ *****************************************************************************/
+
+/*
+ * pointpatch3D_construct: Form a PointPatch3D from an array of Point3D
+ */
+Datum
+pointpatch3D_construct(PG_FUNCTION_ARGS)
+{
+	ArrayType  *array = PG_GETARG_ARRAYTYPE_P(0);
+	PointPatch3D *result;
+	Point3D    *points;
+	Datum	   *elems;
+	bool	   *nulls;
+	int			nelems;
+	int			npts = 0;
+	int			i;
+
+	deconstruct_array(array, point3d_oid(), sizeof(Point3D), FALSE, 'd',
+		&elems, &nulls, &nelems);
+	points = (Point3D *) palloc(sizeof(Point3D) * Max(nelems, 1));
+	for (i = 0; i < nelems; i++)
+	{
+		if (!nulls[i])
+			points[npts++] = *DatumGetPoint3DP(elems[i]);
+	}
+
+	result = pointpatch3D_make(points, npts, 0.0);
+	pfree(points);
+	PG_RETURN_POINTPATCH3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_construct);
+
+/*
+ * pointpatch3D_quantize: Quantize the points of the PointPatch3D to multiples
+ * of scale from the low corner of its bounding box
+ *
+ * A scale of 0 returns a patch that is not quantized.
+ */
+Datum
+pointpatch3D_quantize(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_P(0);
+	double		scale = PG_GETARG_FLOAT8(1);
+	Point3D    *points;
+	PointPatch3D *result;
+
+	pointpatch3D_check_scale(scale);
+	points = pointpatch3D_points_internal(patch);
+	result = pointpatch3D_make(points, patch->npts, scale);
+	PG_FREE_IF_COPY(patch, 0);
+	PG_RETURN_POINTPATCH3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_quantize);
+
+/*
+ * The following accessors only need the header of the patch, which avoids
+ * fetching and decompressing the whole patch when it is toasted
+ */
+Datum
+pointpatch3D_npoints(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_HEADER(0);
+	int32		result = patch->npts;
+
+	PG_FREE_IF_COPY(patch, 0);
+	PG_RETURN_INT32(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_npoints);
+
+Datum
+pointpatch3D_boundbox(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_HEADER(0);
+	Box3D	   *result = (Box3D *) palloc(sizeof(Box3D));
+
+	*result = patch->boundbox;
+	PG_FREE_IF_COPY(patch, 0);
+	PG_RETURN_BOX3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_boundbox);
+
+Datum
+pointpatch3D_scale(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_HEADER(0);
+	double		result = patch->scale;
+
+	PG_FREE_IF_COPY(patch, 0);
+	PG_RETURN_FLOAT8(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_scale);
+
+/*
+ * pointpatch3D_points: Return the points of the PointPatch3D
+ */
+Datum
+pointpatch3D_points(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_P(0);
+	Point3D    *points = pointpatch3D_points_internal(patch);
+	Datum	   *d = (Datum *) palloc(sizeof(Datum) * patch->npts);
+	ArrayType  *result;
+
+	for (int i = 0; i < patch->npts; i++)
+		d[i] = Point3DPGetDatum(&points[i]);
+
+	result = construct_array(d, patch->npts, point3d_oid(), sizeof(Point3D), FALSE, 'd');
+
+	PG_RETURN_ARRAYTYPE_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_points);
+
+/*****************************************************************************
+ * Set-returning functions
+ *****************************************************************************/
+
+typedef struct
+{
+	Point3D    *points;
+	int			npts;
+	int			next;			/* next point to consider */
+	bool		filter;			/* only return the points contained in box */
+	Box3D		box;
+} PointPatch3DIterator;
+
+/*
+ * Return the points of the patch in argument 0, restricted to those
+ * contained in the box in argument 1 when filter is true
+ */
+static Datum
+pointpatch3D_iterate(FunctionCallInfo fcinfo, bool filter)
+{
+	FuncCallContext *funcctx;
+	PointPatch3DIterator *iter;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		PointPatch3D *header = PG_GETARG_POINTPATCH3D_HEADER(0);
+		bool		all = true;
+		bool		none = false;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+
+		iter = (PointPatch3DIterator *) palloc0(sizeof(PointPatch3DIterator));
+		if (filter)
+		{
+			iter->box = *PG_GETARG_BOX3D_P(1);
+			/* Test the header first to avoid decoding the patch if possible */
+			none = !overlap_box3D_box3D_internal(&header->boundbox, &iter->box);
+			all = contain_box3D_box3D_internal(&iter->box, &header->boundbox);
+			iter->filter = !all;
+		}
+		if (!none)
+		{
+			PointPatch3D *patch = PG_GETARG_POINTPATCH3D_P(0);
+
+			iter->npts = patch->npts;
+			iter->points = (Point3D *) palloc(sizeof(Point3D) * patch->npts);
+			pointpatch3D_decode(patch, iter->points);
+		}
+		funcctx->user_fctx = iter;
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	iter = (PointPatch3DIterator *) funcctx->user_fctx;
+
+	while (iter->next < iter->npts)
+	{
+		Point3D    *point = &iter->points[iter->next++];
+
+		if (!iter->filter || contained_point3D_box3D_internal(point, &iter->box))
+			SRF_RETURN_NEXT(funcctx, Point3DPGetDatum(point));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+
+/*
+ * pointpatch3D_explode: Return the points of the PointPatch3D as a set
+ */
+Datum
+pointpatch3D_explode(PG_FUNCTION_ARGS)
+{
+	return pointpatch3D_iterate(fcinfo, false);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_explode);
+
+/*
+ * pointpatch3D_filter: Return the points of the PointPatch3D that are
+ * contained in the Box3D as a set
+ */
+Datum
+pointpatch3D_filter(PG_FUNCTION_ARGS)
+{
+	return pointpatch3D_iterate(fcinfo, true);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_filter);
+
+/*****************************************************************************
+ * Operators
+ *****************************************************************************/
+
+/*
+ * overlap_pointpatch3D_box3D: Does some point of the PointPatch3D lie in the
+ * Box3D?
+ */
+Datum
+overlap_pointpatch3D_box3D(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *header = PG_GETARG_POINTPATCH3D_HEADER(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	PointPatch3D *patch;
+	Point3D    *points;
+	bool		result = false;
+	int			i;
+
+	if (!overlap_box3D_box3D_internal(&header->boundbox, box))
+		PG_RETURN_BOOL(false);
+	if (contain_box3D_box3D_internal(box, &header->boundbox))
+		PG_RETURN_BOOL(true);
+
+	patch = PG_GETARG_POINTPATCH3D_P(0);
+	points = pointpatch3D_points_internal(patch);
+	for (i = 0; i < patch->npts && !result; i++)
+		result = contained_point3D_box3D_internal(&points[i], box);
+
+	PG_RETURN_BOOL(result);
+}
+
+PG_FUNCTION_INFO_V1(overlap_pointpatch3D_box3D);
+
+/*
+ * contained_pointpatch3D_box3D: Are all the points of the PointPatch3D in
+ * the Box3D? The bounding box of a patch is exact so the header suffices.
+ */
+Datum
+contained_pointpatch3D_box3D(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *header = PG_GETARG_POINTPATCH3D_HEADER(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	bool		result = contain_box3D_box3D_internal(box, &header->boundbox);
+
+	PG_FREE_IF_COPY(header, 0);
+	PG_RETURN_BOOL(result);
+}
+
+PG_FUNCTION_INFO_V1(contained_pointpatch3D_box3D);
+
+/*
+ * distance_pointpatch3D_point3D: Distance from the nearest point of the
+ * PointPatch3D to the Point3D
+ */
+Datum
+distance_pointpatch3D_point3D(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_P(0);
+	Point3D    *point = PG_GETARG_POINT3D_P(1);
+	Point3D    *points = pointpatch3D_points_internal(patch);
+	double		result = dist_point3D_point3D(&points[0], point);
+	int			i;
+
+	for (i = 1; i < patch->npts; i++)
+	{
+		double		dist = dist_point3D_point3D(&points[i], point);
+
+		if (dist < result)
+			result = dist;
+	}
+
+	PG_FREE_IF_COPY(patch, 0);
+	PG_RETURN_FLOAT8(result);
+}
+
+PG_FUNCTION_INFO_V1(distance_pointpatch3D_point3D);
+
+/*****************************************************************************
+ * Aggregate packing points into patches
+ *****************************************************************************/
+
+typedef struct
+{
+	int32		maxpts;			/* maximum number of points per patch */
+	Size		npts;
+	Size		size;			/* allocated size of points */
+	Point3D    *points;
+} PointPatch3DPackState;
+
+typedef struct
+{
+	uint64		code;
+	Point3D		point;
+} MortonPoint3D;
+
+static inline uint32
+morton3D_cell(double value, double low, double extent)
+{
+	if (extent <= 0.0)
+		return 0;
+	return (uint32) ((value - low) / extent * MORTON3D_MAXCELL);
+}
+
+static int
+morton3D_cmp(const void *a, const void *b)
+{
+	uint64		ca = ((const MortonPoint3D *) a)->code;
+	uint64		cb = ((const MortonPoint3D *) b)->code;
+
+	if (ca == cb)
+		return 0;
+	return (ca > cb) ? 1 : -1;
+}
+
+/*
+ * pointpatch3D_pack_transfn: Accumulate the points in the aggregate context
+ */
+Datum
+pointpatch3D_pack_transfn(PG_FUNCTION_ARGS)
+{
+	MemoryContext aggcontext;
+	PointPatch3DPackState *state;
+
+	if (!AggCheckCallContext(fcinfo, &aggcontext))
+		elog(ERROR, "pointpatch3D_pack_transfn called in non-aggregate context");
+
+	if (PG_ARGISNULL(0))
+	{
+		int32		maxpts = PG_ARGISNULL(2) ? 0 : PG_GETARG_INT32(2);
+
+		pointpatch3D_check_npts(maxpts);
+		state = (PointPatch3DPackState *) MemoryContextAllocZero(aggcontext,
+			sizeof(PointPatch3DPackState));
+		state->maxpts = maxpts;
+		state->size = 1024;
+		state->points = (Point3D *) MemoryContextAlloc(aggcontext,
+			sizeof(Point3D) * state->size);
+	}
+	else
+		state = (PointPatch3DPackState *) PG_GETARG_POINTER(0);
+
+	if (!PG_ARGISNULL(1))
+	{
+		if (state->npts == state->size)
+		{
+			state->size *= 2;
+			state->points = (Point3D *) repalloc_huge(state->points,
+				sizeof(Point3D) * state->size);
+		}
+		state->points[state->npts++] = *PG_GETARG_POINT3D_P(1);
+	}
+
+	PG_RETURN_POINTER(state);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_pack_transfn);
+
+/*
+ * pointpatch3D_pack_finalfn: Sort the points on their Morton code in the
+ * bounding box of all the points and cut the sorted points into patches of
+ * maxpts points, so that each patch covers a compact region of space
+ */
+Datum
+pointpatch3D_pack_finalfn(PG_FUNCTION_ARGS)
+{
+	PointPatch3DPackState *state;
+	MortonPoint3D *sorted;
+	Point3D    *points;
+	Box3D		box;
+	double		dx,
+				dy,
+				dz;
+	Datum	   *patches;
+	int			npatches;
+	Size		i;
+	int			j;
+	ArrayType  *result;
+
+	if (PG_ARGISNULL(0))
+		PG_RETURN_NULL();
+	state = (PointPatch3DPackState *) PG_GETARG_POINTER(0);
+	if (state->npts == 0)
+		PG_RETURN_NULL();
+
+	pointpatch3D_make_bbox(&box, state->points, state->npts);
+	dx = box.high.x - box.low.x;
+	dy = box.high.y - box.low.y;
+	dz = box.high.z - box.low.z;
+
+	sorted = (MortonPoint3D *) MemoryContextAllocHuge(CurrentMemoryContext,
+		sizeof(MortonPoint3D) * state->npts);
+	for (i = 0; i < state->npts; i++)
+	{
+		Point3D    *p = &state->points[i];
+
+		sorted[i].code = morton3D_encode(morton3D_cell(p->x, box.low.x, dx),
+			morton3D_cell(p->y, box.low.y, dy),
+			morton3D_cell(p->z, box.low.z, dz));
+		sorted[i].point = *p;
+	}
+	qsort(sorted, state->npts, sizeof(MortonPoint3D), morton3D_cmp);
+
+	npatches = (int) ((state->npts + state->maxpts - 1) / state->maxpts);
+	patches = (Datum *) palloc(sizeof(Datum) * npatches);
+	points = (Point3D *) palloc(sizeof(Point3D) * state->maxpts);
+	for (j = 0; j < npatches; j++)
+	{
+		Size		first = (Size) j * state->maxpts;
+		int			n = (int) Min((Size) state->maxpts, state->npts - first);
+
+		for (i = 0; i < (Size) n; i++)
+			points[i] = sorted[first + i].point;
+		patches[j] = PointPatch3DPGetDatum(pointpatch3D_make(points, n, 0.0));
+	}
+	pfree(points);
+	pfree(sorted);
+
+	result = construct_array(patches, npatches, pointpatch3d_oid(), -1, FALSE, 'd');
+
+	PG_RETURN_ARRAYTYPE_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_pack_finalfn);
+
+/*****************************************************************************/
@@ -416,6 +416,153 @@ spgist_octree_leaf_consistent(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(spgist_octree_leaf_consistent);
 
+/*****************************************************************************
+ * Octree over single-precision points
+ *
+ * The leaves are the Point3DF themselves while the centroids stored as
+ * prefixes are Point3D, so that spgist_octree_config is shared. Leaves and
+ * queries are widened and the functions above are called.
+ *****************************************************************************/
+
+Datum
+spgist_octreeF_choose(PG_FUNCTION_ARGS)
+{
+	spgChooseIn *in = (spgChooseIn *) PG_GETARG_POINTER(0);
+	spgChooseOut *out = (spgChooseOut *) PG_GETARG_POINTER(1);
+	Point3D		inPoint,
+			   *centroid;
+
+	out->resultType = spgMatchNode;
+	/* nodeN will be set by core when allTheSame */
+	out->result.matchNode.levelAdd = 0;
+	out->result.matchNode.restDatum = in->datum;
+
+	if (in->allTheSame)
+		PG_RETURN_VOID();
+
+	Assert(in->hasPrefix);
+	centroid = DatumGetPoint3DP(in->prefixDatum);
+
+	Assert(in->nNodes == 8);
+
+	point3DF_point3D_internal(DatumGetPoint3DFP(in->datum), &inPoint);
+	out->result.matchNode.nodeN = getOctant(centroid, &inPoint) - 1;
+
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(spgist_octreeF_choose);
+
+Datum
+spgist_octreeF_picksplit(PG_FUNCTION_ARGS)
+{
+	spgPickSplitIn *in = (spgPickSplitIn *) PG_GETARG_POINTER(0);
+	spgPickSplitOut *out = (spgPickSplitOut *) PG_GETARG_POINTER(1);
+	Point3D	   *points,
+			   *centroid;
+	int			i;
+
+	points = palloc(sizeof(Point3D) * in->nTuples);
+	for (i = 0; i < in->nTuples; i++)
+		point3DF_point3D_internal(DatumGetPoint3DFP(in->datums[i]), &points[i]);
+
+	/* Use the average values of x, y, and z as the centroid point */
+	centroid = palloc0(sizeof(*centroid));
+
+	for (i = 0; i < in->nTuples; i++)
+	{
+		centroid->x += points[i].x;
+		centroid->y += points[i].y;
+		centroid->z += points[i].z;
+	}
+
+	centroid->x /= in->nTuples;
+	centroid->y /= in->nTuples;
+	centroid->z /= in->nTuples;
+
+	out->hasPrefix = true;
+	out->prefixDatum = Point3DPGetDatum(centroid);
+
+	out->nNodes = 8;
+	out->nodeLabels = NULL;		/* we don't need node labels */
+
+	out->mapTuplesToNodes = palloc(sizeof(int) * in->nTuples);
+	out->leafTupleDatums = palloc(sizeof(Datum) * in->nTuples);
+
+	for (i = 0; i < in->nTuples; i++)
+	{
+		out->leafTupleDatums[i] = in->datums[i];
+		out->mapTuplesToNodes[i] = getOctant(centroid, &points[i]) - 1;
+	}
+
+	pfree(points);
+
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(spgist_octreeF_picksplit);
+
+/*
+ * Copy the scan keys replacing their single-precision arguments by their
+ * widened counterparts
+ */
+static ScanKey
+spgist_octreeF_widen_scankeys(FmgrInfo *flinfo, ScanKey scankeys, int nkeys)
+{
+	ScanKey		result = (ScanKey) palloc(sizeof(ScanKeyData) * nkeys);
+	int			i;
+
+	for (i = 0; i < nkeys; i++)
+	{
+		result[i] = scankeys[i];
+		result[i].sk_argument = geo3DF_widen_query(flinfo, scankeys[i].sk_argument,
+			scankeys[i].sk_strategy / Geo3DStrategyNumberOffset);
+	}
+	return result;
+}
+
+Datum
+spgist_octreeF_inner_consistent(PG_FUNCTION_ARGS)
+{
+	spgInnerConsistentIn *in = (spgInnerConsistentIn *) PG_GETARG_POINTER(0);
+	spgInnerConsistentIn widened = *in;
+
+	widened.scankeys = spgist_octreeF_widen_scankeys(fcinfo->flinfo,
+		in->scankeys, in->nkeys);
+	DirectFunctionCall2(spgist_octree_inner_consistent,
+		PointerGetDatum(&widened), PG_GETARG_DATUM(1));
+	pfree(widened.scankeys);
+
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(spgist_octreeF_inner_consistent);
+
+Datum
+spgist_octreeF_leaf_consistent(PG_FUNCTION_ARGS)
+{
+	spgLeafConsistentIn *in = (spgLeafConsistentIn *) PG_GETARG_POINTER(0);
+	spgLeafConsistentOut *out = (spgLeafConsistentOut *) PG_GETARG_POINTER(1);
+	spgLeafConsistentIn widened = *in;
+	Point3D		datum;
+	bool		res;
+
+	point3DF_point3D_internal(DatumGetPoint3DFP(in->leafDatum), &datum);
+	widened.leafDatum = Point3DPGetDatum(&datum);
+	widened.scankeys = spgist_octreeF_widen_scankeys(fcinfo->flinfo,
+		in->scankeys, in->nkeys);
+	res = DatumGetBool(DirectFunctionCall2(spgist_octree_leaf_consistent,
+		PointerGetDatum(&widened), PointerGetDatum(out)));
+	pfree(widened.scankeys);
+
+	/* return the Point3DF and not the widened point */
+	out->leafValue = in->leafDatum;
+
+	PG_RETURN_BOOL(res);
+}
+
+PG_FUNCTION_INFO_V1(spgist_octreeF_leaf_consistent);
+
 /*
  *  Inner consistency for Point3D
  */
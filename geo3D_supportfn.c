@@ -0,0 +1,853 @@
+/*****************************************************************************
+ *
+ * geo3D_supportfn.c
+ *	  Planner support functions of the 3D functions
+ *
+ * The planner uses an index only for the operators of its operator class,
+ * so that calls of the functions behind these operators, or of functions
+ * taking more than two arguments such as dwithin3D(a, b, dist), would never
+ * use one. The support functions below derive from such a call, for an
+ * index on either of its first two arguments, a lossy index condition on
+ * the bounding box of the other argument, which the GiST and SP-GiST
+ * operator classes of the extension evaluate, the function being rechecked
+ * on the rows found by the index:
+ *		overlap_*(a, b), intersect_*(a, b)	a && boundbox(b)
+ *		contain_*(a, b)						a @> boundbox(b) if a is a Box3D
+ *		contained_*(a, b)					a <@ boundbox(b)
+ *		dwithin3D(a, b, dist)				a && expand(boundbox(b), dist)
+ * and symmetrically for an index on b. Since an index on Point3D has no &&
+ * operator, a point is searched with <@ instead.
+ *
+ * The support functions also estimate the cost of a call from the number of
+ * vertices of its Path3D and Polygon3D arguments, read from constants or
+ * derived from the average width of columns in their statistics, so that
+ * the planner evaluates the cheap quals of a WHERE clause first and
+ * prefers an index to evaluating an expensive predicate on every row. The
+ * kernels of the topological functions are classified as follows:
+ *		no Path3D or Polygon3D argument		constant, the default cost of 1
+ *		one of n vertices					linear, cost n
+ *		two of n and m vertices				quadratic, cost n * m
+ * The numbers of rows of the set-returning functions over point patches
+ * and voxel cells are estimated in the same way.
+ *
+ * A call morton3D_within(key, box, size) or hilbert3D_within(key, box,
+ * size) with a constant box and size uses a btree index on the key, the
+ * keys of the voxels of the box being searched as a list if there are few
+ * of them, and as the range enclosing them otherwise.
+ *
+ * The containment operators of OctCell3D with a constant cell use a btree
+ * index on the cells without a recheck, since the descendants of a cell
+ * are the cells between its first and last leaf, and its ancestors are
+ * known:
+ *		a <@ q		a >= first leaf of q AND a <= last leaf of q
+ *		a @> q		a = ANY(ancestors of q and q)
+ *
+ * The functions editing a Path3D or a Polygon3D, such as path3D_append,
+ * tell PL/pgSQL that in an assignment path := path3D_append(path, point)
+ * the variable can be passed as a read-write expanded object, which they
+ * edit in place, see geo3D_expanded.c. This request only exists from
+ * PostgreSQL 18.
+ *
+ * Support functions need PostgreSQL 12 or later, where the installation
+ * script attaches them to the functions. They return NULL otherwise.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#if PG_VERSION_NUM >= 120000
+#include <access/stratnum.h>
+#include <catalog/pg_type.h>
+#include <nodes/makefuncs.h>
+#include <nodes/nodeFuncs.h>
+#include <nodes/pathnodes.h>
+#include <nodes/pg_list.h>
+#include <nodes/supportnodes.h>
+#include <nodes/value.h>
+#include <optimizer/cost.h>
+#include <optimizer/optimizer.h>
+#include <parser/parse_func.h>
+#include <utils/array.h>
+#include <utils/lsyscache.h>
+#endif
+
+#include "geo3D_decls.h"
+
+#if PG_VERSION_NUM >= 120000
+
+/* Number of vertices assumed for a value without statistics */
+#define GEO3D_DEFAULT_NPTS		16
+
+/*
+ * Call of the function of the given name on the arguments, or NULL if no
+ * such function returns the given type
+ */
+static Expr *
+geo3D_funcexpr(const char *name, List *args, Oid rettype)
+{
+	Oid			argtypes[2];
+	int			nargs = 0;
+	Oid			funcid;
+	ListCell   *lc;
+
+	Assert(list_length(args) <= 2);
+	foreach(lc, args)
+		argtypes[nargs++] = exprType((Node *) lfirst(lc));
+
+	funcid = LookupFuncName(list_make1(makeString(pstrdup(name))), nargs,
+		argtypes, true);
+	if (!OidIsValid(funcid) || get_func_rettype(funcid) != rettype)
+		return NULL;
+	return (Expr *) makeFuncExpr(funcid, rettype, args, InvalidOid,
+		InvalidOid, COERCE_EXPLICIT_CALL);
+}
+
+/*
+ * Box3D bounding the value of the expression, or NULL if its type has no
+ * bounding box
+ */
+static Expr *
+geo3D_boundbox_expr(Expr *expr)
+{
+	if (exprType((Node *) expr) == box3d_oid())
+		return expr;
+	return geo3D_funcexpr("boundbox", list_make1(expr), box3d_oid());
+}
+
+/*
+ * Lossy index condition comparing the indexed expression with the search
+ * box using the strategy, or overlap if the operator family of the index
+ * has no operator for it, or NIL if it has none for either. Points, which
+ * have no overlap operator, are compared by containment in the box.
+ */
+static List *
+geo3D_box_indexcond(SupportRequestIndexCondition *req, Expr *indexexpr,
+	Expr *box, StrategyNumber strategy)
+{
+	Oid			lefttype = req->index->opcintype[req->indexcol];
+	Oid			opno;
+
+	opno = get_opfamily_member(req->opfamily, lefttype, box3d_oid(),
+		Geo3DStrategyNumberOffset * Box3DStrategyNumberGroup + strategy);
+	if (!OidIsValid(opno))
+		opno = get_opfamily_member(req->opfamily, lefttype, box3d_oid(),
+			Geo3DStrategyNumberOffset * Box3DStrategyNumberGroup +
+			RTOverlapStrategyNumber);
+	if (!OidIsValid(opno) && lefttype == point3d_oid())
+		opno = get_opfamily_member(req->opfamily, lefttype, box3d_oid(),
+			Geo3DStrategyNumberOffset * Box3DStrategyNumberGroup +
+			RTContainedByStrategyNumber);
+	if (!OidIsValid(opno))
+		return NIL;
+
+	req->lossy = true;
+	return list_make1(make_opclause(opno, BOOLOID, false, indexexpr,
+		(Expr *) eval_const_expressions(req->root, (Node *) box),
+		InvalidOid, InvalidOid));
+}
+
+/*
+ * Index condition of a call of a topological function f(a, b). The
+ * strategies are those for an index on a; the index is searched with the
+ * commuted strategy for an index on b.
+ */
+static List *
+geo3D_topo_indexcond(SupportRequestIndexCondition *req,
+	StrategyNumber strategy, StrategyNumber commuted)
+{
+	FuncExpr   *func;
+	Expr	   *other,
+			   *box;
+
+	if (!IsA(req->node, FuncExpr))
+		return NIL;
+	func = (FuncExpr *) req->node;
+	if (list_length(func->args) != 2 || req->indexarg > 1)
+		return NIL;
+
+	other = (Expr *) list_nth(func->args, 1 - req->indexarg);
+	if (!is_pseudo_constant_for_index(req->root, (Node *) other, req->index))
+		return NIL;
+	box = geo3D_boundbox_expr(other);
+	if (box == NULL)
+		return NIL;
+	return geo3D_box_indexcond(req,
+		(Expr *) list_nth(func->args, req->indexarg), box,
+		req->indexarg == 0 ? strategy : commuted);
+}
+
+/*
+ * Estimated number of points of the value of the expression if it is a
+ * Path3D, a Polygon3D, or a PointPatch3D, and 1 otherwise. The number is
+ * read from a constant, or derived from the average width of a column in
+ * its statistics, which is the stored and thus possibly compressed width.
+ */
+static double
+geo3D_npts_estimate(PlannerInfo *root, Node *expr)
+{
+	Oid			typid = exprType(expr);
+	Size		hdrsize;
+	int32		width = 0;
+
+	if (typid == path3d_oid())
+		hdrsize = offsetof(Path3D, p);
+	else if (typid == poly3d_oid())
+		hdrsize = offsetof(Polygon3D, p);
+	else if (typid == pointpatch3d_oid())
+		hdrsize = offsetof(PointPatch3D, data);
+	else
+		return 1.0;
+
+	if (IsA(expr, Const))
+	{
+		Const	   *c = (Const *) expr;
+
+		if (c->constisnull)
+			return 1.0;
+		/* The three types store the number of points at the same place */
+		return Max(DatumGetPath3DP(c->constvalue)->npts, 1);
+	}
+
+	if (IsA(expr, Var) && root != NULL)
+	{
+		Var		   *var = (Var *) expr;
+
+		if (var->varlevelsup == 0 && var->varno > 0 &&
+			var->varno < root->simple_rel_array_size && var->varattno > 0)
+		{
+			RangeTblEntry *rte = planner_rt_fetch(var->varno, root);
+
+			if (rte != NULL && rte->rtekind == RTE_RELATION)
+				width = get_attavgwidth(rte->relid, var->varattno);
+		}
+	}
+	if (width > (int32) hdrsize)
+		return Max((double) (width - hdrsize) / sizeof(Point3D), 1.0);
+	return GEO3D_DEFAULT_NPTS;
+}
+
+/*
+ * Cost of the call as the product of the numbers of points of its
+ * arguments, in units of cpu_operator_cost. Return false if the call is
+ * unknown, in which case the cost declared for the function is used.
+ */
+static bool
+geo3D_cost(SupportRequestCost *req)
+{
+	List	   *args;
+	ListCell   *lc;
+	double		npts = 1.0;
+
+	if (req->node == NULL)
+		return false;
+	if (IsA(req->node, FuncExpr))
+		args = ((FuncExpr *) req->node)->args;
+	else if (IsA(req->node, OpExpr))
+		args = ((OpExpr *) req->node)->args;
+	else
+		return false;
+
+	foreach(lc, args)
+		npts *= geo3D_npts_estimate(req->root, (Node *) lfirst(lc));
+
+	req->startup = 0;
+	req->per_tuple = npts * cpu_operator_cost;
+	return true;
+}
+
+/*
+ * Fraction of the interval [low1, high1] within [low2, high2]
+ */
+static double
+geo3D_overlap_fraction(double low1, double high1, double low2, double high2)
+{
+	double		low = Max(low1, low2),
+				high = Min(high1, high2);
+
+	if (low > high)
+		return 0.0;
+	if (high1 <= low1)
+		return 1.0;
+	return (high - low) / (high1 - low1);
+}
+
+
+/*
+ * Maximum number of ranges of keys computed for an index condition and
+ * maximum number of keys searched as a list
+ */
+#define SFC3D_INDEX_RANGES		32
+#define SFC3D_INDEX_KEYS		256
+
+/*
+ * Index condition of a call morton3D_within(key, box, size), or its
+ * Hilbert counterpart, for a btree index on the key. The voxels of the box
+ * are covered by ranges of keys, which are searched as a list of keys
+ * key = ANY(...) if there are few of them, and otherwise as the single range
+ * key >= lo AND key <= hi enclosing them, since an index condition cannot
+ * be a disjunction of ranges. The function is rechecked on the rows found.
+ */
+static List *
+sfc3D_within_indexcond(SupportRequestIndexCondition *req, bool hilbert)
+{
+	FuncExpr   *func;
+	Expr	   *key;
+	Const	   *box,
+			   *size;
+	double		s;
+	uint32		lo[3],
+				hi[3];
+	uint64	   *ranges = NULL;
+	uint64		nkeys = 0;
+	int			nranges,
+				i;
+	Oid			eqop,
+				geop,
+				leop;
+
+	if (!IsA(req->node, FuncExpr) || req->indexarg != 0 ||
+		req->index->opcintype[req->indexcol] != INT8OID)
+		return NIL;
+	func = (FuncExpr *) req->node;
+	if (list_length(func->args) != 3 ||
+		!IsA(lsecond(func->args), Const) || !IsA(lthird(func->args), Const))
+		return NIL;
+	key = (Expr *) linitial(func->args);
+	box = (Const *) lsecond(func->args);
+	size = (Const *) lthird(func->args);
+	if (box->constisnull || size->constisnull)
+		return NIL;
+	s = DatumGetFloat8(size->constvalue);
+	if (!(s > 0.0) || isinf(s))
+		return NIL;
+
+	eqop = get_opfamily_member(req->opfamily, INT8OID, INT8OID,
+		BTEqualStrategyNumber);
+	geop = get_opfamily_member(req->opfamily, INT8OID, INT8OID,
+		BTGreaterEqualStrategyNumber);
+	leop = get_opfamily_member(req->opfamily, INT8OID, INT8OID,
+		BTLessEqualStrategyNumber);
+	if (!OidIsValid(eqop) || !OidIsValid(geop) || !OidIsValid(leop))
+		return NIL;
+
+	req->lossy = true;
+	if (!sfc3D_box_cells(DatumGetBox3DP(box->constvalue), s, lo, hi))
+		/* No key is in the box, search an empty list */
+		nranges = 0;
+	else
+	{
+		nranges = sfc3D_ranges(hilbert, lo, hi, SFC3D_INDEX_RANGES, &ranges);
+		for (i = 0; i < nranges && nkeys <= SFC3D_INDEX_KEYS; i++)
+			nkeys += ranges[2 * i + 1] - ranges[2 * i] + 1;
+	}
+
+	if (nkeys <= SFC3D_INDEX_KEYS)
+	{
+		ScalarArrayOpExpr *saop = makeNode(ScalarArrayOpExpr);
+		Datum	   *keys = (Datum *) palloc(sizeof(Datum) * (nkeys + 1));
+		int			n = 0;
+		uint64		k;
+
+		for (i = 0; i < nranges; i++)
+		{
+			for (k = ranges[2 * i]; k <= ranges[2 * i + 1]; k++)
+				keys[n++] = Int64GetDatum((int64) k);
+		}
+		saop->opno = eqop;
+		saop->opfuncid = get_opcode(eqop);
+		saop->useOr = true;
+		saop->inputcollid = InvalidOid;
+		saop->args = list_make2(key, makeConst(INT8ARRAYOID, -1, InvalidOid,
+			-1, PointerGetDatum(construct_array(keys, n, INT8OID,
+				sizeof(int64), FLOAT8PASSBYVAL, 'd')), false, false));
+		saop->location = -1;
+		return list_make1(saop);
+	}
+	return list_make2(
+		make_opclause(geop, BOOLOID, false, key,
+			(Expr *) makeConst(INT8OID, -1, InvalidOid, sizeof(int64),
+				Int64GetDatum((int64) ranges[0]), false, FLOAT8PASSBYVAL),
+			InvalidOid, InvalidOid),
+		make_opclause(leop, BOOLOID, false, key,
+			(Expr *) makeConst(INT8OID, -1, InvalidOid, sizeof(int64),
+				Int64GetDatum((int64) ranges[2 * nranges - 1]), false,
+				FLOAT8PASSBYVAL),
+			InvalidOid, InvalidOid));
+}
+
+/*
+ * Constant OctCell3D of the identifier
+ */
+static Const *
+octcell3D_const(uint64 id)
+{
+	OctCell3D  *cell = (OctCell3D *) palloc(sizeof(OctCell3D));
+
+	cell->id = id;
+	return makeConst(octcell3d_oid(), -1, InvalidOid, sizeof(OctCell3D),
+		OctCell3DPGetDatum(cell), false, false);
+}
+
+/*
+ * Exact index condition of a call of the containment operators of
+ * OctCell3D, a @> q if contains is true and a <@ q otherwise, with a
+ * constant cell, for a btree index on a or on q.
+ */
+static List *
+octcell3D_contain_indexcond(SupportRequestIndexCondition *req, bool contains)
+{
+	List	   *args;
+	Expr	   *cell;
+	Const	   *other;
+	uint64		id;
+	Oid			eqop,
+				geop,
+				leop;
+
+	if (IsA(req->node, OpExpr))
+		args = ((OpExpr *) req->node)->args;
+	else if (IsA(req->node, FuncExpr))
+		args = ((FuncExpr *) req->node)->args;
+	else
+		return NIL;
+	if (list_length(args) != 2 || req->indexarg > 1 ||
+		req->index->opcintype[req->indexcol] != octcell3d_oid() ||
+		!IsA(list_nth(args, 1 - req->indexarg), Const))
+		return NIL;
+	cell = (Expr *) list_nth(args, req->indexarg);
+	other = (Const *) list_nth(args, 1 - req->indexarg);
+	if (other->constisnull)
+		return NIL;
+	id = DatumGetOctCell3DP(other->constvalue)->id;
+	/* The commuted operator for an index on q */
+	if (req->indexarg == 1)
+		contains = !contains;
+
+	eqop = get_opfamily_member(req->opfamily, octcell3d_oid(),
+		octcell3d_oid(), BTEqualStrategyNumber);
+	geop = get_opfamily_member(req->opfamily, octcell3d_oid(),
+		octcell3d_oid(), BTGreaterEqualStrategyNumber);
+	leop = get_opfamily_member(req->opfamily, octcell3d_oid(),
+		octcell3d_oid(), BTLessEqualStrategyNumber);
+	if (!OidIsValid(eqop) || !OidIsValid(geop) || !OidIsValid(leop))
+		return NIL;
+
+	req->lossy = false;
+	if (contains)
+	{
+		ScalarArrayOpExpr *saop = makeNode(ScalarArrayOpExpr);
+		Datum		cells[OCTCELL3D_MAXLEVEL + 1];
+		OctCell3D  *ancestors;
+		int			level = octcell3D_id_level(id),
+					n = 0;
+
+		ancestors = (OctCell3D *) palloc(sizeof(OctCell3D) * (level + 1));
+		for (; level >= 0; level--)
+		{
+			ancestors[n].id = octcell3D_id_parent(id, level);
+			cells[n] = OctCell3DPGetDatum(&ancestors[n]);
+			n++;
+		}
+		saop->opno = eqop;
+		saop->opfuncid = get_opcode(eqop);
+		saop->useOr = true;
+		saop->inputcollid = InvalidOid;
+		saop->args = list_make2(cell, makeConst(
+			get_array_type(octcell3d_oid()), -1, InvalidOid, -1,
+			PointerGetDatum(construct_array(cells, n, octcell3d_oid(),
+				sizeof(OctCell3D), false, 'd')), false, false));
+		saop->location = -1;
+		return list_make1(saop);
+	}
+	return list_make2(
+		make_opclause(geop, BOOLOID, false, cell,
+			(Expr *) octcell3D_const(octcell3D_range_min(id)),
+			InvalidOid, InvalidOid),
+		make_opclause(leop, BOOLOID, false, cell,
+			(Expr *) octcell3D_const(octcell3D_range_max(id)),
+			InvalidOid, InvalidOid));
+}
+
+#endif
+
+/*
+ * Support function of dwithin3D(a, b, dist). An index on a is searched
+ * with the box of b expanded by dist, and conversely.
+ */
+Datum
+dwithin3D_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestCost) &&
+		geo3D_cost((SupportRequestCost *) rawreq))
+		PG_RETURN_POINTER(rawreq);
+	if (IsA(rawreq, SupportRequestIndexCondition))
+	{
+		SupportRequestIndexCondition *req =
+			(SupportRequestIndexCondition *) rawreq;
+		FuncExpr   *func;
+		Expr	   *other,
+				   *dist,
+				   *box;
+
+		if (!IsA(req->node, FuncExpr))
+			PG_RETURN_POINTER(NULL);
+		func = (FuncExpr *) req->node;
+		if (list_length(func->args) != 3 || req->indexarg > 1)
+			PG_RETURN_POINTER(NULL);
+
+		other = (Expr *) list_nth(func->args, 1 - req->indexarg);
+		dist = (Expr *) lthird(func->args);
+		if (!is_pseudo_constant_for_index(req->root, (Node *) other,
+				req->index) ||
+			!is_pseudo_constant_for_index(req->root, (Node *) dist,
+				req->index))
+			PG_RETURN_POINTER(NULL);
+
+		box = geo3D_boundbox_expr(other);
+		if (box == NULL)
+			PG_RETURN_POINTER(NULL);
+		box = geo3D_funcexpr("expand", list_make2(box, dist), box3d_oid());
+		if (box == NULL)
+			PG_RETURN_POINTER(NULL);
+		PG_RETURN_POINTER(geo3D_box_indexcond(req,
+			(Expr *) list_nth(func->args, req->indexarg), box,
+			RTOverlapStrategyNumber));
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(dwithin3D_support);
+
+/*
+ * Support function of the overlap_* and intersect_* functions
+ */
+Datum
+overlap3D_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestCost) &&
+		geo3D_cost((SupportRequestCost *) rawreq))
+		PG_RETURN_POINTER(rawreq);
+	if (IsA(rawreq, SupportRequestIndexCondition))
+		PG_RETURN_POINTER(geo3D_topo_indexcond(
+			(SupportRequestIndexCondition *) rawreq,
+			RTOverlapStrategyNumber, RTOverlapStrategyNumber));
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(overlap3D_support);
+
+/*
+ * Support function of the contain_* functions. Only a box containing b
+ * contains the bounding box of b, other types are searched by overlap.
+ */
+Datum
+contain3D_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestCost) &&
+		geo3D_cost((SupportRequestCost *) rawreq))
+		PG_RETURN_POINTER(rawreq);
+	if (IsA(rawreq, SupportRequestIndexCondition))
+	{
+		SupportRequestIndexCondition *req =
+			(SupportRequestIndexCondition *) rawreq;
+
+		PG_RETURN_POINTER(geo3D_topo_indexcond(req,
+			req->index->opcintype[req->indexcol] == box3d_oid() ?
+				RTContainsStrategyNumber : RTOverlapStrategyNumber,
+			RTContainedByStrategyNumber));
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(contain3D_support);
+
+/*
+ * Support function of the contained_* functions
+ */
+Datum
+contained3D_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestCost) &&
+		geo3D_cost((SupportRequestCost *) rawreq))
+		PG_RETURN_POINTER(rawreq);
+	if (IsA(rawreq, SupportRequestIndexCondition))
+	{
+		SupportRequestIndexCondition *req =
+			(SupportRequestIndexCondition *) rawreq;
+
+		PG_RETURN_POINTER(geo3D_topo_indexcond(req,
+			RTContainedByStrategyNumber,
+			req->index->opcintype[req->indexcol] == box3d_oid() ?
+				RTContainsStrategyNumber : RTOverlapStrategyNumber));
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(contained3D_support);
+
+/*
+ * Support function of the functions of Path3D and Polygon3D arguments
+ * that have no index support, which only estimates their cost
+ */
+Datum
+cost3D_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestCost) &&
+		geo3D_cost((SupportRequestCost *) rawreq))
+		PG_RETURN_POINTER(rawreq);
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(cost3D_support);
+
+/*
+ * Support function of pointpatch3D_explode(patch) and
+ * pointpatch3D_filter(patch, box). The points of a patch are all returned
+ * by the former, and by the latter in the proportion of the volume of the
+ * bounding box of the patch within the box when both are constants, or
+ * half of them otherwise.
+ */
+Datum
+pointpatch3D_rows_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestCost) &&
+		geo3D_cost((SupportRequestCost *) rawreq))
+		PG_RETURN_POINTER(rawreq);
+	if (IsA(rawreq, SupportRequestRows))
+	{
+		SupportRequestRows *req = (SupportRequestRows *) rawreq;
+		FuncExpr   *func;
+		Node	   *patch,
+				   *box;
+		double		rows;
+
+		if (req->node == NULL || !IsA(req->node, FuncExpr))
+			PG_RETURN_POINTER(NULL);
+		func = (FuncExpr *) req->node;
+		if (list_length(func->args) < 1)
+			PG_RETURN_POINTER(NULL);
+
+		patch = (Node *) linitial(func->args);
+		rows = geo3D_npts_estimate(req->root, patch);
+		if (list_length(func->args) == 2)
+		{
+			box = (Node *) lsecond(func->args);
+			if (IsA(patch, Const) && !((Const *) patch)->constisnull &&
+				IsA(box, Const) && !((Const *) box)->constisnull)
+			{
+				Box3D	   *b1 = &DatumGetPointPatch3DP(
+					((Const *) patch)->constvalue)->boundbox;
+				Box3D	   *b2 = DatumGetBox3DP(((Const *) box)->constvalue);
+				double		fraction = 1.0;
+
+				/* Each dimension of the patch box covered by the box */
+				fraction *= geo3D_overlap_fraction(b1->low.x, b1->high.x,
+					b2->low.x, b2->high.x);
+				fraction *= geo3D_overlap_fraction(b1->low.y, b1->high.y,
+					b2->low.y, b2->high.y);
+				fraction *= geo3D_overlap_fraction(b1->low.z, b1->high.z,
+					b2->low.z, b2->high.z);
+				rows *= fraction;
+			}
+			else
+				rows *= 0.5;
+		}
+		req->rows = Max(rows, 1.0);
+		PG_RETURN_POINTER(req);
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_rows_support);
+
+/*
+ * Support function of voxelcells3D(geom, voxel_size, distance). When the
+ * voxel size and the distance are constants, an interval of length l
+ * intersects l / size + 1 voxels on average along each axis, where l is
+ * the extent of the geometry plus twice the distance. The extent of a
+ * box that is not a constant is taken as zero.
+ */
+Datum
+voxelcells3D_rows_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestRows))
+	{
+		SupportRequestRows *req = (SupportRequestRows *) rawreq;
+		FuncExpr   *func;
+		Node	   *geom,
+				   *size,
+				   *dist;
+		Box3D		box;
+		double		s,
+					d;
+
+		if (req->node == NULL || !IsA(req->node, FuncExpr))
+			PG_RETURN_POINTER(NULL);
+		func = (FuncExpr *) req->node;
+		if (list_length(func->args) != 3)
+			PG_RETURN_POINTER(NULL);
+		geom = (Node *) linitial(func->args);
+		size = (Node *) lsecond(func->args);
+		dist = (Node *) lthird(func->args);
+		if (!IsA(size, Const) || ((Const *) size)->constisnull ||
+			!IsA(dist, Const) || ((Const *) dist)->constisnull)
+			PG_RETURN_POINTER(NULL);
+		s = DatumGetFloat8(((Const *) size)->constvalue);
+		d = DatumGetFloat8(((Const *) dist)->constvalue);
+		if (!(s > 0.0) || !(d >= 0.0) || isinf(s) || isinf(d))
+			PG_RETURN_POINTER(NULL);
+
+		memset(&box, 0, sizeof(Box3D));
+		if (IsA(geom, Const) && !((Const *) geom)->constisnull &&
+			exprType(geom) == box3d_oid())
+			box = *DatumGetBox3DP(((Const *) geom)->constvalue);
+
+		req->rows = ((box.high.x - box.low.x + 2.0 * d) / s + 1.0) *
+			((box.high.y - box.low.y + 2.0 * d) / s + 1.0) *
+			((box.high.z - box.low.z + 2.0 * d) / s + 1.0);
+		PG_RETURN_POINTER(req);
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(voxelcells3D_rows_support);
+
+/*
+ * Support function of morton3D_within(key, box, size)
+ */
+Datum
+morton3D_within_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestIndexCondition))
+		PG_RETURN_POINTER(sfc3D_within_indexcond(
+			(SupportRequestIndexCondition *) rawreq, false));
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(morton3D_within_support);
+
+/*
+ * Support function of hilbert3D_within(key, box, size)
+ */
+Datum
+hilbert3D_within_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestIndexCondition))
+		PG_RETURN_POINTER(sfc3D_within_indexcond(
+			(SupportRequestIndexCondition *) rawreq, true));
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(hilbert3D_within_support);
+
+/*
+ * Support function of octcell3D_contains(a, q), the function of a @> q
+ */
+Datum
+octcell3D_contains_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestIndexCondition))
+		PG_RETURN_POINTER(octcell3D_contain_indexcond(
+			(SupportRequestIndexCondition *) rawreq, true));
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_contains_support);
+
+/*
+ * Support function of octcell3D_contained(a, q), the function of a <@ q
+ */
+Datum
+octcell3D_contained_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 120000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestIndexCondition))
+		PG_RETURN_POINTER(octcell3D_contain_indexcond(
+			(SupportRequestIndexCondition *) rawreq, false));
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_contained_support);
+
+/*
+ * Support function of path3D_append, path3D_setpoint, poly3D_append,
+ * poly3D_setpoint, and path3D_concat, which let PL/pgSQL pass their first
+ * argument as a read-write pointer when it is the variable being assigned.
+ * This is safe since these functions check their arguments before editing
+ * the object, and a path passed as second argument of path3D_concat is
+ * flattened into a copy even when it is the same variable.
+ */
+Datum
+inplace3D_support(PG_FUNCTION_ARGS)
+{
+#if PG_VERSION_NUM >= 180000
+	Node	   *rawreq = (Node *) PG_GETARG_POINTER(0);
+
+	if (IsA(rawreq, SupportRequestModifyInPlace))
+	{
+		SupportRequestModifyInPlace *req =
+			(SupportRequestModifyInPlace *) rawreq;
+		Param	   *arg;
+
+		if (list_length(req->args) < 1)
+			PG_RETURN_POINTER(NULL);
+		arg = (Param *) linitial(req->args);
+		if (arg != NULL && IsA(arg, Param) &&
+			arg->paramkind == PARAM_EXTERN &&
+			arg->paramid == req->paramid)
+			PG_RETURN_POINTER(arg);
+	}
+#endif
+	PG_RETURN_POINTER(NULL);
+}
+
+PG_FUNCTION_INFO_V1(inplace3D_support);
+
+/*****************************************************************************/
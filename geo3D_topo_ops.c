@@ -2,7 +2,8 @@
  *
  * geo3D_topoo_ops.c
  * Topological operators on 3D geometries:
- *		Overlap, Contain, Contained, Intersect, Interpoint, Closestpoint, Distance
+ *		Overlap, Contain, Contained, Intersect, Interpoint, Closestpoint, Distance,
+ *		Within distance
  *
  * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
  * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
@@ -22,6 +23,9 @@
 #include <miscadmin.h>
 #include <utils/builtins.h>
 #include <catalog/namespace.h>
+#if PG_VERSION_NUM >= 120000
+#include <utils/float.h>
+#endif
 #include "geo3D_decls.h"
 
 /*****************************************************************************
@@ -53,14 +57,8 @@ static void shortest_segm_path3D_sphere(Path3D *path, Sphere *sphere, Point3D *p
 static void shortest_segm_poly3D_poly3D(Polygon3D *poly1, Polygon3D *poly2, Point3D *pa, Point3D *pb);
 static void shortest_segm_poly3D_sphere(Polygon3D *poly, Sphere *sphere, Point3D *pa, Point3D *pb);
 
-static void Face(int i0, int i1, int i2, Point3D *point, Point3D direction,
-    Point3D PtminusExt, Point3D boxExtent, double *lineParameter);
-static void CaseNoZeros(Point3D *pnt, Point3D dir, Point3D boxExtent, double *lineParameter);
-static void Case0(int i0, int i1, int i2, Point3D *point, Point3D direction,
-    Point3D boxExtent, double *lineParameter);	
-static void Case00(int i0, int i1, int i2, Point3D *point, Point3D direction,
-    Point3D boxExtent, double *lineParameter);
-static void Case000(Point3D *pnt, Point3D boxExtent);
+static double closest_param_box3D(Point3D pt, Point3D dir, Box3D *box,
+	double tmin, double tmax);
    
 static bool touched_lseg2D_inside_poly2D(Point3D *a, Point3D *b, Lseg3D *s, Polygon3D *poly, int start);
 static bool lseg2D_inside_poly2D(Point3D *a, Point3D *b, Polygon3D *poly, int start);
@@ -252,33 +250,15 @@ shortest_segm_lseg3D_line3D(Lseg3D *lseg, Line3D *line, Point3D *pa, Point3D *pb
 static void 
 shortest_segm_lseg3D_box3D(Lseg3D *lseg, Box3D *box, Point3D *pa, Point3D *pb)
 {
-	Point3D	   *pb1,
-			   *pb2;
-	Line3D	   *line;
+	Point3D		dir = sub(lseg->p[1], lseg->p[0]),
+			   *pt;
+	double		t;
 
-	line = lseg3D_line3D_internal(lseg);
-	shortest_segm_line3D_box3D(line, box, pa, pb);
-	pfree(line);
-	
-	if (contain_lseg3D_point3D_internal(lseg, pa))
-		return;
-	
-	pb1 = closestpt_point3D_box3D(&lseg->p[0], box);
-	pb2 = closestpt_point3D_box3D(&lseg->p[1], box);
-	if (FPgt(dist_point3D_point3D(&lseg->p[0], pb1), dist_point3D_point3D(&lseg->p[1], pb2)))
-	{
-		*pa = lseg->p[1];
-		*pb = *pb2;
-	}
-	else
-	{
-		*pa = lseg->p[0];
-		*pb = *pb1;		
-	}
-		
-	pfree(pb1);
-	pfree(pb2);
-    return;
+	t = closest_param_box3D(lseg->p[0], dir, box, 0.0, 1.0);
+	*pa = add(lseg->p[0], scalar(t, dir));
+	pt = closestpt_point3D_box3D(pa, box);
+	*pb = *pt;
+	pfree(pt);
 }
 
 /*
@@ -453,422 +433,126 @@ shortest_segm_line3D_line3D(Line3D *line1, Line3D *line2, Point3D *pa, Point3D *
 /*
  * Return in pa and pb the points defining the shortest segment  
  * connecting the Line3D and the Box3D. 
- *
- * Based on https://www.geometrictools.com/GTEngine/Include/Mathematics/GteDistLine3AlignedBox3.h
 */
-
 static void 
 shortest_segm_line3D_box3D(Line3D *line, Box3D *box, Point3D *pa, Point3D *pb)
 {
-    Point3D 		boxCenter, 
-					boxExtent,
-					lineOrigin,
-					lineDirection;
-	double			magn,
-					lineParameter = 0.0;
-	bool 			reflect[3];
+	Point3D		dir = sub(line->p[1], line->p[0]),
+			   *pt;
+	double		t;
 
-    // Get the centered form of the box
-    boxCenter = scalar(0.5, add(box->high, box->low));
-    boxExtent = scalar(0.5, sub(box->high, box->low));
-	
-    // Transform the line to the box coordinate system
-    lineOrigin = sub(line->p[0], boxCenter);
-	lineDirection = sub(line->p[1], line->p[0]);
-	magn = magnitude(lineDirection);
-	lineDirection = scalar(1/magn, lineDirection);	
+	t = closest_param_box3D(line->p[0], dir, box, -get_float8_infinity(),
+		get_float8_infinity());
+	*pa = add(line->p[0], scalar(t, dir));
+	pt = closestpt_point3D_box3D(pa, box);
+	*pb = *pt;
+	pfree(pt);
+}
 
-    // Apply reflections so that direction vector has nonnegative components.
-	if (FPlt(lineDirection.x, 0.0))
-	{
-		lineOrigin.x = -lineOrigin.x;
-		lineDirection.x = -lineDirection.x;
-		reflect[0] = true;
-	}
-	else
-		reflect[0] = false;
+/*
+ * Return the parameter t in [tmin, tmax] of the point pt + t * dir closest
+ * to the Box3D. The squared distance from the point to the box is a convex
+ * function of t that is quadratic between the values of t where the point
+ * crosses the planes of the faces of the box, so that it is minimized on
+ * each of these pieces in turn.
+ */
+static double
+closest_param_box3D(Point3D pt, Point3D dir, Box3D *box, double tmin,
+	double tmax)
+{
+	double		o[3] = {pt.x, pt.y, pt.z},
+				d[3] = {dir.x, dir.y, dir.z},
+				lo[3] = {box->low.x, box->low.y, box->low.z},
+				hi[3] = {box->high.x, box->high.y, box->high.z},
+				ts[8],
+				result = 0.0,
+				min_distance = DBL_MAX;
+	int			nts = 0,
+				i,
+				j;
 
-	if (FPlt(lineDirection.y, 0.0))
+	ts[nts++] = tmin;
+	for (i = 0; i < 3; i++)
 	{
-		lineOrigin.y = -lineOrigin.y;
-		lineDirection.y = -lineDirection.y;
-		reflect[1] = true;
-	}
-	else
-		reflect[1] = false;
+		if (d[i] == 0.0)
+			continue;
+		for (j = 0; j < 2; j++)
+		{
+			double		t = ((j == 0 ? lo[i] : hi[i]) - o[i]) / d[i];
 
-	if (FPlt(lineDirection.z, 0.0))
-	{
-		lineOrigin.z = -lineOrigin.z;
-		lineDirection.z = -lineDirection.z;
-		reflect[2] = true;
+			if (t > tmin && t < tmax)
+				ts[nts++] = t;
+		}
 	}
-	else
-		reflect[2] = false;
-
-    if (FPgt(lineDirection.x, 0.0))
-    {
-        if (FPgt(lineDirection.y, 0.0))
-        {
-            if (FPgt(lineDirection.z, 0.0))  // (+,+,+)
-                CaseNoZeros(&lineOrigin, lineDirection, boxExtent, &lineParameter);
-            else  // (+,+,0)
-                Case0(0, 1, 2, &lineOrigin, lineDirection, boxExtent, &lineParameter);
-        }
-        else
-        {
-            if (FPgt(lineDirection.z, 0.0))  // (+,0,+)
-                Case0(0, 2, 1, &lineOrigin, lineDirection, boxExtent, &lineParameter);
-            else  // (+,0,0)
-                Case00(0, 1, 2, &lineOrigin, lineDirection, boxExtent, &lineParameter);
-        }
-    }
-    else
-    {
-        if (FPgt(lineDirection.y, 0.0))
-        {
-            if (FPgt(lineDirection.z, 0.0))  // (0,+,+)
-                Case0(1, 2, 0, &lineOrigin, lineDirection, boxExtent, &lineParameter);
-            else  // (0,+,0)
-                Case00(1, 0, 2, &lineOrigin, lineDirection, boxExtent, &lineParameter);
-        }
-        else
-        {
-            if (FPgt(lineDirection.z, 0.0))  // (0,0,+)
-                Case00(2, 0, 1, &lineOrigin, lineDirection, boxExtent, &lineParameter);
-            else  // (0,0,0)
-                Case000(&lineOrigin, boxExtent);
-        }
-    }
-
-    // Undo the reflections applied previously.
-	if (reflect[0])
-		lineOrigin.x = -lineOrigin.x;
-	if (reflect[1])
-		lineOrigin.y = -lineOrigin.y;
-	if (reflect[2])
-		lineOrigin.z = -lineOrigin.z;
-
-    // Compute the closest point on the line.
-    *pa = add(line->p[0], scalar(lineParameter, lineDirection));
-
-    // Compute the closest point on the box.
-    *pb = add(boxCenter, lineOrigin);
-}
-
-static void 
-Face(int i0, int i1, int i2, Point3D *point, Point3D direction,
-    Point3D PtminusExt, Point3D boxExtent, double *lineParameter)
-{
-    double 		pnt[3],
-				dir[3],
-				PmE[3],
-				boxExt[3],
-				PpE[3],
-				lenSqr, 
-				inv, 
-				tmp, 
-				param, 
-				t;
-	
-	pnt[0] = point->x;
-	pnt[1] = point->y;
-	pnt[2] = point->z;
-	dir[0] = direction.x;
-	dir[1] = direction.y;
-	dir[2] = direction.z;
-	PmE[0] = PtminusExt.x;
-	PmE[1] = PtminusExt.y;
-	PmE[2] = PtminusExt.z;
-	boxExt[0] = boxExtent.x;
-	boxExt[1] = boxExtent.y;
-	boxExt[2] = boxExtent.z;
-	
-    PpE[i1] = pnt[i1] + boxExt[i1];
-    PpE[i2] = pnt[i2] + boxExt[i2];
-    if (FPge(dir[i0] * PpE[i1], dir[i1] * PmE[i0]))
-    {
-        if (FPge(dir[i0] * PpE[i2], dir[i2] * PmE[i0]))
-        {
-            // v[i1] >= -e[i1], v[i2] >= -e[i2] (distance = 0)
-            pnt[i0] = boxExt[i0];
-            inv = 1.0 / dir[i0];
-            pnt[i1] -= dir[i1] * PmE[i0] * inv;
-            pnt[i2] -= dir[i2] * PmE[i0] * inv;
-            *lineParameter = -PmE[i0] * inv;
-        }
-        else
-        {
-            // v[i1] >= -e[i1], v[i2] < -e[i2]
-            lenSqr = dir[i0] * dir[i0] + dir[i2] * dir[i2];
-            tmp = lenSqr * PpE[i1] - dir[i1] * (dir[i0] * PmE[i0] +
-                dir[i2] * PpE[i2]);
-            if (FPle(tmp, 2.0 * lenSqr * boxExt[i1]))
-            {
-                t = tmp / lenSqr;
-                *lineParameter = param;
-                pnt[i0] = boxExt[i0];
-                pnt[i1] = t - boxExt[i1];
-                pnt[i2] = -boxExt[i2];
-            }
-            else
-            {
-                *lineParameter = param;
-                pnt[i0] = boxExt[i0];
-                pnt[i1] = boxExt[i1];
-                pnt[i2] = -boxExt[i2];
-            }
-        }
-    }
-    else
-    {
-        if (FPge(dir[i0] * PpE[i2], dir[i2] * PmE[i0]))
-        {
-            // v[i1] < -e[i1], v[i2] >= -e[i2]
-            lenSqr = dir[i0] * dir[i0] + dir[i1] * dir[i1];
-            tmp = lenSqr*PpE[i2] - dir[i2] * (dir[i0] * PmE[i0] +
-                dir[i1] * PpE[i1]);
-            if (FPle(tmp, 2.0 * lenSqr * boxExt[i2]))
-            {
-                t = tmp / lenSqr;
-                *lineParameter = param;
-                pnt[i0] = boxExt[i0];
-                pnt[i1] = -boxExt[i1];
-                pnt[i2] = t - boxExt[i2];
-            }
-            else
-            {
-                *lineParameter = param;
-                pnt[i0] = boxExt[i0];
-                pnt[i1] = -boxExt[i1];
-                pnt[i2] = boxExt[i2];
-            }
-        }
-        else
-        {
-            // v[i1] < -e[i1], v[i2] < -e[i2]
-            lenSqr = dir[i0] * dir[i0] + dir[i2] * dir[i2];
-            tmp = lenSqr*PpE[i1] - dir[i1] * (dir[i0] * PmE[i0] +
-                dir[i2] * PpE[i2]);
-            if (FPge(tmp, 0.0))
-            {
-                // v[i1]-edge is closest
-                if (FPle(tmp, 2.0 * lenSqr * boxExt[i1]))
-                {
-                    t = tmp / lenSqr;
-                    *lineParameter = param;
-                    pnt[i0] = boxExt[i0];
-                    pnt[i1] = t - boxExt[i1];
-                    pnt[i2] = -boxExt[i2];
-                }
-                else
-                {
-                    *lineParameter = param;
-                    pnt[i0] = boxExt[i0];
-                    pnt[i1] = boxExt[i1];
-                    pnt[i2] = -boxExt[i2];
-                }
-                return;
-            }
-
-            lenSqr = dir[i0] * dir[i0] + dir[i1] * dir[i1];
-            tmp = lenSqr * PpE[i2] - dir[i2] * (dir[i0] * PmE[i0] +
-                dir[i1] * PpE[i1]);
-            if (FPge(tmp, 0.0))
-            {
-                // v[i2]-edge is closest
-                if (FPle(tmp, 2.0 * lenSqr * boxExt[i2]))
-                {
-                    t = tmp / lenSqr;
-                    *lineParameter = param;
-                    pnt[i0] = boxExt[i0];
-                    pnt[i1] = -boxExt[i1];
-                    pnt[i2] = t - boxExt[i2];
-                }
-                else
-                {
-                    *lineParameter = param;
-                    pnt[i0] = boxExt[i0];
-                    pnt[i1] = -boxExt[i1];
-                    pnt[i2] = boxExt[i2];
-                }
-                return;
-            }
-
-            // (v[i1],v[i2])-corner is closest
-            *lineParameter = param;
-            pnt[i0] = boxExt[i0];
-            pnt[i1] = -boxExt[i1];
-            pnt[i2] = -boxExt[i2];
-        }
-    }
-	
-	point->x = pnt[0];
-	point->y = pnt[1];
-	point->z = pnt[2];
-}
-
-static void 
-CaseNoZeros(Point3D *pnt, Point3D dir, Point3D boxExtent, double *lineParameter)
-{
-    Point3D PmE = sub(*pnt, boxExtent);
-    double prodDxPy = dir.x * PmE.y;
-    double prodDyPx = dir.y * PmE.x;
-    double prodDzPx, prodDxPz, prodDzPy, prodDyPz;
-
-    if (FPge(prodDyPx, prodDxPy))
-    {
-        prodDzPx = dir.z * PmE.x;
-        prodDxPz = dir.x * PmE.z;
-        if (FPge(prodDzPx, prodDxPz))
-            // line intersects x = e0
-            Face(0, 1, 2, pnt, dir, PmE, boxExtent, lineParameter);
-        else
-            // line intersects z = e2
-            Face(2, 0, 1, pnt, dir, PmE, boxExtent, lineParameter);
-    }
-    else
-    {
-        prodDzPy = dir.z * PmE.y;
-        prodDyPz = dir.y * PmE.z;
-        if (FPge(prodDzPy, prodDyPz))
-            // line intersects y = e1
-            Face(1, 2, 0, pnt, dir, PmE, boxExtent, lineParameter);
-        else
-            // line intersects z = e2
-            Face(2, 0, 1, pnt, dir, PmE, boxExtent, lineParameter);
-    }
-}
+	ts[nts++] = tmax;
 
-static void 
-Case0(int i0, int i1, int i2, Point3D *point, Point3D direction,
-    Point3D boxExtent, double *lineParameter)
-{
-	double	pnt[3],
-			dir[3],
-			boxExt[3];
-	
-	pnt[0] = point->x;
-	pnt[1] = point->y;
-	pnt[2] = point->z;
-	dir[0] = direction.x;
-	dir[1] = direction.y;
-	dir[2] = direction.z;
-	boxExt[0] = boxExtent.x;
-	boxExt[1] = boxExtent.y;
-	boxExt[2] = boxExtent.z;
-	
-    double PmE0 = pnt[i0] - boxExt[i0];
-    double PmE1 = pnt[i1] - boxExt[i1];
-    double prod0 = dir[i1] * PmE0;
-    double prod1 = dir[i0] * PmE1;
-    double delta, invLSqr, inv;
+	/* Sort the breakpoints */
+	for (i = 1; i < nts; i++)
+	{
+		double		t = ts[i];
 
-    if (FPge(prod0, prod1))
-    {
-        // line intersects P[i0] = e[i0]
-        pnt[i0] = boxExt[i0];
-
-        double PpE1 = pnt[i1] + boxExt[i1];
-        delta = prod0 - dir[i0] * PpE1;
-        if (FPge(delta, 0.0))
-        {
-            invLSqr = (1.0) / (dir[i0] * dir[i0] + dir[i1] * dir[i1]);
-            pnt[i1] = -boxExt[i1];
-            *lineParameter = -(dir[i0] * PmE0 + dir[i1] * PpE1) * invLSqr;
-        }
-        else
-        {
-            inv = 1.0 / dir[i0];
-            pnt[i1] -= prod0 * inv;
-            *lineParameter = -PmE0 * inv;
-        }
-    }
-    else
-    {
-        // line intersects P[i1] = e[i1]
-        pnt[i1] = boxExt[i1];
-
-        double PpE0 = pnt[i0] + boxExt[i0];
-        delta = prod1 - dir[i1] * PpE0;
-        if (FPge(delta, 0.0))
-        {
-            invLSqr = (1.0) / (dir[i0] * dir[i0] + dir[i1] * dir[i1]);
-            pnt[i0] = -boxExt[i0];
-            *lineParameter = -(dir[i0] * PpE0 + dir[i1] * PmE1) * invLSqr;
-        }
-        else
-        {
-            inv = 1.0 / dir[i1];
-            pnt[i0] -= prod1 * inv;
-            *lineParameter = -PmE1 * inv;
-        }
-    }
+		for (j = i; j > 0 && ts[j - 1] > t; j--)
+			ts[j] = ts[j - 1];
+		ts[j] = t;
+	}
 
-    if (FPlt(pnt[i2], -boxExt[i2]))
-        pnt[i2] = -boxExt[i2];
-    else if (FPgt(pnt[i2], boxExt[i2]))
-        pnt[i2] = boxExt[i2];
-	
-	point->x = pnt[0];
-	point->y = pnt[1];
-	point->z = pnt[2];
-}
+	for (j = 0; j + 1 < nts; j++)
+	{
+		double		t0 = ts[j],
+					t1 = ts[j + 1],
+					tm,
+					a = 0.0,
+					b = 0.0,
+					t,
+					distance = 0.0;
+
+		/* A point inside the piece tells which faces are outside */
+		if (isinf(t0) && isinf(t1))
+			tm = 0.0;
+		else if (isinf(t0))
+			tm = t1 - 1.0;
+		else if (isinf(t1))
+			tm = t0 + 1.0;
+		else
+			tm = (t0 + t1) / 2.0;
 
-static void
-Case00(int i0, int i1, int i2, Point3D *point, Point3D direction,
-    Point3D boxExtent, double *lineParameter)
-{
-	double	pnt[3],
-			dir[3],
-			boxExt[3];
-	
-	pnt[0] = point->x;
-	pnt[1] = point->y;
-	pnt[2] = point->z;
-	dir[0] = direction.x;
-	dir[1] = direction.y;
-	dir[2] = direction.z;
-	boxExt[0] = boxExtent.x;
-	boxExt[1] = boxExtent.y;
-	boxExt[2] = boxExtent.z;	
-
-    *lineParameter = (boxExt[i0] - pnt[i0]) / dir[i0];
-
-    pnt[i0] = boxExt[i0];
-
-    if (FPlt(pnt[i1], -boxExt[i1]))
-        pnt[i1] = -boxExt[i1];
-    else if (FPgt(pnt[i1], boxExt[i1]))
-        pnt[i1] = boxExt[i1];
-
-    if (FPlt(pnt[i2], -boxExt[i2]))
-        pnt[i2] = -boxExt[i2];
-    else if (FPgt(pnt[i2], boxExt[i2]))
-        pnt[i2] = boxExt[i2];
-	
-	point->x = pnt[0];
-	point->y = pnt[1];
-	point->z = pnt[2];
-}
+		/* Sum of the terms (o + t * d - bound)^2 */
+		for (i = 0; i < 3; i++)
+		{
+			double		x = o[i] + tm * d[i],
+						bound;
 
-static void 
-Case000(Point3D *pnt, Point3D boxExtent)
-{
-    if (FPlt(pnt->x, -boxExtent.x))
-        pnt->x = -boxExtent.x;
-    else if (FPgt(pnt->x, boxExtent.x))
-        pnt->x = boxExtent.x;
+			if (x < lo[i])
+				bound = lo[i];
+			else if (x > hi[i])
+				bound = hi[i];
+			else
+				continue;
+			a += d[i] * d[i];
+			b += 2.0 * d[i] * (o[i] - bound);
+		}
+		t = (a > 0.0) ? -b / (2.0 * a) : tm;
+		if (t < t0)
+			t = t0;
+		if (t > t1)
+			t = t1;
 
-    if (FPlt(pnt->y, -boxExtent.y))
-        pnt->y = -boxExtent.y;
-    else if (FPgt(pnt->y, boxExtent.y))
-        pnt->y = boxExtent.y;
+		for (i = 0; i < 3; i++)
+		{
+			double		x = o[i] + t * d[i];
 
-    if (FPlt(pnt->z, -boxExtent.z))
-        pnt->z = -boxExtent.z;
-    else if (FPgt(pnt->z, boxExtent.z))
-        pnt->z = boxExtent.z;
+			if (x < lo[i])
+				distance += (lo[i] - x) * (lo[i] - x);
+			else if (x > hi[i])
+				distance += (x - hi[i]) * (x - hi[i]);
+		}
+		if (distance < min_distance)
+		{
+			min_distance = distance;
+			result = t;
+		}
+	}
+	return result;
 }
 
 /*
@@ -5666,6 +5350,35 @@ box3D_intersection(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(box3D_intersection);
 
+/*
+ * Box3D expanded by the distance in every direction. A negative distance
+ * shrinks the box; a dimension shrunk below zero collapses to its center.
+ */
+Datum
+box3D_expand_dist(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	double		dist = PG_GETARG_FLOAT8(1);
+	Box3D	   *result = (Box3D *) palloc(sizeof(Box3D));
+
+	result->low.x = box->low.x - dist;
+	result->low.y = box->low.y - dist;
+	result->low.z = box->low.z - dist;
+	result->high.x = box->high.x + dist;
+	result->high.y = box->high.y + dist;
+	result->high.z = box->high.z + dist;
+	if (result->low.x > result->high.x)
+		result->low.x = result->high.x = (box->low.x + box->high.x) / 2.0;
+	if (result->low.y > result->high.y)
+		result->low.y = result->high.y = (box->low.y + box->high.y) / 2.0;
+	if (result->low.z > result->high.z)
+		result->low.z = result->high.z = (box->low.z + box->high.z) / 2.0;
+
+	PG_RETURN_BOX3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(box3D_expand_dist);
+
 /*****************************************************************************
  *	Distance functions
  *	Minimum distance from one object to another
@@ -5784,7 +5497,7 @@ distance_aux(double p, double lower, double upper)
 		return lower - p;
 	if (FPgt(p, upper))
 		return p - upper;
-	return Min(p - lower, upper - p);
+	return 0.0;
 }
 
 double
@@ -6889,6 +6602,1076 @@ dist_sphere_sphere(Sphere *sphere1, Sphere *sphere2)
 	return result;
 }
 
+/*****************************************************************************
+ * Within distance functions
+ * Is the minimum distance from one object to another at most a given
+ * distance? The test is exact, that is, it is equivalent to comparing the
+ * result of the distance functions above with the given distance
+ *****************************************************************************/
+
+/* Types of the objects handled by dwithin_geo3D */
+typedef enum
+{
+	GEO3D_POINT3D,
+	GEO3D_LSEG3D,
+	GEO3D_LINE3D,
+	GEO3D_BOX3D,
+	GEO3D_PATH3D,
+	GEO3D_POLY3D,
+	GEO3D_SPHERE
+} Geo3DType;
+
+/*
+ * Distance between two objects of any of the types
+ */
+static double
+dist_geo3D(Geo3DType type1, void *geo1, Geo3DType type2, void *geo2)
+{
+	switch (type1)
+	{
+		case GEO3D_POINT3D:
+			switch (type2)
+			{
+				case GEO3D_POINT3D:
+					return dist_point3D_point3D((Point3D *) geo1, (Point3D *) geo2);
+				case GEO3D_LSEG3D:
+					return dist_point3D_lseg3D((Point3D *) geo1, (Lseg3D *) geo2);
+				case GEO3D_LINE3D:
+					return dist_point3D_line3D((Point3D *) geo1, (Line3D *) geo2);
+				case GEO3D_BOX3D:
+					return dist_point3D_box3D((Point3D *) geo1, (Box3D *) geo2);
+				case GEO3D_PATH3D:
+					return dist_point3D_path3D((Point3D *) geo1, (Path3D *) geo2);
+				case GEO3D_POLY3D:
+					return dist_point3D_poly3D((Point3D *) geo1, (Polygon3D *) geo2);
+				case GEO3D_SPHERE:
+					return dist_point3D_sphere((Point3D *) geo1, (Sphere *) geo2);
+			}
+			break;
+		case GEO3D_LSEG3D:
+			switch (type2)
+			{
+				case GEO3D_POINT3D:
+					return dist_lseg3D_point3D((Lseg3D *) geo1, (Point3D *) geo2);
+				case GEO3D_LSEG3D:
+					return dist_lseg3D_lseg3D((Lseg3D *) geo1, (Lseg3D *) geo2);
+				case GEO3D_LINE3D:
+					return dist_lseg3D_line3D((Lseg3D *) geo1, (Line3D *) geo2);
+				case GEO3D_BOX3D:
+					return dist_lseg3D_box3D((Lseg3D *) geo1, (Box3D *) geo2);
+				case GEO3D_PATH3D:
+					return dist_lseg3D_path3D((Lseg3D *) geo1, (Path3D *) geo2);
+				case GEO3D_POLY3D:
+					return dist_lseg3D_poly3D((Lseg3D *) geo1, (Polygon3D *) geo2);
+				case GEO3D_SPHERE:
+					return dist_lseg3D_sphere((Lseg3D *) geo1, (Sphere *) geo2);
+			}
+			break;
+		case GEO3D_LINE3D:
+			switch (type2)
+			{
+				case GEO3D_POINT3D:
+					return dist_line3D_point3D((Line3D *) geo1, (Point3D *) geo2);
+				case GEO3D_LSEG3D:
+					return dist_line3D_lseg3D((Line3D *) geo1, (Lseg3D *) geo2);
+				case GEO3D_LINE3D:
+					return dist_line3D_line3D((Line3D *) geo1, (Line3D *) geo2);
+				case GEO3D_BOX3D:
+					return dist_line3D_box3D((Line3D *) geo1, (Box3D *) geo2);
+				case GEO3D_PATH3D:
+					return dist_line3D_path3D((Line3D *) geo1, (Path3D *) geo2);
+				case GEO3D_POLY3D:
+					return dist_line3D_poly3D((Line3D *) geo1, (Polygon3D *) geo2);
+				case GEO3D_SPHERE:
+					return dist_line3D_sphere((Line3D *) geo1, (Sphere *) geo2);
+			}
+			break;
+		case GEO3D_BOX3D:
+			switch (type2)
+			{
+				case GEO3D_POINT3D:
+					return dist_box3D_point3D((Box3D *) geo1, (Point3D *) geo2);
+				case GEO3D_LSEG3D:
+					return dist_box3D_lseg3D((Box3D *) geo1, (Lseg3D *) geo2);
+				case GEO3D_LINE3D:
+					return dist_box3D_line3D((Box3D *) geo1, (Line3D *) geo2);
+				case GEO3D_BOX3D:
+					return dist_box3D_box3D((Box3D *) geo1, (Box3D *) geo2);
+				case GEO3D_PATH3D:
+					return dist_box3D_path3D((Box3D *) geo1, (Path3D *) geo2);
+				case GEO3D_POLY3D:
+					return dist_box3D_poly3D((Box3D *) geo1, (Polygon3D *) geo2);
+				case GEO3D_SPHERE:
+					return dist_box3D_sphere((Box3D *) geo1, (Sphere *) geo2);
+			}
+			break;
+		case GEO3D_PATH3D:
+			switch (type2)
+			{
+				case GEO3D_POINT3D:
+					return dist_path3D_point3D((Path3D *) geo1, (Point3D *) geo2);
+				case GEO3D_LSEG3D:
+					return dist_path3D_lseg3D((Path3D *) geo1, (Lseg3D *) geo2);
+				case GEO3D_LINE3D:
+					return dist_path3D_line3D((Path3D *) geo1, (Line3D *) geo2);
+				case GEO3D_BOX3D:
+					return dist_path3D_box3D((Path3D *) geo1, (Box3D *) geo2);
+				case GEO3D_PATH3D:
+					return dist_path3D_path3D((Path3D *) geo1, (Path3D *) geo2);
+				case GEO3D_POLY3D:
+					return dist_path3D_poly3D((Path3D *) geo1, (Polygon3D *) geo2);
+				case GEO3D_SPHERE:
+					return dist_path3D_sphere((Path3D *) geo1, (Sphere *) geo2);
+			}
+			break;
+		case GEO3D_POLY3D:
+			switch (type2)
+			{
+				case GEO3D_POINT3D:
+					return dist_poly3D_point3D((Polygon3D *) geo1, (Point3D *) geo2);
+				case GEO3D_LSEG3D:
+					return dist_poly3D_lseg3D((Polygon3D *) geo1, (Lseg3D *) geo2);
+				case GEO3D_LINE3D:
+					return dist_poly3D_line3D((Polygon3D *) geo1, (Line3D *) geo2);
+				case GEO3D_BOX3D:
+					return dist_poly3D_box3D((Polygon3D *) geo1, (Box3D *) geo2);
+				case GEO3D_PATH3D:
+					return dist_poly3D_path3D((Polygon3D *) geo1, (Path3D *) geo2);
+				case GEO3D_POLY3D:
+					return dist_poly3D_poly3D((Polygon3D *) geo1, (Polygon3D *) geo2);
+				case GEO3D_SPHERE:
+					return dist_poly3D_sphere((Polygon3D *) geo1, (Sphere *) geo2);
+			}
+			break;
+		case GEO3D_SPHERE:
+			switch (type2)
+			{
+				case GEO3D_POINT3D:
+					return dist_sphere_point3D((Sphere *) geo1, (Point3D *) geo2);
+				case GEO3D_LSEG3D:
+					return dist_sphere_lseg3D((Sphere *) geo1, (Lseg3D *) geo2);
+				case GEO3D_LINE3D:
+					return dist_sphere_line3D((Sphere *) geo1, (Line3D *) geo2);
+				case GEO3D_BOX3D:
+					return dist_sphere_box3D((Sphere *) geo1, (Box3D *) geo2);
+				case GEO3D_PATH3D:
+					return dist_sphere_path3D((Sphere *) geo1, (Path3D *) geo2);
+				case GEO3D_POLY3D:
+					return dist_sphere_poly3D((Sphere *) geo1, (Polygon3D *) geo2);
+				case GEO3D_SPHERE:
+					return dist_sphere_sphere((Sphere *) geo1, (Sphere *) geo2);
+			}
+			break;
+	}
+	elog(ERROR, "unknown 3D type");
+	return 0.0;					/* keep compiler quiet */
+}
+
+/*
+ * Bounding box of an object. Return false for a Line3D since it is not
+ * bounded.
+ */
+static bool
+geo3D_bbox_stat(Geo3DType type, void *geo, Box3D *box)
+{
+	switch (type)
+	{
+		case GEO3D_POINT3D:
+			box->low = box->high = *(Point3D *) geo;
+			return true;
+		case GEO3D_LSEG3D:
+			{
+				Lseg3D	   *lseg = (Lseg3D *) geo;
+
+				box->low.x = Min(lseg->p[0].x, lseg->p[1].x);
+				box->low.y = Min(lseg->p[0].y, lseg->p[1].y);
+				box->low.z = Min(lseg->p[0].z, lseg->p[1].z);
+				box->high.x = Max(lseg->p[0].x, lseg->p[1].x);
+				box->high.y = Max(lseg->p[0].y, lseg->p[1].y);
+				box->high.z = Max(lseg->p[0].z, lseg->p[1].z);
+				return true;
+			}
+		case GEO3D_LINE3D:
+			return false;
+		case GEO3D_BOX3D:
+			*box = *(Box3D *) geo;
+			return true;
+		case GEO3D_PATH3D:
+			*box = ((Path3D *) geo)->boundbox;
+			return true;
+		case GEO3D_POLY3D:
+			*box = ((Polygon3D *) geo)->boundbox;
+			return true;
+		case GEO3D_SPHERE:
+			{
+				Sphere	   *sphere = (Sphere *) geo;
+
+				box->low.x = sphere->center.x - sphere->radius;
+				box->low.y = sphere->center.y - sphere->radius;
+				box->low.z = sphere->center.z - sphere->radius;
+				box->high.x = sphere->center.x + sphere->radius;
+				box->high.y = sphere->center.y + sphere->radius;
+				box->high.z = sphere->center.z + sphere->radius;
+				return true;
+			}
+	}
+	return false;
+}
+
+static bool dwithin_geo3D(Geo3DType type1, void *geo1, Geo3DType type2,
+	void *geo2, double dist);
+
+/*
+ * Is any segment of the Path3D within the distance of the object?
+ * The segments are tested in turn so that the test stops at the first
+ * segment within the distance.
+ */
+static bool
+dwithin_path3D_geo3D(Path3D *path, Geo3DType type, void *geo, double dist)
+{
+	Lseg3D		lseg;
+	int			i,
+				iprev;
+
+	if (path->npts == 1)
+		return dwithin_geo3D(GEO3D_POINT3D, &path->p[0], type, geo, dist);
+
+	for (i = 0; i < path->npts; i++)
+	{
+		if (i == 0)
+		{
+			if (!path->closed)
+				continue;
+			iprev = path->npts - 1;	/* include the closure segment */
+		}
+		else
+			iprev = i - 1;
+
+		lseg3D_construct_pts_stat(&lseg, path->p[iprev], path->p[i]);
+		if (dwithin_geo3D(GEO3D_LSEG3D, &lseg, type, geo, dist))
+			return true;
+	}
+	return false;
+}
+
+/*
+ * Is the minimum distance between the two objects at most dist?
+ * The distance between the bounding boxes of the objects is a lower bound
+ * of the distance between the objects and the largest distance between
+ * the points of the boxes is an upper bound, which decides most tests
+ * without computing the distance. The bounding boxes of paths and polygons
+ * are computed with FPlt and FPgt, and may thus miss their points by up to
+ * EPSILON on each side, while the distance functions take a gap of at most
+ * EPSILON along an axis as zero. The bounds allow for both so that the
+ * result is the one of a <-> b <= dist.
+ */
+static bool
+dwithin_geo3D(Geo3DType type1, void *geo1, Geo3DType type2, void *geo2,
+	double dist)
+{
+	Box3D		box1,
+				box2;
+	double		dx,
+				dy,
+				dz;
+
+	/* A negative or NaN distance is never reached */
+	if (!(dist >= 0.0))
+		return false;
+
+	if (geo3D_bbox_stat(type1, geo1, &box1) &&
+		geo3D_bbox_stat(type2, geo2, &box2))
+	{
+		dx = Max(0.0, Max(box1.low.x - box2.high.x, box2.low.x - box1.high.x) -
+			3 * EPSILON);
+		dy = Max(0.0, Max(box1.low.y - box2.high.y, box2.low.y - box1.high.y) -
+			3 * EPSILON);
+		dz = Max(0.0, Max(box1.low.z - box2.high.z, box2.low.z - box1.high.z) -
+			3 * EPSILON);
+		if (dx * dx + dy * dy + dz * dz > dist * dist)
+			return false;
+
+		dx = Max(box1.high.x - box2.low.x, box2.high.x - box1.low.x) +
+			2 * EPSILON;
+		dy = Max(box1.high.y - box2.low.y, box2.high.y - box1.low.y) +
+			2 * EPSILON;
+		dz = Max(box1.high.z - box2.low.z, box2.high.z - box1.low.z) +
+			2 * EPSILON;
+		if (dx * dx + dy * dy + dz * dz <= dist * dist)
+			return true;
+	}
+
+	if (type1 == GEO3D_PATH3D)
+		return dwithin_path3D_geo3D((Path3D *) geo1, type2, geo2, dist);
+	if (type2 == GEO3D_PATH3D)
+		return dwithin_path3D_geo3D((Path3D *) geo2, type1, geo1, dist);
+
+	return dist_geo3D(type1, geo1, type2, geo2) <= dist;
+}
+
+/*----------------------------------------------------------*/
+
+/* Point3D dwithin TYPE3D */
+
+/*
+ * Is the first Point3D within the distance of the second Point3D?
+ */
+Datum
+dwithin_point3D_point3D(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point1 = PG_GETARG_POINT3D_P(0);
+	Point3D	   *point2 = PG_GETARG_POINT3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POINT3D, point1, GEO3D_POINT3D, point2, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_point3D_point3D);
+
+/*
+ * Is the Point3D within the distance of the Lseg3D?
+ */
+Datum
+dwithin_point3D_lseg3D(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = PG_GETARG_POINT3D_P(0);
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POINT3D, point, GEO3D_LSEG3D, lseg, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_point3D_lseg3D);
+
+/*
+ * Is the Point3D within the distance of the Line3D?
+ */
+Datum
+dwithin_point3D_line3D(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = PG_GETARG_POINT3D_P(0);
+	Line3D	   *line = PG_GETARG_LINE3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POINT3D, point, GEO3D_LINE3D, line, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_point3D_line3D);
+
+/*
+ * Is the Point3D within the distance of the Box3D?
+ */
+Datum
+dwithin_point3D_box3D(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = PG_GETARG_POINT3D_P(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POINT3D, point, GEO3D_BOX3D, box, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_point3D_box3D);
+
+/*
+ * Is the Point3D within the distance of the Path3D?
+ */
+Datum
+dwithin_point3D_path3D(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = PG_GETARG_POINT3D_P(0);
+	Path3D	   *path = PG_GETARG_PATH3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POINT3D, point, GEO3D_PATH3D, path, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_point3D_path3D);
+
+/*
+ * Is the Point3D within the distance of the Polygon3D?
+ */
+Datum
+dwithin_point3D_poly3D(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = PG_GETARG_POINT3D_P(0);
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POINT3D, point, GEO3D_POLY3D, poly, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_point3D_poly3D);
+
+/*
+ * Is the Point3D within the distance of the Sphere?
+ */
+Datum
+dwithin_point3D_sphere(PG_FUNCTION_ARGS)
+{
+	Point3D	   *point = PG_GETARG_POINT3D_P(0);
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POINT3D, point, GEO3D_SPHERE, sphere, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_point3D_sphere);
+
+/*----------------------------------------------------------*/
+
+/* Lseg3D dwithin TYPE3D */
+
+/*
+ * Is the Lseg3D within the distance of the Point3D?
+ */
+Datum
+dwithin_lseg3D_point3D(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(0);
+	Point3D	   *point = PG_GETARG_POINT3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LSEG3D, lseg, GEO3D_POINT3D, point, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_lseg3D_point3D);
+
+/*
+ * Is the first Lseg3D within the distance of the second Lseg3D?
+ */
+Datum
+dwithin_lseg3D_lseg3D(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg1 = PG_GETARG_LSEG3D_P(0);
+	Lseg3D	   *lseg2 = PG_GETARG_LSEG3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LSEG3D, lseg1, GEO3D_LSEG3D, lseg2, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_lseg3D_lseg3D);
+
+/*
+ * Is the Lseg3D within the distance of the Line3D?
+ */
+Datum
+dwithin_lseg3D_line3D(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(0);
+	Line3D	   *line = PG_GETARG_LINE3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LSEG3D, lseg, GEO3D_LINE3D, line, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_lseg3D_line3D);
+
+/*
+ * Is the Lseg3D within the distance of the Box3D?
+ */
+Datum
+dwithin_lseg3D_box3D(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LSEG3D, lseg, GEO3D_BOX3D, box, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_lseg3D_box3D);
+
+/*
+ * Is the Lseg3D within the distance of the Path3D?
+ */
+Datum
+dwithin_lseg3D_path3D(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(0);
+	Path3D	   *path = PG_GETARG_PATH3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LSEG3D, lseg, GEO3D_PATH3D, path, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_lseg3D_path3D);
+
+/*
+ * Is the Lseg3D within the distance of the Polygon3D?
+ */
+Datum
+dwithin_lseg3D_poly3D(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(0);
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LSEG3D, lseg, GEO3D_POLY3D, poly, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_lseg3D_poly3D);
+
+/*
+ * Is the Lseg3D within the distance of the Sphere?
+ */
+Datum
+dwithin_lseg3D_sphere(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(0);
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LSEG3D, lseg, GEO3D_SPHERE, sphere, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_lseg3D_sphere);
+
+/*----------------------------------------------------------*/
+
+/* Line3D dwithin TYPE3D */
+
+/*
+ * Is the Line3D within the distance of the Point3D?
+ */
+Datum
+dwithin_line3D_point3D(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line = PG_GETARG_LINE3D_P(0);
+	Point3D	   *point = PG_GETARG_POINT3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LINE3D, line, GEO3D_POINT3D, point, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_line3D_point3D);
+
+/*
+ * Is the Line3D within the distance of the Lseg3D?
+ */
+Datum
+dwithin_line3D_lseg3D(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line = PG_GETARG_LINE3D_P(0);
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LINE3D, line, GEO3D_LSEG3D, lseg, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_line3D_lseg3D);
+
+/*
+ * Is the first Line3D within the distance of the second Line3D?
+ */
+Datum
+dwithin_line3D_line3D(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line1 = PG_GETARG_LINE3D_P(0);
+	Line3D	   *line2 = PG_GETARG_LINE3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LINE3D, line1, GEO3D_LINE3D, line2, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_line3D_line3D);
+
+/*
+ * Is the Line3D within the distance of the Box3D?
+ */
+Datum
+dwithin_line3D_box3D(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line = PG_GETARG_LINE3D_P(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LINE3D, line, GEO3D_BOX3D, box, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_line3D_box3D);
+
+/*
+ * Is the Line3D within the distance of the Path3D?
+ */
+Datum
+dwithin_line3D_path3D(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line = PG_GETARG_LINE3D_P(0);
+	Path3D	   *path = PG_GETARG_PATH3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LINE3D, line, GEO3D_PATH3D, path, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_line3D_path3D);
+
+/*
+ * Is the Line3D within the distance of the Polygon3D?
+ */
+Datum
+dwithin_line3D_poly3D(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line = PG_GETARG_LINE3D_P(0);
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LINE3D, line, GEO3D_POLY3D, poly, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_line3D_poly3D);
+
+/*
+ * Is the Line3D within the distance of the Sphere?
+ */
+Datum
+dwithin_line3D_sphere(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line = PG_GETARG_LINE3D_P(0);
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_LINE3D, line, GEO3D_SPHERE, sphere, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_line3D_sphere);
+
+/*----------------------------------------------------------*/
+
+/* Box3D dwithin TYPE3D */
+
+/*
+ * Is the Box3D within the distance of the Point3D?
+ */
+Datum
+dwithin_box3D_point3D(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	Point3D	   *point = PG_GETARG_POINT3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_BOX3D, box, GEO3D_POINT3D, point, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_box3D_point3D);
+
+/*
+ * Is the Box3D within the distance of the Lseg3D?
+ */
+Datum
+dwithin_box3D_lseg3D(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_BOX3D, box, GEO3D_LSEG3D, lseg, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_box3D_lseg3D);
+
+/*
+ * Is the Box3D within the distance of the Line3D?
+ */
+Datum
+dwithin_box3D_line3D(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	Line3D	   *line = PG_GETARG_LINE3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_BOX3D, box, GEO3D_LINE3D, line, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_box3D_line3D);
+
+/*
+ * Is the first Box3D within the distance of the second Box3D?
+ */
+Datum
+dwithin_box3D_box3D(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box1 = PG_GETARG_BOX3D_P(0);
+	Box3D	   *box2 = PG_GETARG_BOX3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_BOX3D, box1, GEO3D_BOX3D, box2, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_box3D_box3D);
+
+/*
+ * Is the Box3D within the distance of the Path3D?
+ */
+Datum
+dwithin_box3D_path3D(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	Path3D	   *path = PG_GETARG_PATH3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_BOX3D, box, GEO3D_PATH3D, path, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_box3D_path3D);
+
+/*
+ * Is the Box3D within the distance of the Polygon3D?
+ */
+Datum
+dwithin_box3D_poly3D(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_BOX3D, box, GEO3D_POLY3D, poly, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_box3D_poly3D);
+
+/*
+ * Is the Box3D within the distance of the Sphere?
+ */
+Datum
+dwithin_box3D_sphere(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_BOX3D, box, GEO3D_SPHERE, sphere, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_box3D_sphere);
+
+/*----------------------------------------------------------*/
+
+/* Path3D dwithin TYPE3D */
+
+/*
+ * Is the Path3D within the distance of the Point3D?
+ */
+Datum
+dwithin_path3D_point3D(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	Point3D	   *point = PG_GETARG_POINT3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_PATH3D, path, GEO3D_POINT3D, point, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_path3D_point3D);
+
+/*
+ * Is the Path3D within the distance of the Lseg3D?
+ */
+Datum
+dwithin_path3D_lseg3D(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_PATH3D, path, GEO3D_LSEG3D, lseg, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_path3D_lseg3D);
+
+/*
+ * Is the Path3D within the distance of the Line3D?
+ */
+Datum
+dwithin_path3D_line3D(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	Line3D	   *line = PG_GETARG_LINE3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_PATH3D, path, GEO3D_LINE3D, line, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_path3D_line3D);
+
+/*
+ * Is the Path3D within the distance of the Box3D?
+ */
+Datum
+dwithin_path3D_box3D(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_PATH3D, path, GEO3D_BOX3D, box, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_path3D_box3D);
+
+/*
+ * Is the first Path3D within the distance of the second Path3D?
+ */
+Datum
+dwithin_path3D_path3D(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path1 = PG_GETARG_PATH3D_P(0);
+	Path3D	   *path2 = PG_GETARG_PATH3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_PATH3D, path1, GEO3D_PATH3D, path2, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_path3D_path3D);
+
+/*
+ * Is the Path3D within the distance of the Polygon3D?
+ */
+Datum
+dwithin_path3D_poly3D(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_PATH3D, path, GEO3D_POLY3D, poly, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_path3D_poly3D);
+
+/*
+ * Is the Path3D within the distance of the Sphere?
+ */
+Datum
+dwithin_path3D_sphere(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_PATH3D, path, GEO3D_SPHERE, sphere, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_path3D_sphere);
+
+/*----------------------------------------------------------*/
+
+/* Polygon3D dwithin TYPE3D */
+
+/*
+ * Is the Polygon3D within the distance of the Point3D?
+ */
+Datum
+dwithin_poly3D_point3D(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	Point3D	   *point = PG_GETARG_POINT3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POLY3D, poly, GEO3D_POINT3D, point, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_poly3D_point3D);
+
+/*
+ * Is the Polygon3D within the distance of the Lseg3D?
+ */
+Datum
+dwithin_poly3D_lseg3D(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POLY3D, poly, GEO3D_LSEG3D, lseg, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_poly3D_lseg3D);
+
+/*
+ * Is the Polygon3D within the distance of the Line3D?
+ */
+Datum
+dwithin_poly3D_line3D(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	Line3D	   *line = PG_GETARG_LINE3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POLY3D, poly, GEO3D_LINE3D, line, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_poly3D_line3D);
+
+/*
+ * Is the Polygon3D within the distance of the Box3D?
+ */
+Datum
+dwithin_poly3D_box3D(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POLY3D, poly, GEO3D_BOX3D, box, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_poly3D_box3D);
+
+/*
+ * Is the Polygon3D within the distance of the Path3D?
+ */
+Datum
+dwithin_poly3D_path3D(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	Path3D	   *path = PG_GETARG_PATH3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POLY3D, poly, GEO3D_PATH3D, path, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_poly3D_path3D);
+
+/*
+ * Is the first Polygon3D within the distance of the second Polygon3D?
+ */
+Datum
+dwithin_poly3D_poly3D(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly1 = PG_GETARG_POLYGON3D_P(0);
+	Polygon3D  *poly2 = PG_GETARG_POLYGON3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POLY3D, poly1, GEO3D_POLY3D, poly2, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_poly3D_poly3D);
+
+/*
+ * Is the Polygon3D within the distance of the Sphere?
+ */
+Datum
+dwithin_poly3D_sphere(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_POLY3D, poly, GEO3D_SPHERE, sphere, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_poly3D_sphere);
+
+/*----------------------------------------------------------*/
+
+/* Sphere dwithin TYPE3D */
+
+/*
+ * Is the Sphere within the distance of the Point3D?
+ */
+Datum
+dwithin_sphere_point3D(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+	Point3D	   *point = PG_GETARG_POINT3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_SPHERE, sphere, GEO3D_POINT3D, point, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_sphere_point3D);
+
+/*
+ * Is the Sphere within the distance of the Lseg3D?
+ */
+Datum
+dwithin_sphere_lseg3D(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_SPHERE, sphere, GEO3D_LSEG3D, lseg, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_sphere_lseg3D);
+
+/*
+ * Is the Sphere within the distance of the Line3D?
+ */
+Datum
+dwithin_sphere_line3D(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+	Line3D	   *line = PG_GETARG_LINE3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_SPHERE, sphere, GEO3D_LINE3D, line, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_sphere_line3D);
+
+/*
+ * Is the Sphere within the distance of the Box3D?
+ */
+Datum
+dwithin_sphere_box3D(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_SPHERE, sphere, GEO3D_BOX3D, box, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_sphere_box3D);
+
+/*
+ * Is the Sphere within the distance of the Path3D?
+ */
+Datum
+dwithin_sphere_path3D(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+	Path3D	   *path = PG_GETARG_PATH3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_SPHERE, sphere, GEO3D_PATH3D, path, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_sphere_path3D);
+
+/*
+ * Is the Sphere within the distance of the Polygon3D?
+ */
+Datum
+dwithin_sphere_poly3D(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_SPHERE, sphere, GEO3D_POLY3D, poly, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_sphere_poly3D);
+
+/*
+ * Is the first Sphere within the distance of the second Sphere?
+ */
+Datum
+dwithin_sphere_sphere(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere1 = PG_GETARG_SPHERE_P(0);
+	Sphere	   *sphere2 = PG_GETARG_SPHERE_P(1);
+	double		dist = PG_GETARG_FLOAT8(2);
+
+	PG_RETURN_BOOL(dwithin_geo3D(GEO3D_SPHERE, sphere1, GEO3D_SPHERE, sphere2, dist));
+}
+
+PG_FUNCTION_INFO_V1(dwithin_sphere_sphere);
+
 /*****************************************************************************
  * Closestpoint functions
  * Find the point of closest proximity between objects
@@ -21,6 +21,19 @@
 #include <miscadmin.h>
 #include <utils/builtins.h>
 #include <catalog/namespace.h>
+#include <utils/memutils.h>
+#include <utils/sortsupport.h>
+#if PG_VERSION_NUM >= 130000
+#include <common/hashfn.h>
+#elif PG_VERSION_NUM >= 120000
+#include <utils/hashutils.h>
+#else
+#include <access/hash.h>
+#endif
+#if PG_VERSION_NUM >= 120000
+#include <common/shortest_dec.h>
+#include <utils/float.h>
+#endif
 #include "geo3D_decls.h"
 
 #ifndef M_PI
@@ -31,6 +44,19 @@
 PG_MODULE_MAGIC ;
 #endif
 
+void _PG_init(void);
+
+/*
+ * Module initialization, which installs the planner hook of partition
+ * pruning and registers the custom scan for spatial joins
+ */
+void
+_PG_init(void)
+{
+	partition3D_register();
+	spatialjoin3D_register();
+}
+
 /*****************************************************************************
  * Internal routines
  *****************************************************************************/
@@ -55,14 +81,13 @@ enum path3D_delim
 	PATH3D_NONE, PATH3D_OPEN, PATH3D_CLOSED
 };
 
-/* Maximum number of characters printed by triple_encode() */
+/* Maximum number of characters printed by single_encode() */
 /* ...+3+7 : 3 accounts for extra_float_digits max value */
-#define P_MAXLEN (2*(DBL_DIG+3+7)+1)
+#define P_MAXLEN (DBL_DIG+3+7+1)
+/* Maximum number of characters printed for a point by path3D_encode() */
+#define P_TRIPLE_MAXLEN (3*P_MAXLEN+4)
  
-static int single_decode(char *str, double *x, char **ss);
-static int single_encode(double x, char *str);
-static int triple_decode(char *str, double *x, double *y, double *z, char **s);
-static int triple_encode(double x, double y, double z, char *str);
+static double geo3D_strtod(char *str, char **endptr);
 static int triple_count(char *s, char delim);
 
 static bool plist_same(int npts, Point3D *pt1, Point3D *pt2);
@@ -71,7 +96,6 @@ static int plist_coplanar(int npts1, Point3D *pt1, int npts2, Point3D *pt2);
 
 static Point3D *point3D_construct_internal(double x, double y, double z);
 static Point3D *point3D_copy(Point3D *point);
-static int point3D_cmp_internal(Point3D* point1, Point3D* point2);
 
 static Lseg3D *lseg3D_construct_internal(double x1, double y1, double z1, double x2, double y2, double z2);
 static Lseg3D *lseg3D_construct_pts_internal(Point3D *point1, Point3D *point2);
@@ -89,16 +113,13 @@ static Box3D *box3D_copy(Box3D *box);
 static double box3D_ht(Box3D *box);
 static double box3D_wd(Box3D *box);
 static double box3D_dp(Box3D *box);
-static int box3D_cmp_internal(Box3D* box1, Box3D* box2);
 
 static int path3D_decode(int opentype, int npts, char *str, int *isopen, char **ss, Point3D *p);
 static char *path3D_encode(enum path3D_delim path3D_delim, int npts, Point3D *point);
-static void path3D_make_bbox(Path3D *path);
 // static Path3D * path3D_copy(Path3D *path);
 static double path3D_length_internal(Path3D *path);
 static bool path3D_isplanar_internal(Path3D *path);
 static double path3D_area_internal(Path3D *path);
-static int path3D_cmp_internal(Path3D* p1, Path3D* p2);
 
 // static Polygon3D * poly3D_copy(Polygon3D *poly);
 static bool poly3D_isplanar_internal(Polygon3D *poly);
@@ -108,6 +129,63 @@ static Sphere *sphere_copy(Sphere *sphere);
 static double sphere_vol(Sphere *sphere);
 static int sphere_cmp_internal(Sphere* s1, Sphere* s2);
 
+/*
+ * Compare two coordinates as FPlt and FPgt do, with a single subtraction
+ */
+static inline int
+FPcmp(double a, double b)
+{
+	double		d = a - b;
+
+	if (d < -EPSILON)
+		return -1;
+	if (d > EPSILON)
+		return 1;
+	return 0;
+}
+
+/*
+ * Exact equality of coordinates used by the hash operator classes, in which
+ * NaN equals NaN as for float8 so that the equality is an equivalence
+ */
+static inline bool
+FPeq_exact(double a, double b)
+{
+	return a == b || (isnan(a) && isnan(b));
+}
+
+/*
+ * Hash of the coordinates consistent with FPeq_exact, -0 and all NaNs
+ * being hashed as 0 and as the same NaN. The coordinates are overwritten.
+ */
+static Datum
+coords_hash(double *coords, int n)
+{
+	int			i;
+
+	for (i = 0; i < n; i++)
+	{
+		if (coords[i] == 0.0)
+			coords[i] = 0.0;
+		else if (isnan(coords[i]))
+			coords[i] = NAN;
+	}
+	return hash_any((unsigned char *) coords, sizeof(double) * n);
+}
+
+/* Lexicographic comparison of the coordinates of two points */
+static inline int
+point3D_cmp_coords(Point3D *point1, Point3D *point2)
+{
+	int			cmp = FPcmp(point1->x, point2->x);
+
+	if (cmp == 0)
+		cmp = FPcmp(point1->y, point2->y);
+	if (cmp == 0)
+		cmp = FPcmp(point1->z, point2->z);
+	return cmp;
+}
+
 /*****************************************************************************
  * Generic functions
  *****************************************************************************/
@@ -495,7 +573,92 @@ pg_hypot3D(double x, double y, double z)
  * reordered  to allow faster internal operations.
  ******************************************************************************/
 
-static int
+/* Powers of ten that are exactly representable as double */
+static const double geo3D_pow10[] =
+{
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+ * geo3D_strtod: Convert the decimal number at str to double
+ *
+ * The common case of a number with at most 15 significant digits and a
+ * small exponent is parsed in a single pass: the digits are then an exact
+ * integer and the power of ten is exact, so one multiplication or division
+ * yields the correctly rounded result (Clinger's fast path). All other
+ * numbers, as well as NaN, Infinity, and hexadecimal notation, are handed
+ * to strtod.
+ */
+static double
+geo3D_strtod(char *str, char **endptr)
+{
+	char	   *cp = str;
+	bool		neg = false;
+	uint64		mant = 0;
+	int			ndigits = 0;
+	int			nsig = 0;
+	int			exp10 = 0;
+	double		result;
+
+	if (*cp == '-' || *cp == '+')
+		neg = (*cp++ == '-');
+
+	for (; *cp >= '0' && *cp <= '9'; cp++)
+	{
+		ndigits++;
+		if (mant != 0 || *cp != '0')
+			nsig++;
+		mant = mant * 10 + (*cp - '0');
+	}
+	if (*cp == '.')
+	{
+		for (cp++; *cp >= '0' && *cp <= '9'; cp++)
+		{
+			ndigits++;
+			if (mant != 0 || *cp != '0')
+				nsig++;
+			mant = mant * 10 + (*cp - '0');
+			exp10--;
+		}
+	}
+	/* No digits at all, or too many for the fast path */
+	if (ndigits == 0 || nsig > 15)
+		return strtod(str, endptr);
+	if (*cp == 'e' || *cp == 'E')
+	{
+		bool		expneg = false;
+		int			e = 0;
+		int			edigits = 0;
+
+		cp++;
+		if (*cp == '-' || *cp == '+')
+			expneg = (*cp++ == '-');
+		while (*cp >= '0' && *cp <= '9' && edigits < 4)
+		{
+			e = e * 10 + (*cp++ - '0');
+			edigits++;
+		}
+		if (edigits == 0 || edigits == 4)
+			return strtod(str, endptr);
+		exp10 += expneg ? -e : e;
+	}
+	/* Let strtod deal with trailing characters such as in "0x1p3" */
+	if (isalnum((unsigned char) *cp) || *cp == '.')
+		return strtod(str, endptr);
+	if (exp10 < -22 || exp10 > 22)
+		return strtod(str, endptr);
+
+	result = (double) mant;
+	if (exp10 < 0)
+		result /= geo3D_pow10[-exp10];
+	else
+		result *= geo3D_pow10[exp10];
+	*endptr = cp;
+	return neg ? -result : result;
+}
+
+int
 single_decode(char *str, double *x, char **s)
 {
 	char	   *cp;
@@ -503,7 +666,7 @@ single_decode(char *str, double *x, char **s)
 	if (!PointerIsValid(str))
 		return FALSE;
 
-	*x = strtod(str, &cp);
+	*x = geo3D_strtod(str, &cp);
 
 	if (s != NULL)
 	{
@@ -515,19 +678,31 @@ single_decode(char *str, double *x, char **s)
 	return TRUE;
 }	/* single_decode() */
 
-static int
-single_encode(double x, char *str)
+/*
+ * single_encode: Append the float8 to the string as float8out does, that
+ * is, in the shortest form that reads back as the same value when
+ * extra_float_digits is positive, which is the default since PostgreSQL 12
+ */
+void
+single_encode(double x, StringInfo str)
 {
 	int			ndig = DBL_DIG + extra_float_digits;
 
+	enlargeStringInfo(str, P_MAXLEN);
+#if PG_VERSION_NUM >= 120000
+	if (extra_float_digits > 0)
+	{
+		str->len += double_to_shortest_decimal_buf(x, str->data + str->len);
+		return;
+	}
+#endif
 	if (ndig < 1)
 		ndig = 1;
 
-	sprintf(str, "%.*g", ndig, x);
-	return TRUE;
+	str->len += snprintf(str->data + str->len, P_MAXLEN + 1, "%.*g", ndig, x);
 }	/* single_encode() */
 
-static int
+int
 triple_decode(char *str, double *x, double *y, double *z, char **s)
 {
 	int			has_delim;
@@ -543,7 +718,7 @@ triple_decode(char *str, double *x, double *y, double *z, char **s)
 
 	while (isspace((unsigned char) *str))
 		str++;
-	*x = strtod(str, &cp);
+	*x = geo3D_strtod(str, &cp);
 	if (cp <= str)
 		return FALSE;
 	while (isspace((unsigned char) *cp))
@@ -553,7 +728,7 @@ triple_decode(char *str, double *x, double *y, double *z, char **s)
 
 	while (isspace((unsigned char) *cp))
 		cp++;
-	*y = strtod(cp, &str);
+	*y = geo3D_strtod(cp, &str);
 	if (str <= cp)
 		return FALSE;
 	while (isspace((unsigned char) *str))
@@ -563,7 +738,7 @@ triple_decode(char *str, double *x, double *y, double *z, char **s)
 
 	while (isspace((unsigned char) *str))
 		str++;
-	*z = strtod(str, &cp);
+	*z = geo3D_strtod(str, &cp);
 	if (cp <= str)
 		return FALSE; 
 	while (isspace((unsigned char) *cp))
@@ -583,16 +758,14 @@ triple_decode(char *str, double *x, double *y, double *z, char **s)
 	return TRUE;
 }	/* triple_decode() */
 
-static int
-triple_encode(double x, double y, double z, char *str)
+void
+triple_encode(double x, double y, double z, StringInfo str)
 {
-	int			ndig = DBL_DIG + extra_float_digits;
-
-	if (ndig < 1)
-		ndig = 1;
-
-	sprintf(str, "%.*g,%.*g,%.*g", ndig, x, ndig, y, ndig, z);
-	return TRUE;
+	single_encode(x, str);
+	appendStringInfoCharMacro(str, DELIM);
+	single_encode(y, str);
+	appendStringInfoCharMacro(str, DELIM);
+	single_encode(z, str);
 }	/* triple_encode() */
 
 static int
@@ -671,27 +844,21 @@ path3D_decode(int opentype, int npts, char *str, int *isopen,
 static char *
 path3D_encode(enum path3D_delim path3D_delim, int npts, Point3D *point)
 {
-	int			size = npts * (P_MAXLEN + 3) + 2;
-	char	   *result;
-	char	   *cp;
+	StringInfoData str;
 	int			i;
 
-	/* Check for integer overflow */
-	if ((size - 2) / npts != (P_MAXLEN + 3))
-		ereport(ERROR,
-				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
-				 errmsg("Too many points requested")));
-
-	result = palloc(size);
+	initStringInfo(&str);
+	/* Presize the buffer unless the worst case would exceed the limit */
+	if (npts < (int) (MaxAllocSize / 2 / P_TRIPLE_MAXLEN))
+		enlargeStringInfo(&str, npts * P_TRIPLE_MAXLEN + 2);
 
-	cp = result;
 	switch (path3D_delim)
 	{
 		case PATH3D_CLOSED:
-			*cp++ = LDELIM;
+			appendStringInfoCharMacro(&str, LDELIM);
 			break;
 		case PATH3D_OPEN:
-			*cp++ = LDELIM_EP;
+			appendStringInfoCharMacro(&str, LDELIM_EP);
 			break;
 		case PATH3D_NONE:
 			break;
@@ -699,32 +866,27 @@ path3D_encode(enum path3D_delim path3D_delim, int npts, Point3D *point)
 
 	for (i = 0; i < npts; i++)
 	{
-		*cp++ = LDELIM;
-		if (!triple_encode(point->x, point->y, point->z, cp))
-			ereport(ERROR,
-					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-					 errmsg("Could not format \"path3D\" value")));
-
-		cp += strlen(cp);
-		*cp++ = RDELIM;
-		*cp++ = DELIM;
+		if (i > 0)
+			appendStringInfoCharMacro(&str, DELIM);
+		appendStringInfoCharMacro(&str, LDELIM);
+		triple_encode(point->x, point->y, point->z, &str);
+		appendStringInfoCharMacro(&str, RDELIM);
 		point++;
 	}
-	cp--;
+
 	switch (path3D_delim)
 	{
 		case PATH3D_CLOSED:
-			*cp++ = RDELIM;
+			appendStringInfoCharMacro(&str, RDELIM);
 			break;
 		case PATH3D_OPEN:
-			*cp++ = RDELIM_EP;
+			appendStringInfoCharMacro(&str, RDELIM_EP);
 			break;
 		case PATH3D_NONE:
 			break;
 	}
-	*cp = '\0';
 
-	return result;
+	return str.data;
 }	/* path3D_encode() */
 
 /*-------------------------------------------------------------
@@ -758,6 +920,33 @@ Oid point3d_oid()
     return POINT3D_OID ;
 }
 
+Oid BOX3D_OID = InvalidOid ;
+
+Oid box3d_oid() 
+{
+    if(BOX3D_OID == InvalidOid)
+        BOX3D_OID = TypenameGetTypid("box3d") ;
+    return BOX3D_OID ;
+}
+
+Oid PATH3D_OID = InvalidOid ;
+
+Oid path3d_oid() 
+{
+    if(PATH3D_OID == InvalidOid)
+        PATH3D_OID = TypenameGetTypid("path3d") ;
+    return PATH3D_OID ;
+}
+
+Oid POLY3D_OID = InvalidOid ;
+
+Oid poly3d_oid() 
+{
+    if(POLY3D_OID == InvalidOid)
+        POLY3D_OID = TypenameGetTypid("polygon3d") ;
+    return POLY3D_OID ;
+}
+
 /*----------------------------------------------------------
  *	Input and output functions
  *---------------------------------------------------------*/
@@ -1193,23 +1382,10 @@ point3D_same_internal(Point3D *point1, Point3D *point2)
 /*
  * point3D_cmp_internal: Compare the two Point3D
  */
-static int
+int
 point3D_cmp_internal(Point3D* point1, Point3D* point2) 
 {
-	if(FPlt(point1->x, point2->x))
-		return -1;
-	if(FPgt(point1->x, point2->x))
-		return 1;
-	if(FPlt(point1->y, point2->y))
-		return -1;
-	if(FPgt(point1->y, point2->y))
-		return 1;
-	if(FPlt(point1->z, point2->z))
-		return -1;
-	if(FPgt(point1->z, point2->z))
-		return 1;
-	// both points are equal
-	return 0;
+	return point3D_cmp_coords(point1, point2);
 }
 
 Datum 
@@ -1222,6 +1398,30 @@ point3D_cmp(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(point3D_cmp) ;
 
+static int
+point3D_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return point3D_cmp_coords(DatumGetPoint3DP(x), DatumGetPoint3DP(y));
+}
+
+/*
+ * point3D_sortsupport: Sort support of the btree operator class, which 
+ * compares the values without the overhead of a function call. There are 
+ * no abbreviated keys for this or the other 3D types, since the ordering 
+ * considers coordinates within EPSILON as equal, which no key derived from
+ * the coordinates can preserve.
+ */
+Datum
+point3D_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = point3D_fastcmp;
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(point3D_sortsupport);
+
 Datum 
 point3D_lt(PG_FUNCTION_ARGS) 
 {
@@ -1282,6 +1482,45 @@ point3D_ge(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(point3D_ge);
 
+static inline bool
+point3D_exact_eq_internal(Point3D *point1, Point3D *point2)
+{
+	return FPeq_exact(point1->x, point2->x) &&
+		FPeq_exact(point1->y, point2->y) && FPeq_exact(point1->z, point2->z);
+}
+
+/*
+ * point3D_exact_eq: Are the coordinates of the two points exactly equal. 
+ * Unlike =, which considers coordinates within EPSILON as equal, this 
+ * equality is transitive and can thus be hashed.
+ */
+Datum 
+point3D_exact_eq(PG_FUNCTION_ARGS) 
+{
+	Point3D* point1 = PG_GETARG_POINT3D_P(0);
+	Point3D* point2 = PG_GETARG_POINT3D_P(1);
+	PG_RETURN_BOOL(point3D_exact_eq_internal(point1, point2));
+}
+
+PG_FUNCTION_INFO_V1(point3D_exact_eq);
+
+/*
+ * point3D_hash: Hash of the point consistent with point3D_exact_eq
+ */
+Datum 
+point3D_hash(PG_FUNCTION_ARGS) 
+{
+	Point3D* point = PG_GETARG_POINT3D_P(0);
+	double coords[3];
+
+	coords[0] = point->x;
+	coords[1] = point->y;
+	coords[2] = point->z;
+	return coords_hash(coords, 3);
+}
+
+PG_FUNCTION_INFO_V1(point3D_hash);
+
 /***********************************************************************
  * Routines for 3D line segments
  ***********************************************************************/
@@ -1776,33 +2015,12 @@ lseg3D_same_internal(Lseg3D *ls1, Lseg3D *ls2)
 static int 
 lseg3D_cmp_internal(Lseg3D* ls1, Lseg3D* ls2) 
 {
-	if(FPlt(ls1->p[0].x, ls2->p[0].x))
-		return -1;
-	if(FPgt(ls1->p[0].x, ls2->p[0].x))
-		return 1;
-	if(FPlt(ls1->p[0].y, ls2->p[0].y))
-		return -1;
-	if(FPgt(ls1->p[0].y, ls2->p[0].y))
-		return 1;
-	if(FPlt(ls1->p[0].z, ls2->p[0].z))
-		return -1;
-	if(FPgt(ls1->p[0].z, ls2->p[0].z))
-		return 1;
+	int			cmp = point3D_cmp_coords(&ls1->p[0], &ls2->p[0]);
+
 	// the initial points are equal
-	if(FPlt(ls1->p[1].x, ls2->p[1].x))
-		return -1;
-	if(FPgt(ls1->p[1].x, ls2->p[1].x))
-		return 1;
-	if(FPlt(ls1->p[1].y, ls2->p[1].y))
-		return -1;
-	if(FPgt(ls1->p[1].y, ls2->p[1].y))
-		return 1;
-	if(FPlt(ls1->p[1].z, ls2->p[1].z))
-		return -1;
-	if(FPgt(ls1->p[1].z, ls2->p[1].z))
-		return 1;
-	// the final points are also equal
-	return 0;
+	if (cmp == 0)
+		cmp = point3D_cmp_coords(&ls1->p[1], &ls2->p[1]);
+	return cmp;
 }
 
 Datum 
@@ -1815,6 +2033,26 @@ lseg3D_cmp(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(lseg3D_cmp);
 
+static int
+lseg3D_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return lseg3D_cmp_internal(DatumGetLseg3DP(x), DatumGetLseg3DP(y));
+}
+
+/*
+ * lseg3D_sortsupport: Sort support of the btree operator class
+ */
+Datum
+lseg3D_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = lseg3D_fastcmp;
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(lseg3D_sortsupport);
+
 Datum 
 lseg3D_lt(PG_FUNCTION_ARGS) 
 {
@@ -1930,14 +2168,8 @@ Datum
 line3D_out(PG_FUNCTION_ARGS)
 {
 	Line3D	   *line = PG_GETARG_LINE3D_P(0);
-	int			ndig = DBL_DIG + extra_float_digits;
-
-	if (ndig < 1)
-		ndig = 1;
 
-	PG_RETURN_CSTRING(psprintf("((%.*g,%.*g,%.*g),(%.*g,%.*g,%.*g))", ndig, 
-		line->p[0].x, ndig, line->p[0].y, ndig, line->p[0].z, ndig, 
-		line->p[1].x, ndig, line->p[1].y, ndig, line->p[1].z));
+	PG_RETURN_CSTRING(path3D_encode(PATH3D_CLOSED, 2, line->p));
 }
 
 PG_FUNCTION_INFO_V1(line3D_out);
@@ -2812,6 +3044,29 @@ box3D_diagonal(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(box3D_diagonal);
 
+/*
+ * box3D_boundbox: Return the bounding box of the Box3D, i.e., a copy of it,
+ * so that boundbox is defined for all types
+ */
+Datum
+box3D_boundbox(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+
+	PG_RETURN_BOX3D_P(box3D_bbox(box));
+}
+
+PG_FUNCTION_INFO_V1(box3D_boundbox);
+
+Box3D *
+box3D_bbox(Box3D *box)
+{
+	Box3D	   *result = (Box3D *) palloc(sizeof(Box3D));
+
+	*result = *box;
+	return result;
+}
+
 /*
  * box3D_boundsphere: Minimum bounding sphere of the box
  */
@@ -2971,36 +3226,15 @@ box3D_same_internal(Box3D *box1, Box3D *box2)
 /*
  * box3D_cmp_internal: Compare the two Box3D
  */
-static int
+int
 box3D_cmp_internal(Box3D* b1, Box3D* b2) 
 {
-	if(FPlt(b1->low.x, b2->low.x))
-		return -1;
-	if(FPgt(b1->low.x, b2->low.x))
-		return 1;
-	if(FPlt(b1->low.y, b2->low.y))
-		return -1;
-	if(FPgt(b1->low.y, b2->low.y))
-		return 1;
-	if(FPlt(b1->low.z, b2->low.z))
-		return -1;
-	if(FPgt(b1->low.z, b2->low.z))
-		return 1;
+	int			cmp = point3D_cmp_coords(&b1->low, &b2->low);
+
 	// the low points are equal
-	if(FPlt(b1->high.x, b2->high.x))
-		return -1;
-	if(FPgt(b1->high.x, b2->high.x))
-		return 1;
-	if(FPlt(b1->high.y, b2->high.y))
-		return -1;
-	if(FPgt(b1->high.y, b2->high.y))
-		return 1;
-	if(FPlt(b1->high.z, b2->high.z))
-		return -1;
-	if(FPgt(b1->high.z, b2->high.z))
-		return 1;
-	// the high points are also equal
-	return 0;
+	if (cmp == 0)
+		cmp = point3D_cmp_coords(&b1->high, &b2->high);
+	return cmp;
 }
 
 Datum 
@@ -3013,6 +3247,26 @@ box3D_cmp(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(box3D_cmp);
 
+static int
+box3D_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return box3D_cmp_internal(DatumGetBox3DP(x), DatumGetBox3DP(y));
+}
+
+/*
+ * box3D_sortsupport: Sort support of the btree operator class
+ */
+Datum
+box3D_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = box3D_fastcmp;
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(box3D_sortsupport);
+
 Datum 
 box3D_lt(PG_FUNCTION_ARGS) 
 {
@@ -3073,6 +3327,40 @@ box3D_ge(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(box3D_ge);
 
+/*
+ * box3D_exact_eq: Are the corners of the two boxes exactly equal
+ */
+Datum 
+box3D_exact_eq(PG_FUNCTION_ARGS) 
+{
+	Box3D* b1 = PG_GETARG_BOX3D_P(0);
+	Box3D* b2 = PG_GETARG_BOX3D_P(1);
+	PG_RETURN_BOOL(point3D_exact_eq_internal(&b1->low, &b2->low) &&
+		point3D_exact_eq_internal(&b1->high, &b2->high));
+}
+
+PG_FUNCTION_INFO_V1(box3D_exact_eq);
+
+/*
+ * box3D_hash: Hash of the box consistent with box3D_exact_eq
+ */
+Datum 
+box3D_hash(PG_FUNCTION_ARGS) 
+{
+	Box3D* box = PG_GETARG_BOX3D_P(0);
+	double coords[6];
+
+	coords[0] = box->low.x;
+	coords[1] = box->low.y;
+	coords[2] = box->low.z;
+	coords[3] = box->high.x;
+	coords[4] = box->high.y;
+	coords[5] = box->high.z;
+	return coords_hash(coords, 6);
+}
+
+PG_FUNCTION_INFO_V1(box3D_hash);
+
 /***********************************************************************
  * Routines for 3D paths
  ***********************************************************************/
@@ -3080,11 +3368,98 @@ PG_FUNCTION_INFO_V1(box3D_ge);
 /*----------------------------------------------------------
  *	Input and output functions
  *---------------------------------------------------------*/
+
+/*
+ * Convert a float8 between host and network byte order
+ */
+static inline uint64
+geo3D_ntoh64(uint64 x)
+{
+#ifdef WORDS_BIGENDIAN
+	return x;
+#else
+	return geo3D_bswap64(x);
+#endif
+}
+
+/*
+ * point3D_array_recv: Read npts points in external binary representation
+ * from buf and compute their bounding box in the same pass, unless box is
+ * NULL
+ *
+ * The coordinates are copied as a single block instead of calling
+ * pq_getmsgfloat8 for each of them, which makes COPY BINARY of large paths
+ * and polygons much cheaper.
+ */
+void
+point3D_array_recv(StringInfo buf, Point3D *points, int32 npts, Box3D *box)
+{
+	uint64	   *coords = (uint64 *) points;
+	double		x1,
+				y1,
+				z1,
+				x2,
+				y2,
+				z2;
+	int32		i;
+
+	memcpy(points, pq_getmsgbytes(buf, sizeof(Point3D) * npts),
+		sizeof(Point3D) * npts);
+
+	for (i = 0; i < 3 * npts; i++)
+		coords[i] = geo3D_ntoh64(coords[i]);
+
+	if (box == NULL)
+		return;
+
+	x2 = x1 = points[0].x;
+	y2 = y1 = points[0].y;
+	z2 = z1 = points[0].z;
+	for (i = 1; i < npts; i++)
+	{
+		if (FPlt(points[i].x, x1))
+			x1 = points[i].x;
+		if (FPgt(points[i].x, x2))
+			x2 = points[i].x;
+		if (FPlt(points[i].y, y1))
+			y1 = points[i].y;
+		if (FPgt(points[i].y, y2))
+			y2 = points[i].y;
+		if (FPlt(points[i].z, z1))
+			z1 = points[i].z;
+		if (FPgt(points[i].z, z2))
+			z2 = points[i].z;
+	}
+	box3D_fill(box, x1, y1, z1, x2, y2, z2);
+}
+
+/*
+ * point3D_array_send: Append npts points in external binary representation
+ * to buf
+ */
+void
+point3D_array_send(StringInfo buf, Point3D *points, int32 npts)
+{
+	const uint64 *coords = (const uint64 *) points;
+	char	   *data;
+	int32		i;
+
+	enlargeStringInfo(buf, sizeof(Point3D) * npts);
+	data = buf->data + buf->len;
+	for (i = 0; i < 3 * npts; i++)
+	{
+		uint64		coord = geo3D_ntoh64(coords[i]);
+
+		memcpy(data + i * sizeof(uint64), &coord, sizeof(uint64));
+	}
+	buf->len += sizeof(Point3D) * npts;
+	buf->data[buf->len] = '\0';
+}
  
 /* 
  * path3D_make_bbox: Make the smallest bounding box for the Path3D
  */
-static void
+void
 path3D_make_bbox(Path3D *path)
 {
 	int			i;
@@ -3124,6 +3499,166 @@ path3D_make_bbox(Path3D *path)
 				 errmsg("Cannot create bounding box for empty path3D")));
 }
 
+/*
+ * Point3DBuilder: Build a Path3D or a Polygon3D by appending points
+ *
+ * The varlena under construction is kept in a buffer whose capacity doubles
+ * when full, so that appending n points one at a time costs O(n) instead of
+ * the O(n^2) of repeatedly concatenating paths. The bounding box is kept up
+ * to date as the points are appended, so that finishing the result only
+ * fills its header.
+ */
+
+/* Maximum number of points of a varlena whose points start at hdrsize */
+#define POINT3D_BUILDER_MAXPTS(hdrsize) \
+	((int32) ((MaxAllocSize - (hdrsize)) / sizeof(Point3D)))
+
+#define POINT3D_BUILDER_INITPTS		64
+
+/*
+ * point3D_builder_init: Start an empty builder in the current memory
+ * context with room for maxpts points placed hdrsize bytes from the start
+ * of the varlena, that is, offsetof(Path3D, p) or offsetof(Polygon3D, p).
+ * A default capacity is used when the number of points is not known.
+ */
+void
+point3D_builder_init(Point3DBuilder *builder, Size hdrsize, int32 maxpts)
+{
+	if (maxpts <= 0)
+		maxpts = POINT3D_BUILDER_INITPTS;
+	if (maxpts > POINT3D_BUILDER_MAXPTS(hdrsize))
+		maxpts = POINT3D_BUILDER_MAXPTS(hdrsize);
+
+	builder->data = (char *) palloc(hdrsize + sizeof(Point3D) * maxpts);
+	builder->hdrsize = hdrsize;
+	builder->npts = 0;
+	builder->maxpts = maxpts;
+}
+
+/*
+ * point3D_builder_append: Append npts points to the builder. The bounding
+ * box of the points is computed when box is NULL. The buffer is enlarged
+ * with repalloc, and thus in the memory context where it was allocated.
+ */
+void
+point3D_builder_append(Point3DBuilder *builder, Point3D *points, int32 npts,
+	Box3D *box)
+{
+	int32		limit = POINT3D_BUILDER_MAXPTS(builder->hdrsize);
+	Box3D		pointsbox;
+	int			i;
+
+	if (npts <= 0)
+		return;
+
+	if (npts > limit - builder->npts)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("Too many points requested")));
+
+	if (builder->npts + npts > builder->maxpts)
+	{
+		int32		maxpts = builder->maxpts;
+
+		while (maxpts < builder->npts + npts)
+			maxpts = (maxpts > limit / 2) ? limit : maxpts * 2;
+		builder->data = (char *) repalloc(builder->data,
+			builder->hdrsize + sizeof(Point3D) * maxpts);
+		builder->maxpts = maxpts;
+	}
+
+	memcpy(POINT3D_BUILDER_POINTS(builder) + builder->npts, points,
+		sizeof(Point3D) * npts);
+
+	if (box == NULL)
+	{
+		pointsbox.low = pointsbox.high = points[0];
+		for (i = 1; i < npts; i++)
+		{
+			if (FPlt(points[i].x, pointsbox.low.x))
+				pointsbox.low.x = points[i].x;
+			if (FPgt(points[i].x, pointsbox.high.x))
+				pointsbox.high.x = points[i].x;
+			if (FPlt(points[i].y, pointsbox.low.y))
+				pointsbox.low.y = points[i].y;
+			if (FPgt(points[i].y, pointsbox.high.y))
+				pointsbox.high.y = points[i].y;
+			if (FPlt(points[i].z, pointsbox.low.z))
+				pointsbox.low.z = points[i].z;
+			if (FPgt(points[i].z, pointsbox.high.z))
+				pointsbox.high.z = points[i].z;
+		}
+		box = &pointsbox;
+	}
+
+	if (builder->npts == 0)
+		builder->boundbox = *box;
+	else
+	{
+		if (FPlt(box->low.x, builder->boundbox.low.x))
+			builder->boundbox.low.x = box->low.x;
+		if (FPgt(box->high.x, builder->boundbox.high.x))
+			builder->boundbox.high.x = box->high.x;
+		if (FPlt(box->low.y, builder->boundbox.low.y))
+			builder->boundbox.low.y = box->low.y;
+		if (FPgt(box->high.y, builder->boundbox.high.y))
+			builder->boundbox.high.y = box->high.y;
+		if (FPlt(box->low.z, builder->boundbox.low.z))
+			builder->boundbox.low.z = box->low.z;
+		if (FPgt(box->high.z, builder->boundbox.high.z))
+			builder->boundbox.high.z = box->high.z;
+	}
+	builder->npts += npts;
+}
+
+/*
+ * path3D_builder_finish: Fill the header of the Path3D being built and
+ * return it. The result shares the buffer of the builder, which must not
+ * be appended to while the result is in use.
+ */
+Path3D *
+path3D_builder_finish(Point3DBuilder *builder, bool closed)
+{
+	Path3D	   *path = (Path3D *) builder->data;
+
+	Assert(builder->hdrsize == offsetof(Path3D, p));
+	if (builder->npts == 0)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("Cannot create bounding box for empty path3D")));
+
+	SET_VARSIZE(path, offsetof(Path3D, p) + sizeof(Point3D) * builder->npts);
+	path->npts = builder->npts;
+	path->closed = closed;
+	/* prevent instability in unused pad bytes */
+	path->dummy = 0;
+	path->boundbox = builder->boundbox;
+	return path;
+}
+
+/*
+ * poly3D_builder_finish: Fill the header of the Polygon3D being built and
+ * return it, with the same restrictions as path3D_builder_finish
+ */
+Polygon3D *
+poly3D_builder_finish(Point3DBuilder *builder)
+{
+	Polygon3D  *poly = (Polygon3D *) builder->data;
+
+	Assert(builder->hdrsize == offsetof(Polygon3D, p));
+	if (builder->npts < 3 ||
+		!plist_test3noncollinearpts(POINT3D_BUILDER_POINTS(builder),
+			builder->npts))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("Invalid polygon3D specification: a polygon requires at least 3 non collinear points")));
+
+	SET_VARSIZE(poly, offsetof(Polygon3D, p) + sizeof(Point3D) * builder->npts);
+	poly->npts = builder->npts;
+	poly->boundbox = builder->boundbox;
+	return poly;
+}
+
 /*
  * path3D_in: Read in the Path3D from a string specification
  *
@@ -3232,7 +3767,6 @@ path3D_recv(PG_FUNCTION_ARGS)
 	Path3D	   *path;
 	int			closed;
 	int32		npts;
-	int32		i;
 	int			size;
 
 	closed = pq_getmsgbyte(buf);
@@ -3251,15 +3785,8 @@ path3D_recv(PG_FUNCTION_ARGS)
 	/* prevent instability in unused pad bytes */
 	path->dummy = 0;
 
-	for (i = 0; i < npts; i++)
-	{
-		path->p[i].x = pq_getmsgfloat8(buf);
-		path->p[i].y = pq_getmsgfloat8(buf);
-		path->p[i].z = pq_getmsgfloat8(buf);
-	}
+	point3D_array_recv(buf, path->p, npts, &path->boundbox);
 
-	path3D_make_bbox(path);
-	
 	PG_RETURN_PATH3D_P(path);
 }
 
@@ -3273,17 +3800,11 @@ path3D_send(PG_FUNCTION_ARGS)
 {
 	Path3D	   *path = PG_GETARG_PATH3D_P(0);
 	StringInfoData buf;
-	int32		i;
 
 	pq_begintypsend(&buf);
 	pq_sendbyte(&buf, path->closed ? 1 : 0);
 	pq_sendint(&buf, path->npts, sizeof(int32));
-	for (i = 0; i < path->npts; i++)
-	{
-		pq_sendfloat8(&buf, path->p[i].x);
-		pq_sendfloat8(&buf, path->p[i].y);
-		pq_sendfloat8(&buf, path->p[i].z);
-	}
+	point3D_array_send(&buf, path->p, path->npts);
 	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
 }
 
@@ -3320,8 +3841,14 @@ path3D_copy(Path3D *path)
 Datum
 path3D_npoints(PG_FUNCTION_ARGS)
 {
-	Path3D	     *path = PG_GETARG_PATH3D_P(0);
+	ExpandedPoint3D *ep = DatumGetExpandedPoint3DIfAny(PG_GETARG_DATUM(0));
+	Path3D	     *path;
+
+	/* Avoid flattening an expanded path */
+	if (ep != NULL)
+		PG_RETURN_INT32(ep->builder.npts);
 
+	path = PG_GETARG_PATH3D_P(0);
 	PG_RETURN_INT32(path->npts);
 }
 
@@ -3655,7 +4182,7 @@ path3D_same_internal(Path3D *path1, Path3D *path2)
 /*
  * path3D_cmp_internal: Compare the two Path3D
  */
-static int 
+int 
 path3D_cmp_internal(Path3D* p1, Path3D* p2) 
 {
 	int 		npts = p1->npts < p2->npts ? p1->npts : p2->npts,
@@ -3797,7 +4324,23 @@ PG_FUNCTION_INFO_V1(path3D_ge);
 Datum
 path3D_close(PG_FUNCTION_ARGS)
 {
-	Path3D	   *path = PG_GETARG_PATH3D_P_COPY(0);
+	Path3D	   *path;
+
+	/* Close an expanded path in place */
+	if (VARATT_IS_EXTERNAL_EXPANDED_RW(DatumGetPointer(PG_GETARG_DATUM(0))))
+	{
+		ExpandedPoint3D *ep = DatumGetExpandedPath3D(PG_GETARG_DATUM(0));
+
+		if (!plist_test3noncollinearpts(POINT3D_BUILDER_POINTS(&ep->builder),
+				ep->builder.npts))
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+					 errmsg("Invalid path3D specification: a closed path requires at least 3 non collinear points")));
+		ep->closed = TRUE;
+		PG_RETURN_DATUM(EOHPGetRWDatum(&ep->hdr));
+	}
+
+	path = PG_GETARG_PATH3D_P_COPY(0);
 
 	/* Check for at least 3 non collinear points for closed paths */
 	if (!plist_test3noncollinearpts(path->p, path->npts))
@@ -3818,8 +4361,18 @@ PG_FUNCTION_INFO_V1(path3D_close) ;
 Datum
 path3D_open(PG_FUNCTION_ARGS)
 {
-	Path3D	   *path = PG_GETARG_PATH3D_P_COPY(0);
+	Path3D	   *path;
 
+	/* Open an expanded path in place */
+	if (VARATT_IS_EXTERNAL_EXPANDED_RW(DatumGetPointer(PG_GETARG_DATUM(0))))
+	{
+		ExpandedPoint3D *ep = DatumGetExpandedPath3D(PG_GETARG_DATUM(0));
+
+		ep->closed = FALSE;
+		PG_RETURN_DATUM(EOHPGetRWDatum(&ep->hdr));
+	}
+
+	path = PG_GETARG_PATH3D_P_COPY(0);
 	path->closed = FALSE;
 
 	PG_RETURN_PATH3D_P(path);
@@ -3873,48 +4426,30 @@ PG_FUNCTION_INFO_V1(path3D_poly3D);
 Datum
 path3D_concat(PG_FUNCTION_ARGS)
 {
-	Path3D	   *p1 = PG_GETARG_PATH3D_P(0);
+	Path3D	   *p1;
 	Path3D	   *p2 = PG_GETARG_PATH3D_P(1);
-	Path3D	   *result;
-	int			size,
-				base_size;
-	int			i;
-
-	if (p1->closed || p2->closed)
-		PG_RETURN_NULL();
+	Point3DBuilder builder;
 
-	base_size = sizeof(p1->p[0]) * (p1->npts + p2->npts);
-	size = offsetof(Path3D, p) +base_size;
-
-	/* Check for integer overflow */
-	if (base_size / sizeof(p1->p[0]) != (p1->npts + p2->npts) ||
-		size <= base_size)
-		ereport(ERROR,
-				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
-				 errmsg("Too many points requested")));
+	/* Append in place to an expanded path, see geo3D_expanded.c */
+	if (VARATT_IS_EXTERNAL_EXPANDED_RW(DatumGetPointer(PG_GETARG_DATUM(0))))
+	{
+		ExpandedPoint3D *ep = DatumGetExpandedPath3D(PG_GETARG_DATUM(0));
 
-	result = (Path3D *) palloc(size);
+		if (ep->closed || p2->closed)
+			PG_RETURN_NULL();
+		expanded_point3D_append(ep, p2->p, p2->npts, &p2->boundbox);
+		PG_RETURN_DATUM(EOHPGetRWDatum(&ep->hdr));
+	}
 
-	SET_VARSIZE(result, size);
-	result->npts = (p1->npts + p2->npts);
-	result->closed = p1->closed;
-	/* prevent instability in unused pad bytes */
-	result->dummy = 0;
+	p1 = PG_GETARG_PATH3D_P(0);
+	if (p1->closed || p2->closed)
+		PG_RETURN_NULL();
 
-	for (i = 0; i < p1->npts; i++)
-	{
-		result->p[i].x = p1->p[i].x;
-		result->p[i].y = p1->p[i].y;
-		result->p[i].z = p1->p[i].z;
-	}
-	for (i = 0; i < p2->npts; i++)
-	{
-		result->p[i + p1->npts].x = p2->p[i].x;
-		result->p[i + p1->npts].y = p2->p[i].y;
-		result->p[i + p1->npts].z = p2->p[i].z;
-	}
+	point3D_builder_init(&builder, offsetof(Path3D, p), p1->npts + p2->npts);
+	point3D_builder_append(&builder, p1->p, p1->npts, &p1->boundbox);
+	point3D_builder_append(&builder, p2->p, p2->npts, &p2->boundbox);
 
-	PG_RETURN_PATH3D_P(result);
+	PG_RETURN_PATH3D_P(path3D_builder_finish(&builder, FALSE));
 }
 
 PG_FUNCTION_INFO_V1(path3D_concat);
@@ -4163,7 +4698,6 @@ poly3D_recv(PG_FUNCTION_ARGS)
 	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
 	Polygon3D  *poly;
 	int32		npts;
-	int32		i;
 	int			size;
 
 	npts = pq_getmsgint(buf, sizeof(int32));
@@ -4178,14 +4712,7 @@ poly3D_recv(PG_FUNCTION_ARGS)
 	SET_VARSIZE(poly, size);
 	poly->npts = npts;
 
-	for (i = 0; i < npts; i++)
-	{
-		poly->p[i].x = pq_getmsgfloat8(buf);
-		poly->p[i].y = pq_getmsgfloat8(buf);
-		poly->p[i].z = pq_getmsgfloat8(buf);
-	}
-
-	poly3D_make_bbox(poly);
+	point3D_array_recv(buf, poly->p, npts, &poly->boundbox);
 
 	PG_RETURN_POLYGON3D_P(poly);
 }
@@ -4200,16 +4727,10 @@ poly3D_send(PG_FUNCTION_ARGS)
 {
 	Polygon3D    *poly = PG_GETARG_POLYGON3D_P(0);
 	StringInfoData buf;
-	int32		i;
 
 	pq_begintypsend(&buf);
 	pq_sendint(&buf, poly->npts, sizeof(int32));
-	for (i = 0; i < poly->npts; i++)
-	{
-		pq_sendfloat8(&buf, poly->p[i].x);
-		pq_sendfloat8(&buf, poly->p[i].y);
-		pq_sendfloat8(&buf, poly->p[i].z);
-	}
+	point3D_array_send(&buf, poly->p, poly->npts);
 	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
 }
 
@@ -4246,8 +4767,14 @@ poly3D_copy(Polygon3D *poly)
 Datum
 poly3D_npoints(PG_FUNCTION_ARGS)
 {
-	Polygon3D    *poly = PG_GETARG_POLYGON3D_P(0);
+	ExpandedPoint3D *ep = DatumGetExpandedPoint3DIfAny(PG_GETARG_DATUM(0));
+	Polygon3D    *poly;
+
+	/* Avoid flattening an expanded polygon */
+	if (ep != NULL)
+		PG_RETURN_INT32(ep->builder.npts);
 
+	poly = PG_GETARG_POLYGON3D_P(0);
 	PG_RETURN_INT32(poly->npts);
 }
 
@@ -4827,32 +5354,18 @@ Datum
 sphere_out(PG_FUNCTION_ARGS)
 {
 	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
-	char	   *result;
-	char	   *cp;
-
-	result = palloc(2 * P_MAXLEN + 6);
-
-	cp = result;
-	*cp++ = LDELIM_S;
-	*cp++ = LDELIM;
-	if (!triple_encode(sphere->center.x, sphere->center.y, sphere->center.z, cp))
-		ereport(ERROR,
-				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-				 errmsg("Could not format \"sphere\" value")));
-
-	cp += strlen(cp);
-	*cp++ = RDELIM;
-	*cp++ = DELIM;
-	if (!single_encode(sphere->radius, cp))
-		ereport(ERROR,
-				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
-				 errmsg("Could not format \"sphere\" value")));
+	StringInfoData str;
 
-	cp += strlen(cp);
-	*cp++ = RDELIM_S;
-	*cp = '\0';
+	initStringInfo(&str);
+	appendStringInfoCharMacro(&str, LDELIM_S);
+	appendStringInfoCharMacro(&str, LDELIM);
+	triple_encode(sphere->center.x, sphere->center.y, sphere->center.z, &str);
+	appendStringInfoCharMacro(&str, RDELIM);
+	appendStringInfoCharMacro(&str, DELIM);
+	single_encode(sphere->radius, &str);
+	appendStringInfoCharMacro(&str, RDELIM_S);
 
-	PG_RETURN_CSTRING(result);
+	PG_RETURN_CSTRING(str.data);
 }
 
 PG_FUNCTION_INFO_V1(sphere_out);
@@ -5064,25 +5577,12 @@ sphere_same_internal(Sphere *sphere1, Sphere *sphere2)
 static int 
 sphere_cmp_internal(Sphere* s1, Sphere* s2) 
 {
-	if(FPlt(s1->center.x, s2->center.x))
-		return -1;
-	if(FPgt(s1->center.x, s2->center.x))
-		return 1;
-	if(FPlt(s1->center.y, s2->center.y))
-		return -1;
-	if(FPgt(s1->center.y, s2->center.y))
-		return 1;
-	if(FPlt(s1->center.z, s2->center.z))
-		return -1;
-	if(FPgt(s1->center.z, s2->center.z))
-		return 1;
+	int			cmp = point3D_cmp_coords(&s1->center, &s2->center);
+
 	// the center points are equal
-	if(FPlt(s1->radius, s2->radius))
-		return -1;
-	if(FPgt(s1->radius, s2->radius))
-		return 1;
-	else
-		return 0;
+	if (cmp == 0)
+		cmp = FPcmp(s1->radius, s2->radius);
+	return cmp;
 }
 
 Datum 
@@ -5095,6 +5595,26 @@ sphere_cmp(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(sphere_cmp);
 
+static int
+sphere_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return sphere_cmp_internal(DatumGetSphereP(x), DatumGetSphereP(y));
+}
+
+/*
+ * sphere_sortsupport: Sort support of the btree operator class
+ */
+Datum
+sphere_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = sphere_fastcmp;
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(sphere_sortsupport);
+
 Datum 
 sphere_lt(PG_FUNCTION_ARGS) 
 {
@@ -5155,6 +5675,39 @@ sphere_ge(PG_FUNCTION_ARGS)
 
 PG_FUNCTION_INFO_V1(sphere_ge);
 
+/*
+ * sphere_exact_eq: Are the centers and the radii of the two spheres exactly
+ * equal
+ */
+Datum 
+sphere_exact_eq(PG_FUNCTION_ARGS) 
+{
+	Sphere* s1 = PG_GETARG_SPHERE_P(0);
+	Sphere* s2 = PG_GETARG_SPHERE_P(1);
+	PG_RETURN_BOOL(point3D_exact_eq_internal(&s1->center, &s2->center) &&
+		FPeq_exact(s1->radius, s2->radius));
+}
+
+PG_FUNCTION_INFO_V1(sphere_exact_eq);
+
+/*
+ * sphere_hash: Hash of the sphere consistent with sphere_exact_eq
+ */
+Datum 
+sphere_hash(PG_FUNCTION_ARGS) 
+{
+	Sphere* sphere = PG_GETARG_SPHERE_P(0);
+	double coords[4];
+
+	coords[0] = sphere->center.x;
+	coords[1] = sphere->center.y;
+	coords[2] = sphere->center.z;
+	coords[3] = sphere->radius;
+	return coords_hash(coords, 4);
+}
+
+PG_FUNCTION_INFO_V1(sphere_hash);
+
 /*----------------------------------------------------------
  *	"Arithmetic" routines on Sphere
  *---------------------------------------------------------*/
@@ -0,0 +1,2874 @@
+/*****************************************************************************
+ *
+ * geo3D_voxel.c
+ *	  Sparse voxel sets
+ *
+ * A VoxelSet3D summarizes a point cloud as the voxels of a regular grid
+ * that contain at least one point, together with the number of points in
+ * each of them. The voxels are identified by the Morton code of their cell
+ * numbers and kept sorted on it, so that a set of millions of voxels is a
+ * single compact value in which a voxel is found by binary search. The
+ * aggregate voxelize3D builds such sets: the keys of the points are
+ * buffered and periodically sorted and merged into the sorted voxels, and
+ * partial sets computed by parallel workers are merged in the same way.
+ *
+ * A VoxelCell3D is a single voxel of a grid with its origin at (0,0,0).
+ * Since cells can be hashed, a join of points within a distance can be
+ * written as an equijoin on the cell of the points of one side and the
+ * cells within the distance of the points of the other side, followed by
+ * the exact test of the distance.
+ *
+ * The Morton or Hilbert code of the voxel of a point is also available as
+ * an int8 key, so that a btree index on the key of the points is a spatial
+ * index. The voxels of each aligned cube of the octree of the grid have
+ * consecutive keys on both curves, so that the voxels intersecting a box
+ * are covered by a few ranges of keys computed by descending the octree.
+ *
+ * An OctCell3D is a cell of any level of this octree. Its identifier
+ * makes the containment of cells, the ancestors and descendants of a cell,
+ * a matter of integer arithmetic, so that cells are indexed by btree and
+ * GIN for containment, and geometries are covered by a few cells of
+ * different levels.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <ctype.h>
+#include <math.h>
+#include <limits.h>
+#include <float.h>
+#include <errno.h>
+
+#if PG_VERSION_NUM >= 130000
+#include <common/hashfn.h>
+#elif PG_VERSION_NUM >= 120000
+#include <utils/hashutils.h>
+#else
+#include <access/hash.h>
+#endif
+#include <access/htup_details.h>
+#include <access/stratnum.h>
+#include <catalog/namespace.h>
+#include <catalog/pg_type.h>
+#include <funcapi.h>
+#include <libpq/pqformat.h>
+#include <utils/array.h>
+#include <utils/builtins.h>
+#include "geo3D_decls.h"
+
+#define LDELIM			'('
+#define RDELIM			')'
+#define DELIM			','
+#define LDELIM_VS		'{'
+#define RDELIM_VS		'}'
+
+/* Maximum number of voxels so that a VoxelSet3D fits in a varlena */
+#define VOXELSET3D_MAXVOXELS	\
+	((int32) ((MaxAllocSize - offsetof(VoxelSet3D, data)) / (2 * sizeof(uint64))))
+
+/* Initial number of point keys buffered by voxelize3D before merging */
+#define VOXELIZE3D_PENDING		1024
+
+/* Maximum number of partition keys returned by partitioncells3D */
+#define PARTITIONCELL3D_MAXKEYS	1000000
+
+/*
+ * Aggregate state of voxelize3D. The keys of the points are appended to
+ * pending, which is sorted and merged into the sorted keys and counts of
+ * the voxels when it is full. The buffer grows with the number of voxels
+ * so that the cost of the merges remains logarithmic per point.
+ */
+typedef struct
+{
+	double		size;
+	Point3D		origin;
+	int32		nvoxels;
+	int32		maxvoxels;
+	uint64	   *keys;
+	int64	   *counts;
+	int32		npending;
+	int32		maxpending;
+	uint64	   *pending;
+	int64	   *runs;			/* counts of the distinct pending keys */
+} VoxelSet3DState;
+
+/* A voxel and its count, used for sorting the voxels read in text format */
+typedef struct
+{
+	uint64		key;
+	int64		count;
+} VoxelCount3D;
+
+/*****************************************************************************
+ * Grid
+ *****************************************************************************/
+
+static void
+voxelset3D_check_grid(double size, Point3D *origin)
+{
+	if (!(size > 0.0) || isinf(size))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("The voxel size must be a positive number")));
+	if (isnan(origin->x) || isinf(origin->x) ||
+		isnan(origin->y) || isinf(origin->y) ||
+		isnan(origin->z) || isinf(origin->z))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("The origin of the voxel grid must be a finite point")));
+}
+
+/*
+ * Compute the cell number of the coordinate, return false if it is out of
+ * the range of the grid
+ */
+static inline bool
+voxelset3D_cell(double coord, double origin, double size, int32 *cell)
+{
+	double		c = floor((coord - origin) / size);
+
+	/* Written so that NaN fails the test */
+	if (!(c >= -VOXELSET3D_OFFSET && c < VOXELSET3D_OFFSET))
+		return false;
+	*cell = (int32) c;
+	return true;
+}
+
+static inline uint64
+voxelset3D_key(int32 i, int32 j, int32 k)
+{
+	return morton3D_encode((uint32) (i + VOXELSET3D_OFFSET),
+		(uint32) (j + VOXELSET3D_OFFSET), (uint32) (k + VOXELSET3D_OFFSET));
+}
+
+static inline void
+voxelset3D_cells(uint64 key, int32 *i, int32 *j, int32 *k)
+{
+	uint32		x,
+				y,
+				z;
+
+	morton3D_decode(key, &x, &y, &z);
+	*i = (int32) x - VOXELSET3D_OFFSET;
+	*j = (int32) y - VOXELSET3D_OFFSET;
+	*k = (int32) z - VOXELSET3D_OFFSET;
+}
+
+/*
+ * Compute the key of the voxel of the point, return false if the point is
+ * out of the range of the grid
+ */
+static inline bool
+voxelset3D_point_key(Point3D *point, double size, Point3D *origin, uint64 *key)
+{
+	int32		i,
+				j,
+				k;
+
+	if (!voxelset3D_cell(point->x, origin->x, size, &i) ||
+		!voxelset3D_cell(point->y, origin->y, size, &j) ||
+		!voxelset3D_cell(point->z, origin->z, size, &k))
+		return false;
+	*key = voxelset3D_key(i, j, k);
+	return true;
+}
+
+static void
+voxelset3D_check_nvoxels(Size nvoxels)
+{
+	if (nvoxels > (Size) VOXELSET3D_MAXVOXELS)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("Too many voxels in a VoxelSet3D value"),
+				 errdetail("The maximum number of voxels is %d.",
+					VOXELSET3D_MAXVOXELS)));
+}
+
+/* Form a VoxelSet3D from sorted distinct keys and their counts */
+static VoxelSet3D *
+voxelset3D_make(double size, Point3D *origin, uint64 *keys, int64 *counts,
+	int32 nvoxels)
+{
+	Size		len = VOXELSET3D_SIZE(nvoxels);
+	VoxelSet3D *result = (VoxelSet3D *) palloc(len);
+
+	SET_VARSIZE(result, len);
+	result->nvoxels = nvoxels;
+	result->size = size;
+	result->origin = *origin;
+	memcpy(VOXELSET3D_KEYS(result), keys, sizeof(uint64) * nvoxels);
+	memcpy(VOXELSET3D_COUNTS(result), counts, sizeof(int64) * nvoxels);
+	return result;
+}
+
+/* Binary search of the key, return its position or -1 if it is absent */
+static int32
+voxelset3D_find(VoxelSet3D *vs, uint64 key)
+{
+	uint64	   *keys = VOXELSET3D_KEYS(vs);
+	int32		lo = 0,
+				hi = vs->nvoxels;
+
+	while (lo < hi)
+	{
+		int32		mid = lo + (hi - lo) / 2;
+
+		if (keys[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo < vs->nvoxels && keys[lo] == key) ? lo : -1;
+}
+
+/*****************************************************************************
+ * Input/Output
+ *****************************************************************************/
+
+static int
+voxelcount3D_cmp(const void *a, const void *b)
+{
+	uint64		ka = ((const VoxelCount3D *) a)->key;
+	uint64		kb = ((const VoxelCount3D *) b)->key;
+
+	return (ka < kb) ? -1 : (ka > kb) ? 1 : 0;
+}
+
+static void
+voxelset3D_syntax_error(char *str)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+			 errmsg("Invalid input syntax for type VoxelSet3D: \"%s\"", str)));
+}
+
+static inline char *
+voxelset3D_skip_spaces(char *s)
+{
+	while (isspace((unsigned char) *s))
+		s++;
+	return s;
+}
+
+/*
+ * voxelset3D_in: Convert a string to internal VoxelSet3D representation
+ *
+ * Input format:
+ *		"((ox,oy,oz),size,{(i0,j0,k0):count0,...,(in,jn,kn):countn})"
+ *
+ * where (ox,oy,oz) is the origin of the grid, size is the edge length of
+ * the voxels, and each voxel is given by its cell numbers and its number
+ * of points. The voxels may be given in any order, the counts of repeated
+ * voxels are added.
+ */
+Datum
+voxelset3D_in(PG_FUNCTION_ARGS)
+{
+	char	   *str = PG_GETARG_CSTRING(0);
+	char	   *s = str;
+	char	   *cp;
+	Point3D		origin;
+	double		size;
+	VoxelCount3D *voxels;
+	int32		nvoxels = 0,
+				maxvoxels = 64,
+				n,
+				i;
+	uint64	   *keys;
+	int64	   *counts;
+	VoxelSet3D *result;
+
+	s = voxelset3D_skip_spaces(s);
+	if (*s++ != LDELIM ||
+		!triple_decode(s, &origin.x, &origin.y, &origin.z, &s) ||
+		*s++ != DELIM)
+		voxelset3D_syntax_error(str);
+	s = voxelset3D_skip_spaces(s);
+	cp = s;
+	if (!single_decode(cp, &size, &s) || s == cp || *s++ != DELIM)
+		voxelset3D_syntax_error(str);
+	voxelset3D_check_grid(size, &origin);
+
+	s = voxelset3D_skip_spaces(s);
+	if (*s++ != LDELIM_VS)
+		voxelset3D_syntax_error(str);
+	voxels = (VoxelCount3D *) palloc(sizeof(VoxelCount3D) * maxvoxels);
+	s = voxelset3D_skip_spaces(s);
+	if (*s == RDELIM_VS)
+		s++;
+	else
+	{
+		for (;;)
+		{
+			double		x,
+						y,
+						z;
+			long long	count;
+
+			if (!triple_decode(s, &x, &y, &z, &s) || *s++ != ':')
+				voxelset3D_syntax_error(str);
+			if (x != floor(x) || x < -VOXELSET3D_OFFSET || x >= VOXELSET3D_OFFSET ||
+				y != floor(y) || y < -VOXELSET3D_OFFSET || y >= VOXELSET3D_OFFSET ||
+				z != floor(z) || z < -VOXELSET3D_OFFSET || z >= VOXELSET3D_OFFSET)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+						 errmsg("Invalid voxel in VoxelSet3D: cell numbers must be integers between %d and %d",
+							-VOXELSET3D_OFFSET, VOXELSET3D_OFFSET - 1)));
+			s = voxelset3D_skip_spaces(s);
+			errno = 0;
+			count = strtoll(s, &cp, 10);
+			if (cp == s)
+				voxelset3D_syntax_error(str);
+			if (errno == ERANGE || count <= 0)
+				ereport(ERROR,
+						(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+						 errmsg("Invalid voxel in VoxelSet3D: counts must be positive integers")));
+			s = voxelset3D_skip_spaces(cp);
+
+			if (nvoxels == maxvoxels)
+			{
+				voxelset3D_check_nvoxels((Size) maxvoxels * 2);
+				maxvoxels *= 2;
+				voxels = (VoxelCount3D *) repalloc_huge(voxels,
+					sizeof(VoxelCount3D) * maxvoxels);
+			}
+			voxels[nvoxels].key = voxelset3D_key((int32) x, (int32) y, (int32) z);
+			voxels[nvoxels++].count = (int64) count;
+
+			if (*s == RDELIM_VS)
+			{
+				s++;
+				break;
+			}
+			if (*s++ != DELIM)
+				voxelset3D_syntax_error(str);
+		}
+	}
+	s = voxelset3D_skip_spaces(s);
+	if (*s++ != RDELIM)
+		voxelset3D_syntax_error(str);
+	s = voxelset3D_skip_spaces(s);
+	if (*s != '\0')
+		voxelset3D_syntax_error(str);
+
+	/* Sort the voxels and add the counts of repeated ones */
+	qsort(voxels, nvoxels, sizeof(VoxelCount3D), voxelcount3D_cmp);
+	keys = (uint64 *) palloc(sizeof(uint64) * Max(nvoxels, 1));
+	counts = (int64 *) palloc(sizeof(int64) * Max(nvoxels, 1));
+	n = 0;
+	for (i = 0; i < nvoxels; i++)
+	{
+		if (n > 0 && keys[n - 1] == voxels[i].key)
+			counts[n - 1] += voxels[i].count;
+		else
+		{
+			keys[n] = voxels[i].key;
+			counts[n++] = voxels[i].count;
+		}
+	}
+
+	result = voxelset3D_make(size, &origin, keys, counts, n);
+	pfree(voxels);
+	pfree(keys);
+	pfree(counts);
+	PG_RETURN_VOXELSET3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_in);
+
+/*
+ * voxelset3D_out: Convert internal VoxelSet3D representation to character
+ * string
+ *
+ * Output format:
+ *		"((ox,oy,oz),size,{(i0,j0,k0):count0,...,(in,jn,kn):countn})"
+ *
+ * The voxels are output in the order of their Morton code.
+ */
+Datum
+voxelset3D_out(PG_FUNCTION_ARGS)
+{
+	VoxelSet3D *vs = PG_GETARG_VOXELSET3D_P(0);
+	uint64	   *keys = VOXELSET3D_KEYS(vs);
+	int64	   *counts = VOXELSET3D_COUNTS(vs);
+	StringInfoData str;
+	int32		n;
+
+	initStringInfo(&str);
+	appendStringInfoChar(&str, LDELIM);
+	appendStringInfoChar(&str, LDELIM);
+	triple_encode(vs->origin.x, vs->origin.y, vs->origin.z, &str);
+	appendStringInfoChar(&str, RDELIM);
+	appendStringInfoChar(&str, DELIM);
+	single_encode(vs->size, &str);
+	appendStringInfoChar(&str, DELIM);
+	appendStringInfoChar(&str, LDELIM_VS);
+	for (n = 0; n < vs->nvoxels; n++)
+	{
+		int32		i,
+					j,
+					k;
+
+		voxelset3D_cells(keys[n], &i, &j, &k);
+		if (n > 0)
+			appendStringInfoChar(&str, DELIM);
+		appendStringInfo(&str, "(%d,%d,%d):" INT64_FORMAT, i, j, k, counts[n]);
+	}
+	appendStringInfoChar(&str, RDELIM_VS);
+	appendStringInfoChar(&str, RDELIM);
+
+	PG_RETURN_CSTRING(str.data);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_out);
+
+/*
+ * voxelset3D_recv: Convert external binary representation to VoxelSet3D
+ *
+ * External representation is int32 number of voxels, float8 voxel size,
+ * the origin, the int8 keys of the voxels in increasing order, and their
+ * int8 counts.
+ */
+Datum
+voxelset3D_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	VoxelSet3D *result;
+	uint64	   *keys;
+	int64	   *counts;
+	int32		nvoxels;
+	double		size;
+	Point3D		origin;
+	int32		i;
+
+	nvoxels = pq_getmsgint(buf, sizeof(int32));
+	if (nvoxels < 0 || nvoxels > VOXELSET3D_MAXVOXELS ||
+		(Size) nvoxels * 2 * sizeof(int64) > (Size) (buf->len - buf->cursor))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+			 errmsg("Invalid number of voxels in external \"VoxelSet3D\" value")));
+	size = pq_getmsgfloat8(buf);
+	origin.x = pq_getmsgfloat8(buf);
+	origin.y = pq_getmsgfloat8(buf);
+	origin.z = pq_getmsgfloat8(buf);
+	voxelset3D_check_grid(size, &origin);
+
+	result = (VoxelSet3D *) palloc(VOXELSET3D_SIZE(nvoxels));
+	SET_VARSIZE(result, VOXELSET3D_SIZE(nvoxels));
+	result->nvoxels = nvoxels;
+	result->size = size;
+	result->origin = origin;
+	keys = VOXELSET3D_KEYS(result);
+	counts = VOXELSET3D_COUNTS(result);
+	for (i = 0; i < nvoxels; i++)
+	{
+		keys[i] = (uint64) pq_getmsgint64(buf);
+		/* Keys use 3 * MORTON3D_BITS bits and must be strictly increasing */
+		if ((keys[i] >> (3 * MORTON3D_BITS)) != 0 ||
+			(i > 0 && keys[i] <= keys[i - 1]))
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("Invalid voxel keys in external \"VoxelSet3D\" value")));
+	}
+	for (i = 0; i < nvoxels; i++)
+	{
+		counts[i] = pq_getmsgint64(buf);
+		if (counts[i] <= 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("Invalid voxel counts in external \"VoxelSet3D\" value")));
+	}
+
+	PG_RETURN_VOXELSET3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_recv);
+
+/*
+ * voxelset3D_send: Convert VoxelSet3D to binary representation
+ */
+Datum
+voxelset3D_send(PG_FUNCTION_ARGS)
+{
+	VoxelSet3D *vs = PG_GETARG_VOXELSET3D_P(0);
+	uint64	   *keys = VOXELSET3D_KEYS(vs);
+	int64	   *counts = VOXELSET3D_COUNTS(vs);
+	StringInfoData buf;
+	int32		i;
+
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, vs->nvoxels, sizeof(int32));
+	pq_sendfloat8(&buf, vs->size);
+	pq_sendfloat8(&buf, vs->origin.x);
+	pq_sendfloat8(&buf, vs->origin.y);
+	pq_sendfloat8(&buf, vs->origin.z);
+	for (i = 0; i < vs->nvoxels; i++)
+		pq_sendint64(&buf, (int64) keys[i]);
+	for (i = 0; i < vs->nvoxels; i++)
+		pq_sendint64(&buf, counts[i]);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_send);
+
+/*****************************************************************************
+ * Accessors
+ *****************************************************************************/
+
+/*
+ * voxelset3D_nvoxels: Number of voxels of the VoxelSet3D
+ */
+Datum
+voxelset3D_nvoxels(PG_FUNCTION_ARGS)
+{
+	VoxelSet3D *vs = PG_GETARG_VOXELSET3D_P(0);
+
+	PG_RETURN_INT32(vs->nvoxels);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_nvoxels);
+
+/*
+ * voxelset3D_voxelsize: Edge length of the voxels of the VoxelSet3D
+ */
+Datum
+voxelset3D_voxelsize(PG_FUNCTION_ARGS)
+{
+	VoxelSet3D *vs = PG_GETARG_VOXELSET3D_P(0);
+
+	PG_RETURN_FLOAT8(vs->size);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_voxelsize);
+
+/*
+ * voxelset3D_origin: Low corner of the voxel (0,0,0) of the VoxelSet3D
+ */
+Datum
+voxelset3D_origin(PG_FUNCTION_ARGS)
+{
+	VoxelSet3D *vs = PG_GETARG_VOXELSET3D_P(0);
+	Point3D    *result = (Point3D *) palloc(sizeof(Point3D));
+
+	*result = vs->origin;
+	PG_RETURN_POINT3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_origin);
+
+/*
+ * voxelset3D_count: Number of points in the voxel containing the point,
+ * zero if the voxel is not in the VoxelSet3D
+ */
+Datum
+voxelset3D_count(PG_FUNCTION_ARGS)
+{
+	VoxelSet3D *vs = PG_GETARG_VOXELSET3D_P(0);
+	Point3D    *point = PG_GETARG_POINT3D_P(1);
+	uint64		key;
+	int32		pos;
+
+	if (!voxelset3D_point_key(point, vs->size, &vs->origin, &key))
+		PG_RETURN_INT64(0);
+	pos = voxelset3D_find(vs, key);
+	PG_RETURN_INT64(pos < 0 ? 0 : VOXELSET3D_COUNTS(vs)[pos]);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_count);
+
+/*
+ * voxelset3D_voxels: Return the voxels of the VoxelSet3D as rows of their
+ * cell numbers, their box, and their number of points
+ */
+Datum
+voxelset3D_voxels(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+	VoxelSet3D *vs;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		TupleDesc	tupdesc;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+		funcctx->user_fctx = PG_GETARG_VOXELSET3D_P_COPY(0);
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	vs = (VoxelSet3D *) funcctx->user_fctx;
+
+	if (funcctx->call_cntr < (uint64) vs->nvoxels)
+	{
+		int32		n = (int32) funcctx->call_cntr;
+		Box3D	   *box = (Box3D *) palloc(sizeof(Box3D));
+		Datum		values[5];
+		bool		nulls[5] = {false, false, false, false, false};
+		int32		i,
+					j,
+					k;
+		HeapTuple	tuple;
+
+		voxelset3D_cells(VOXELSET3D_KEYS(vs)[n], &i, &j, &k);
+		box->low.x = vs->origin.x + i * vs->size;
+		box->low.y = vs->origin.y + j * vs->size;
+		box->low.z = vs->origin.z + k * vs->size;
+		box->high.x = box->low.x + vs->size;
+		box->high.y = box->low.y + vs->size;
+		box->high.z = box->low.z + vs->size;
+
+		values[0] = Int32GetDatum(i);
+		values[1] = Int32GetDatum(j);
+		values[2] = Int32GetDatum(k);
+		values[3] = Box3DPGetDatum(box);
+		values[4] = Int64GetDatum(VOXELSET3D_COUNTS(vs)[n]);
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+
+PG_FUNCTION_INFO_V1(voxelset3D_voxels);
+
+/*****************************************************************************
+ * Aggregate
+ *****************************************************************************/
+
+static VoxelSet3DState *
+voxelset3D_state_make(MemoryContext context, double size, Point3D *origin,
+	int32 maxvoxels)
+{
+	VoxelSet3DState *state = (VoxelSet3DState *) MemoryContextAllocZero(context,
+		sizeof(VoxelSet3DState));
+
+	state->size = size;
+	state->origin = *origin;
+	state->maxvoxels = Max(maxvoxels, 64);
+	state->keys = (uint64 *) MemoryContextAllocHuge(context,
+		sizeof(uint64) * state->maxvoxels);
+	state->counts = (int64 *) MemoryContextAllocHuge(context,
+		sizeof(int64) * state->maxvoxels);
+	state->maxpending = VOXELIZE3D_PENDING;
+	state->pending = (uint64 *) MemoryContextAllocHuge(context,
+		sizeof(uint64) * state->maxpending);
+	state->runs = (int64 *) MemoryContextAllocHuge(context,
+		sizeof(int64) * state->maxpending);
+	return state;
+}
+
+static void
+voxelset3D_state_check_grid(VoxelSet3DState *state, double size, Point3D *origin)
+{
+	if (size != state->size || origin->x != state->origin.x ||
+		origin->y != state->origin.y || origin->z != state->origin.z)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("The voxel size and origin of voxelize3D must be the same for all rows")));
+}
+
+/*
+ * Merge the sorted distinct keys and their counts into the voxels of the
+ * state. The merge goes backwards from the end of the enlarged arrays so
+ * that it is done in place. The arrays are enlarged with repalloc so they
+ * remain in the memory context of the state.
+ */
+static void
+voxelset3D_state_merge(VoxelSet3DState *state, uint64 *keys, int64 *counts,
+	int32 n)
+{
+	uint64	   *skeys;
+	int64	   *scounts;
+	int32		i = state->nvoxels - 1,
+				j = n - 1,
+				total,
+				k;
+
+	if (n == 0)
+		return;
+	voxelset3D_check_nvoxels((Size) state->nvoxels + n);
+	total = state->nvoxels + n;
+	if (total > state->maxvoxels)
+	{
+		state->maxvoxels = Max(total, state->maxvoxels * 2);
+		state->maxvoxels = Min(state->maxvoxels, VOXELSET3D_MAXVOXELS);
+		state->keys = (uint64 *) repalloc_huge(state->keys,
+			sizeof(uint64) * state->maxvoxels);
+		state->counts = (int64 *) repalloc_huge(state->counts,
+			sizeof(int64) * state->maxvoxels);
+	}
+	skeys = state->keys;
+	scounts = state->counts;
+
+	k = total;
+	while (j >= 0)
+	{
+		k--;
+		if (i >= 0 && skeys[i] > keys[j])
+		{
+			skeys[k] = skeys[i];
+			scounts[k] = scounts[i--];
+		}
+		else if (i >= 0 && skeys[i] == keys[j])
+		{
+			skeys[k] = keys[j];
+			scounts[k] = scounts[i--] + counts[j--];
+		}
+		else
+		{
+			skeys[k] = keys[j];
+			scounts[k] = counts[j--];
+		}
+	}
+	/* Close the gap left by the keys that were in both inputs */
+	if (k > i + 1)
+	{
+		memmove(skeys + i + 1, skeys + k, sizeof(uint64) * (total - k));
+		memmove(scounts + i + 1, scounts + k, sizeof(int64) * (total - k));
+	}
+	state->nvoxels = i + 1 + (total - k);
+}
+
+static int
+uint64_cmp(const void *a, const void *b)
+{
+	uint64		ka = *(const uint64 *) a;
+	uint64		kb = *(const uint64 *) b;
+
+	return (ka < kb) ? -1 : (ka > kb) ? 1 : 0;
+}
+
+/* Sort the pending keys and merge them into the voxels of the state */
+static void
+voxelset3D_state_flush(VoxelSet3DState *state)
+{
+	int32		nruns = 0,
+				i;
+
+	if (state->npending == 0)
+		return;
+
+	qsort(state->pending, state->npending, sizeof(uint64), uint64_cmp);
+	for (i = 0; i < state->npending; i++)
+	{
+		if (nruns > 0 && state->pending[nruns - 1] == state->pending[i])
+			state->runs[nruns - 1]++;
+		else
+		{
+			state->pending[nruns] = state->pending[i];
+			state->runs[nruns++] = 1;
+		}
+	}
+	voxelset3D_state_merge(state, state->pending, state->runs, nruns);
+	state->npending = 0;
+
+	if (state->nvoxels > state->maxpending / 2)
+	{
+		state->maxpending *= 2;
+		state->pending = (uint64 *) repalloc_huge(state->pending,
+			sizeof(uint64) * state->maxpending);
+		state->runs = (int64 *) repalloc_huge(state->runs,
+			sizeof(int64) * state->maxpending);
+	}
+}
+
+/*
+ * voxelize3D_transfn: Add the point in argument 1 to the voxels of the grid
+ * of size argument 2 and origin argument 3, the origin defaulting to
+ * (0,0,0). NULL points are ignored.
+ */
+Datum
+voxelize3D_transfn(PG_FUNCTION_ARGS)
+{
+	MemoryContext aggcontext;
+	VoxelSet3DState *state;
+	Point3D		origin = {0.0, 0.0, 0.0};
+	double		size;
+	uint64		key;
+
+	if (!AggCheckCallContext(fcinfo, &aggcontext))
+		elog(ERROR, "voxelize3D_transfn called in non-aggregate context");
+
+	state = PG_ARGISNULL(0) ? NULL : (VoxelSet3DState *) PG_GETARG_POINTER(0);
+	if (PG_ARGISNULL(1))
+	{
+		if (state == NULL)
+			PG_RETURN_NULL();
+		PG_RETURN_POINTER(state);
+	}
+	if (PG_ARGISNULL(2) || (PG_NARGS() > 3 && PG_ARGISNULL(3)))
+		ereport(ERROR,
+				(errcode(ERRCODE_NULL_VALUE_NOT_ALLOWED),
+				 errmsg("The voxel size and origin of voxelize3D cannot be NULL")));
+	size = PG_GETARG_FLOAT8(2);
+	if (PG_NARGS() > 3)
+		origin = *PG_GETARG_POINT3D_P(3);
+
+	if (state == NULL)
+	{
+		voxelset3D_check_grid(size, &origin);
+		state = voxelset3D_state_make(aggcontext, size, &origin, 0);
+	}
+	else
+		voxelset3D_state_check_grid(state, size, &origin);
+
+	if (!voxelset3D_point_key(PG_GETARG_POINT3D_P(1), state->size,
+			&state->origin, &key))
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("Point out of the range of the voxel grid"),
+				 errhint("Use a larger voxel size or an origin closer to the points.")));
+
+	if (state->npending == state->maxpending)
+		voxelset3D_state_flush(state);
+	state->pending[state->npending++] = key;
+
+	PG_RETURN_POINTER(state);
+}
+
+PG_FUNCTION_INFO_V1(voxelize3D_transfn);
+
+/*
+ * voxelize3D_combinefn: Merge the voxels of two aggregate states
+ */
+Datum
+voxelize3D_combinefn(PG_FUNCTION_ARGS)
+{
+	MemoryContext aggcontext;
+	VoxelSet3DState *state1,
+			   *state2;
+
+	if (!AggCheckCallContext(fcinfo, &aggcontext))
+		elog(ERROR, "voxelize3D_combinefn called in non-aggregate context");
+
+	state1 = PG_ARGISNULL(0) ? NULL : (VoxelSet3DState *) PG_GETARG_POINTER(0);
+	state2 = PG_ARGISNULL(1) ? NULL : (VoxelSet3DState *) PG_GETARG_POINTER(1);
+	if (state2 == NULL)
+	{
+		if (state1 == NULL)
+			PG_RETURN_NULL();
+		PG_RETURN_POINTER(state1);
+	}
+
+	voxelset3D_state_flush(state2);
+	if (state1 == NULL)
+		state1 = voxelset3D_state_make(aggcontext, state2->size,
+			&state2->origin, state2->nvoxels);
+	else
+		voxelset3D_state_check_grid(state1, state2->size, &state2->origin);
+	voxelset3D_state_merge(state1, state2->keys, state2->counts,
+		state2->nvoxels);
+
+	PG_RETURN_POINTER(state1);
+}
+
+PG_FUNCTION_INFO_V1(voxelize3D_combinefn);
+
+/*
+ * voxelize3D_serialfn: Serialize the aggregate state as a VoxelSet3D
+ */
+Datum
+voxelize3D_serialfn(PG_FUNCTION_ARGS)
+{
+	VoxelSet3DState *state = (VoxelSet3DState *) PG_GETARG_POINTER(0);
+
+	voxelset3D_state_flush(state);
+	PG_RETURN_BYTEA_P(voxelset3D_make(state->size, &state->origin,
+		state->keys, state->counts, state->nvoxels));
+}
+
+PG_FUNCTION_INFO_V1(voxelize3D_serialfn);
+
+/*
+ * voxelize3D_deserialfn: Rebuild the aggregate state from a VoxelSet3D
+ */
+Datum
+voxelize3D_deserialfn(PG_FUNCTION_ARGS)
+{
+	VoxelSet3D *vs = (VoxelSet3D *) PG_GETARG_BYTEA_P(0);
+	VoxelSet3DState *state;
+
+	state = voxelset3D_state_make(CurrentMemoryContext, vs->size, &vs->origin,
+		vs->nvoxels);
+	state->nvoxels = vs->nvoxels;
+	memcpy(state->keys, VOXELSET3D_KEYS(vs), sizeof(uint64) * vs->nvoxels);
+	memcpy(state->counts, VOXELSET3D_COUNTS(vs), sizeof(int64) * vs->nvoxels);
+
+	PG_RETURN_POINTER(state);
+}
+
+PG_FUNCTION_INFO_V1(voxelize3D_deserialfn);
+
+/*
+ * voxelize3D_finalfn: Return the voxels of the aggregate state as a
+ * VoxelSet3D, NULL if there were no points
+ */
+Datum
+voxelize3D_finalfn(PG_FUNCTION_ARGS)
+{
+	VoxelSet3DState *state;
+
+	if (PG_ARGISNULL(0))
+		PG_RETURN_NULL();
+	state = (VoxelSet3DState *) PG_GETARG_POINTER(0);
+	voxelset3D_state_flush(state);
+	if (state->nvoxels == 0)
+		PG_RETURN_NULL();
+
+	PG_RETURN_VOXELSET3D_P(voxelset3D_make(state->size, &state->origin,
+		state->keys, state->counts, state->nvoxels));
+}
+
+PG_FUNCTION_INFO_V1(voxelize3D_finalfn);
+
+/*****************************************************************************
+ * Voxel cells
+ *****************************************************************************/
+
+static void
+voxelcell3D_syntax_error(char *str)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+			 errmsg("Invalid input syntax for type VoxelCell3D: \"%s\"", str)));
+}
+
+/*
+ * voxelcell3D_in: Convert a string to internal VoxelCell3D representation
+ *
+ * Input format:
+ *		"(i,j,k)"
+ *
+ * where i, j, and k are the cell numbers of the voxel.
+ */
+Datum
+voxelcell3D_in(PG_FUNCTION_ARGS)
+{
+	char	   *str = PG_GETARG_CSTRING(0);
+	char	   *s = str;
+	double		x,
+				y,
+				z;
+	VoxelCell3D *result;
+
+	s = voxelset3D_skip_spaces(s);
+	if (!triple_decode(s, &x, &y, &z, &s))
+		voxelcell3D_syntax_error(str);
+	s = voxelset3D_skip_spaces(s);
+	if (*s != '\0')
+		voxelcell3D_syntax_error(str);
+	if (x != floor(x) || x < -VOXELSET3D_OFFSET || x >= VOXELSET3D_OFFSET ||
+		y != floor(y) || y < -VOXELSET3D_OFFSET || y >= VOXELSET3D_OFFSET ||
+		z != floor(z) || z < -VOXELSET3D_OFFSET || z >= VOXELSET3D_OFFSET)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+				 errmsg("Invalid VoxelCell3D: cell numbers must be integers between %d and %d",
+					-VOXELSET3D_OFFSET, VOXELSET3D_OFFSET - 1)));
+
+	result = (VoxelCell3D *) palloc(sizeof(VoxelCell3D));
+	result->key = voxelset3D_key((int32) x, (int32) y, (int32) z);
+	PG_RETURN_VOXELCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_in);
+
+/*
+ * voxelcell3D_out: Convert internal VoxelCell3D representation to character
+ * string
+ *
+ * Output format:
+ *		"(i,j,k)"
+ */
+Datum
+voxelcell3D_out(PG_FUNCTION_ARGS)
+{
+	VoxelCell3D *cell = PG_GETARG_VOXELCELL3D_P(0);
+	int32		i,
+				j,
+				k;
+
+	voxelset3D_cells(cell->key, &i, &j, &k);
+	PG_RETURN_CSTRING(psprintf("(%d,%d,%d)", i, j, k));
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_out);
+
+/*
+ * voxelcell3D_recv: Convert external binary representation to VoxelCell3D
+ *
+ * External representation is the int4 cell numbers of the voxel.
+ */
+Datum
+voxelcell3D_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	VoxelCell3D *result;
+	int32		cells[3];
+	int			n;
+
+	for (n = 0; n < 3; n++)
+	{
+		cells[n] = pq_getmsgint(buf, sizeof(int32));
+		if (cells[n] < -VOXELSET3D_OFFSET || cells[n] >= VOXELSET3D_OFFSET)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("Invalid cell numbers in external \"VoxelCell3D\" value")));
+	}
+
+	result = (VoxelCell3D *) palloc(sizeof(VoxelCell3D));
+	result->key = voxelset3D_key(cells[0], cells[1], cells[2]);
+	PG_RETURN_VOXELCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_recv);
+
+/*
+ * voxelcell3D_send: Convert VoxelCell3D to binary representation
+ */
+Datum
+voxelcell3D_send(PG_FUNCTION_ARGS)
+{
+	VoxelCell3D *cell = PG_GETARG_VOXELCELL3D_P(0);
+	StringInfoData buf;
+	int32		i,
+				j,
+				k;
+
+	voxelset3D_cells(cell->key, &i, &j, &k);
+	pq_begintypsend(&buf);
+	pq_sendint(&buf, i, sizeof(int32));
+	pq_sendint(&buf, j, sizeof(int32));
+	pq_sendint(&buf, k, sizeof(int32));
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_send);
+
+/*
+ * voxelcell3D_point3D: Voxel of the point in the grid of voxels of the
+ * size in argument 1
+ */
+Datum
+voxelcell3D_point3D(PG_FUNCTION_ARGS)
+{
+	Point3D    *point = PG_GETARG_POINT3D_P(0);
+	double		size = PG_GETARG_FLOAT8(1);
+	Point3D		origin = {0.0, 0.0, 0.0};
+	VoxelCell3D *result = (VoxelCell3D *) palloc(sizeof(VoxelCell3D));
+
+	voxelset3D_check_grid(size, &origin);
+	if (!voxelset3D_point_key(point, size, &origin, &result->key))
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("The point is out of the range of the voxel grid")));
+	PG_RETURN_VOXELCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_point3D);
+
+/*
+ * voxelcell3D_voxel: Box of the voxel in the grid of voxels of the size in
+ * argument 1
+ */
+Datum
+voxelcell3D_voxel(PG_FUNCTION_ARGS)
+{
+	VoxelCell3D *cell = PG_GETARG_VOXELCELL3D_P(0);
+	double		size = PG_GETARG_FLOAT8(1);
+	Point3D		origin = {0.0, 0.0, 0.0};
+	Box3D	   *result = (Box3D *) palloc(sizeof(Box3D));
+	int32		i,
+				j,
+				k;
+
+	voxelset3D_check_grid(size, &origin);
+	voxelset3D_cells(cell->key, &i, &j, &k);
+	result->low.x = i * size;
+	result->low.y = j * size;
+	result->low.z = k * size;
+	result->high.x = result->low.x + size;
+	result->high.y = result->low.y + size;
+	result->high.z = result->low.z + size;
+	PG_RETURN_BOX3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_voxel);
+
+/*
+ * Compute the range of cell numbers of the voxels intersecting the interval
+ * [low, high], clipped to the range of the grid, return false if it is empty
+ */
+static bool
+voxelcells3D_range(double low, double high, double size, int32 *lo, int32 *hi)
+{
+	double		l = floor(low / size),
+				h = floor(high / size);
+
+	/* Written so that NaN fails the test */
+	if (!(l <= h) || h < -VOXELSET3D_OFFSET || l >= VOXELSET3D_OFFSET)
+		return false;
+	*lo = (l < -VOXELSET3D_OFFSET) ? -VOXELSET3D_OFFSET : (int32) l;
+	*hi = (h >= VOXELSET3D_OFFSET) ? VOXELSET3D_OFFSET - 1 : (int32) h;
+	return true;
+}
+
+/*
+ * Return the voxels of the grid of the size in argument 1 that intersect
+ * the point or box in argument 0 expanded by the distance in argument 2.
+ * The voxels of the cube of cell numbers are enumerated from the call
+ * counter, x varying fastest.
+ */
+static Datum
+voxelcells3D_internal(FunctionCallInfo fcinfo, bool ispoint)
+{
+	FuncCallContext *funcctx;
+	int32	   *range;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		Box3D		box;
+		double		size = PG_GETARG_FLOAT8(1);
+		double		distance = PG_GETARG_FLOAT8(2);
+		Point3D		origin = {0.0, 0.0, 0.0};
+
+		voxelset3D_check_grid(size, &origin);
+		if (!(distance >= 0.0) || isinf(distance))
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("The distance must be a non-negative number")));
+		if (ispoint)
+			box.low = box.high = *PG_GETARG_POINT3D_P(0);
+		else
+			box = *PG_GETARG_BOX3D_P(0);
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+		/* Low and high cell numbers on each axis */
+		range = (int32 *) palloc(sizeof(int32) * 6);
+		if (voxelcells3D_range(box.low.x - distance, box.high.x + distance, size,
+				&range[0], &range[3]) &&
+			voxelcells3D_range(box.low.y - distance, box.high.y + distance, size,
+				&range[1], &range[4]) &&
+			voxelcells3D_range(box.low.z - distance, box.high.z + distance, size,
+				&range[2], &range[5]))
+			funcctx->max_calls = (uint64) (range[3] - range[0] + 1) *
+				(uint64) (range[4] - range[1] + 1) *
+				(uint64) (range[5] - range[2] + 1);
+		else
+			funcctx->max_calls = 0;
+		funcctx->user_fctx = range;
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	range = (int32 *) funcctx->user_fctx;
+
+	if (funcctx->call_cntr < funcctx->max_calls)
+	{
+		uint64		n = funcctx->call_cntr;
+		uint64		nx = (uint64) (range[3] - range[0] + 1),
+					ny = (uint64) (range[4] - range[1] + 1);
+		VoxelCell3D *cell = (VoxelCell3D *) palloc(sizeof(VoxelCell3D));
+
+		cell->key = voxelset3D_key(range[0] + (int32) (n % nx),
+			range[1] + (int32) ((n / nx) % ny), range[2] + (int32) (n / nx / ny));
+		SRF_RETURN_NEXT(funcctx, VoxelCell3DPGetDatum(cell));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+
+/*
+ * voxelcells3D_point3D: Voxels of the grid within the distance of the point
+ * along each axis, that is, the voxels that may contain a point within the
+ * distance of the point
+ */
+Datum
+voxelcells3D_point3D(PG_FUNCTION_ARGS)
+{
+	return voxelcells3D_internal(fcinfo, true);
+}
+
+PG_FUNCTION_INFO_V1(voxelcells3D_point3D);
+
+/*
+ * voxelcells3D_box3D: Voxels of the grid intersecting the box expanded by
+ * the distance
+ */
+Datum
+voxelcells3D_box3D(PG_FUNCTION_ARGS)
+{
+	return voxelcells3D_internal(fcinfo, false);
+}
+
+PG_FUNCTION_INFO_V1(voxelcells3D_box3D);
+
+/*
+ * Comparison of voxel cells, in the order of their Morton code
+ */
+static inline int
+voxelcell3D_cmp_internal(VoxelCell3D *a, VoxelCell3D *b)
+{
+	return (a->key < b->key) ? -1 : (a->key > b->key) ? 1 : 0;
+}
+
+Datum
+voxelcell3D_lt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(voxelcell3D_cmp_internal(PG_GETARG_VOXELCELL3D_P(0),
+		PG_GETARG_VOXELCELL3D_P(1)) < 0);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_lt);
+
+Datum
+voxelcell3D_le(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(voxelcell3D_cmp_internal(PG_GETARG_VOXELCELL3D_P(0),
+		PG_GETARG_VOXELCELL3D_P(1)) <= 0);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_le);
+
+Datum
+voxelcell3D_eq(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(voxelcell3D_cmp_internal(PG_GETARG_VOXELCELL3D_P(0),
+		PG_GETARG_VOXELCELL3D_P(1)) == 0);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_eq);
+
+Datum
+voxelcell3D_ne(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(voxelcell3D_cmp_internal(PG_GETARG_VOXELCELL3D_P(0),
+		PG_GETARG_VOXELCELL3D_P(1)) != 0);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_ne);
+
+Datum
+voxelcell3D_ge(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(voxelcell3D_cmp_internal(PG_GETARG_VOXELCELL3D_P(0),
+		PG_GETARG_VOXELCELL3D_P(1)) >= 0);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_ge);
+
+Datum
+voxelcell3D_gt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(voxelcell3D_cmp_internal(PG_GETARG_VOXELCELL3D_P(0),
+		PG_GETARG_VOXELCELL3D_P(1)) > 0);
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_gt);
+
+Datum
+voxelcell3D_cmp(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_INT32(voxelcell3D_cmp_internal(PG_GETARG_VOXELCELL3D_P(0),
+		PG_GETARG_VOXELCELL3D_P(1)));
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_cmp);
+
+/*
+ * voxelcell3D_hash: Hash of the key of the voxel, which is exact so that
+ * equal cells hash equally
+ */
+Datum
+voxelcell3D_hash(PG_FUNCTION_ARGS)
+{
+	VoxelCell3D *cell = PG_GETARG_VOXELCELL3D_P(0);
+
+	return hash_any((unsigned char *) &cell->key, sizeof(uint64));
+}
+
+PG_FUNCTION_INFO_V1(voxelcell3D_hash);
+
+/*****************************************************************************
+ * Space-filling curve keys
+ *****************************************************************************/
+
+/* A node of the octree of the grid, its low cell and its side of 2^level */
+typedef struct
+{
+	uint32		x,
+				y,
+				z;
+	int			level;
+} SFC3DNode;
+
+static inline uint64
+sfc3D_encode(bool hilbert, uint32 x, uint32 y, uint32 z)
+{
+	return hilbert ? hilbert3D_encode(x, y, z) : morton3D_encode(x, y, z);
+}
+
+/*
+ * Compute the cells of the grid of the size, shifted to be non-negative,
+ * that intersect the box, return false if there are none
+ */
+bool
+sfc3D_box_cells(Box3D *box, double size, uint32 *lo, uint32 *hi)
+{
+	int32		l[3],
+				h[3];
+	int			i;
+
+	if (!voxelcells3D_range(box->low.x, box->high.x, size, &l[0], &h[0]) ||
+		!voxelcells3D_range(box->low.y, box->high.y, size, &l[1], &h[1]) ||
+		!voxelcells3D_range(box->low.z, box->high.z, size, &l[2], &h[2]))
+		return false;
+	for (i = 0; i < 3; i++)
+	{
+		lo[i] = (uint32) (l[i] + VOXELSET3D_OFFSET);
+		hi[i] = (uint32) (h[i] + VOXELSET3D_OFFSET);
+	}
+	return true;
+}
+
+static int
+sfc3D_range_cmp(const void *a, const void *b)
+{
+	uint64		x = *(const uint64 *) a,
+				y = *(const uint64 *) b;
+
+	return (x < y) ? -1 : (x > y) ? 1 : 0;
+}
+
+/*
+ * Cover the cells lo..hi with at most maxranges ranges of keys, returned as
+ * pairs of low and high keys in ascending order. The octree of the grid is
+ * descended level by level, the nodes inside the cells contributing the
+ * range of their keys, which are consecutive on both curves, and the nodes
+ * crossing their boundary being split at the next level. Once splitting
+ * them would exceed the budget of ranges, the remaining nodes contribute
+ * their whole range. Adjacent ranges are then merged, followed by the ranges
+ * separated by the smallest gaps until there are at most maxranges of them.
+ */
+int
+sfc3D_ranges(bool hilbert, uint32 *lo, uint32 *hi, int maxranges,
+	uint64 **result)
+{
+	int			budget = Max(maxranges, 1) * 8;
+	SFC3DNode  *nodes,
+			   *next;
+	int			nnodes = 1,
+				nnext,
+				nranges = 0,
+				level = MORTON3D_BITS,
+				i,
+				j,
+				n;
+	uint64	   *ranges = (uint64 *) palloc(sizeof(uint64) * 2 * budget);
+
+	nodes = (SFC3DNode *) palloc(sizeof(SFC3DNode));
+	nodes[0].x = nodes[0].y = nodes[0].z = 0;
+	nodes[0].level = level;
+	while (level > 0 && nnodes > 0 && nranges + 8 * nnodes <= budget)
+	{
+		uint32		side = (uint32) 1 << (level - 1);
+
+		next = (SFC3DNode *) palloc(sizeof(SFC3DNode) * 8 * nnodes);
+		nnext = 0;
+		for (i = 0; i < nnodes; i++)
+		{
+			for (n = 0; n < 8; n++)
+			{
+				SFC3DNode	child;
+				uint32		low[3],
+							high[3];
+				bool		inside = true,
+							outside = false;
+
+				child.x = nodes[i].x + ((n & 1) ? side : 0);
+				child.y = nodes[i].y + ((n & 2) ? side : 0);
+				child.z = nodes[i].z + ((n & 4) ? side : 0);
+				child.level = level - 1;
+				low[0] = child.x;
+				low[1] = child.y;
+				low[2] = child.z;
+				for (j = 0; j < 3; j++)
+				{
+					high[j] = low[j] + side - 1;
+					if (low[j] > hi[j] || high[j] < lo[j])
+						outside = true;
+					if (low[j] < lo[j] || high[j] > hi[j])
+						inside = false;
+				}
+				if (outside)
+					continue;
+				if (inside)
+				{
+					uint64		mask = ((uint64) 1 << (3 * child.level)) - 1;
+
+					ranges[2 * nranges] =
+						sfc3D_encode(hilbert, child.x, child.y, child.z) & ~mask;
+					ranges[2 * nranges + 1] = ranges[2 * nranges] | mask;
+					nranges++;
+				}
+				else
+					next[nnext++] = child;
+			}
+		}
+		pfree(nodes);
+		nodes = next;
+		nnodes = nnext;
+		level--;
+	}
+	/* The nodes that were not split contribute their whole range */
+	for (i = 0; i < nnodes; i++)
+	{
+		uint64		mask = ((uint64) 1 << (3 * nodes[i].level)) - 1;
+
+		ranges[2 * nranges] =
+			sfc3D_encode(hilbert, nodes[i].x, nodes[i].y, nodes[i].z) & ~mask;
+		ranges[2 * nranges + 1] = ranges[2 * nranges] | mask;
+		nranges++;
+	}
+	pfree(nodes);
+
+	if (nranges == 0)
+	{
+		*result = ranges;
+		return 0;
+	}
+	/* The ranges are disjoint, so that sorting them on their low key suffices */
+	qsort(ranges, nranges, 2 * sizeof(uint64), sfc3D_range_cmp);
+	j = 0;
+	for (i = 1; i < nranges; i++)
+	{
+		if (ranges[2 * i] == ranges[2 * j + 1] + 1)
+			ranges[2 * j + 1] = ranges[2 * i + 1];
+		else
+		{
+			j++;
+			ranges[2 * j] = ranges[2 * i];
+			ranges[2 * j + 1] = ranges[2 * i + 1];
+		}
+	}
+	nranges = j + 1;
+	while (nranges > Max(maxranges, 1))
+	{
+		int			k = 0;
+
+		for (i = 1; i < nranges - 1; i++)
+		{
+			if (ranges[2 * i + 2] - ranges[2 * i + 1] <
+				ranges[2 * k + 2] - ranges[2 * k + 1])
+				k = i;
+		}
+		ranges[2 * k + 1] = ranges[2 * k + 3];
+		memmove(&ranges[2 * k + 2], &ranges[2 * k + 4],
+			sizeof(uint64) * 2 * (nranges - k - 2));
+		nranges--;
+	}
+	*result = ranges;
+	return nranges;
+}
+
+static void
+sfc3D_check_size(double size)
+{
+	Point3D		origin = {0.0, 0.0, 0.0};
+
+	voxelset3D_check_grid(size, &origin);
+}
+
+/*
+ * Key of the voxel of the point in the grid of the size with its origin at
+ * (0,0,0). The Morton key is the key of the VoxelCell3D of the point.
+ */
+static Datum
+sfc3D_key_internal(FunctionCallInfo fcinfo, bool hilbert)
+{
+	Point3D    *point = PG_GETARG_POINT3D_P(0);
+	double		size = PG_GETARG_FLOAT8(1);
+	int32		i,
+				j,
+				k;
+
+	sfc3D_check_size(size);
+	if (!voxelset3D_cell(point->x, 0.0, size, &i) ||
+		!voxelset3D_cell(point->y, 0.0, size, &j) ||
+		!voxelset3D_cell(point->z, 0.0, size, &k))
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("The point is out of the range of the voxel grid")));
+	PG_RETURN_INT64((int64) sfc3D_encode(hilbert,
+		(uint32) (i + VOXELSET3D_OFFSET), (uint32) (j + VOXELSET3D_OFFSET),
+		(uint32) (k + VOXELSET3D_OFFSET)));
+}
+
+/*
+ * morton3D_key: Morton code of the voxel of the point
+ */
+Datum
+morton3D_key(PG_FUNCTION_ARGS)
+{
+	return sfc3D_key_internal(fcinfo, false);
+}
+
+PG_FUNCTION_INFO_V1(morton3D_key);
+
+/*
+ * hilbert3D_key: Hilbert code of the voxel of the point
+ */
+Datum
+hilbert3D_key(PG_FUNCTION_ARGS)
+{
+	return sfc3D_key_internal(fcinfo, true);
+}
+
+PG_FUNCTION_INFO_V1(hilbert3D_key);
+
+/*
+ * Return as rows of their low and high keys at most the number of ranges
+ * in argument 2 covering the keys of the voxels intersecting the box in
+ * argument 0 in the grid of the size in argument 1
+ */
+static Datum
+sfc3D_ranges_internal(FunctionCallInfo fcinfo, bool hilbert)
+{
+	FuncCallContext *funcctx;
+	uint64	   *ranges;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		TupleDesc	tupdesc;
+		Box3D	   *box = PG_GETARG_BOX3D_P(0);
+		double		size = PG_GETARG_FLOAT8(1);
+		int32		maxranges = PG_GETARG_INT32(2);
+		uint32		lo[3],
+					hi[3];
+
+		sfc3D_check_size(size);
+		if (maxranges < 1)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("The maximum number of ranges must be positive")));
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+		if (get_call_result_type(fcinfo, NULL, &tupdesc) != TYPEFUNC_COMPOSITE)
+			elog(ERROR, "return type must be a row type");
+		funcctx->tuple_desc = BlessTupleDesc(tupdesc);
+		if (sfc3D_box_cells(box, size, lo, hi))
+			funcctx->max_calls = sfc3D_ranges(hilbert, lo, hi, maxranges,
+				&ranges);
+		else
+		{
+			funcctx->max_calls = 0;
+			ranges = NULL;
+		}
+		funcctx->user_fctx = ranges;
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	ranges = (uint64 *) funcctx->user_fctx;
+
+	if (funcctx->call_cntr < funcctx->max_calls)
+	{
+		uint64		n = funcctx->call_cntr;
+		Datum		values[2];
+		bool		nulls[2] = {false, false};
+		HeapTuple	tuple;
+
+		values[0] = Int64GetDatum((int64) ranges[2 * n]);
+		values[1] = Int64GetDatum((int64) ranges[2 * n + 1]);
+		tuple = heap_form_tuple(funcctx->tuple_desc, values, nulls);
+		SRF_RETURN_NEXT(funcctx, HeapTupleGetDatum(tuple));
+	}
+
+	SRF_RETURN_DONE(funcctx);
+}
+
+/*
+ * morton3D_ranges: Ranges of Morton keys covering the voxels intersecting
+ * the box
+ */
+Datum
+morton3D_ranges(PG_FUNCTION_ARGS)
+{
+	return sfc3D_ranges_internal(fcinfo, false);
+}
+
+PG_FUNCTION_INFO_V1(morton3D_ranges);
+
+/*
+ * hilbert3D_ranges: Ranges of Hilbert keys covering the voxels intersecting
+ * the box
+ */
+Datum
+hilbert3D_ranges(PG_FUNCTION_ARGS)
+{
+	return sfc3D_ranges_internal(fcinfo, true);
+}
+
+PG_FUNCTION_INFO_V1(hilbert3D_ranges);
+
+/*
+ * Is the voxel of the key in argument 0 among the voxels intersecting the
+ * box in argument 1 in the grid of the size in argument 2
+ */
+static Datum
+sfc3D_within_internal(FunctionCallInfo fcinfo, bool hilbert)
+{
+	int64		key = PG_GETARG_INT64(0);
+	Box3D	   *box = PG_GETARG_BOX3D_P(1);
+	double		size = PG_GETARG_FLOAT8(2);
+	uint32		lo[3],
+				hi[3],
+				x,
+				y,
+				z;
+
+	sfc3D_check_size(size);
+	if (key < 0 || !sfc3D_box_cells(box, size, lo, hi))
+		PG_RETURN_BOOL(false);
+	if (hilbert)
+		hilbert3D_decode((uint64) key, &x, &y, &z);
+	else
+		morton3D_decode((uint64) key, &x, &y, &z);
+	PG_RETURN_BOOL(x >= lo[0] && x <= hi[0] && y >= lo[1] && y <= hi[1] &&
+		z >= lo[2] && z <= hi[2]);
+}
+
+/*
+ * morton3D_within: Is the voxel of the Morton key in the box
+ */
+Datum
+morton3D_within(PG_FUNCTION_ARGS)
+{
+	return sfc3D_within_internal(fcinfo, false);
+}
+
+PG_FUNCTION_INFO_V1(morton3D_within);
+
+/*
+ * hilbert3D_within: Is the voxel of the Hilbert key in the box
+ */
+Datum
+hilbert3D_within(PG_FUNCTION_ARGS)
+{
+	return sfc3D_within_internal(fcinfo, true);
+}
+
+PG_FUNCTION_INFO_V1(hilbert3D_within);
+
+/*****************************************************************************
+ * Octree cells
+ *****************************************************************************/
+
+/* Relative position of a cell and a geometry covered by octcells3D */
+#define OCTCELL3D_OUTSIDE	0
+#define OCTCELL3D_PARTIAL	1
+#define OCTCELL3D_INSIDE	2
+
+Oid OCTCELL3D_OID = InvalidOid ;
+
+Oid octcell3d_oid()
+{
+	if (OCTCELL3D_OID == InvalidOid)
+		OCTCELL3D_OID = TypenameGetTypid("octcell3d") ;
+	return OCTCELL3D_OID ;
+}
+
+/* Is the integer the identifier of a cell */
+static inline bool
+octcell3D_id_valid(uint64 id)
+{
+	return id != 0 &&
+		octcell3D_lsb(id) == octcell3D_lsb_for_level(octcell3D_id_level(id));
+}
+
+/* Identifier of the cell of the level whose low voxel has the cell numbers */
+static inline uint64
+octcell3D_make(uint32 x, uint32 y, uint32 z, int level)
+{
+	uint64		lsb = octcell3D_lsb_for_level(level);
+
+	return ((morton3D_encode(x, y, z) & ~(lsb - 1)) << 1) | lsb;
+}
+
+/*
+ * Cell numbers, offset by VOXELSET3D_OFFSET, of the low voxel of the cell
+ * and number of voxels along its edges
+ */
+static inline uint32
+octcell3D_cells(uint64 id, uint32 *x, uint32 *y, uint32 *z)
+{
+	uint64		lsb = octcell3D_lsb(id);
+
+	morton3D_decode((id & ~lsb) >> 1, x, y, z);
+	return (uint32) 1 << (OCTCELL3D_MAXLEVEL - octcell3D_id_level(id));
+}
+
+/* Box of the cell in the grid of voxels of the size */
+static void
+octcell3D_box(uint64 id, double size, Box3D *box)
+{
+	uint32		x,
+				y,
+				z,
+				n = octcell3D_cells(id, &x, &y, &z);
+
+	box->low.x = ((double) x - VOXELSET3D_OFFSET) * size;
+	box->low.y = ((double) y - VOXELSET3D_OFFSET) * size;
+	box->low.z = ((double) z - VOXELSET3D_OFFSET) * size;
+	box->high.x = box->low.x + n * size;
+	box->high.y = box->low.y + n * size;
+	box->high.z = box->low.z + n * size;
+}
+
+static void
+octcell3D_check_level(int32 level)
+{
+	if (level < 0 || level > OCTCELL3D_MAXLEVEL)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("The level of an OctCell3D must be between 0 and %d",
+					OCTCELL3D_MAXLEVEL)));
+}
+
+static void
+octcell3D_syntax_error(char *str)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+			 errmsg("Invalid input syntax for type OctCell3D: \"%s\"", str)));
+}
+
+/*
+ * octcell3D_in: Convert a string to internal OctCell3D representation
+ *
+ * Input format:
+ *		"l:(i,j,k)"
+ *
+ * where l is the level of the cell and i, j, and k are its cell numbers
+ * at this level, which are those of a VoxelCell3D at the maximum level.
+ */
+Datum
+octcell3D_in(PG_FUNCTION_ARGS)
+{
+	char	   *str = PG_GETARG_CSTRING(0);
+	char	   *s = str;
+	char	   *end;
+	long		level;
+	double		c[3];
+	int32		shift,
+				offset,
+				n;
+	OctCell3D  *result;
+
+	s = voxelset3D_skip_spaces(s);
+	errno = 0;
+	level = strtol(s, &end, 10);
+	if (end == s || errno != 0)
+		octcell3D_syntax_error(str);
+	s = voxelset3D_skip_spaces(end);
+	if (*s++ != ':')
+		octcell3D_syntax_error(str);
+	s = voxelset3D_skip_spaces(s);
+	if (!triple_decode(s, &c[0], &c[1], &c[2], &s))
+		octcell3D_syntax_error(str);
+	s = voxelset3D_skip_spaces(s);
+	if (*s != '\0')
+		octcell3D_syntax_error(str);
+	if (level < 0 || level > OCTCELL3D_MAXLEVEL)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+				 errmsg("Invalid OctCell3D: the level must be between 0 and %d",
+					OCTCELL3D_MAXLEVEL)));
+	shift = OCTCELL3D_MAXLEVEL - (int32) level;
+	offset = VOXELSET3D_OFFSET >> shift;
+	for (n = 0; n < 3; n++)
+	{
+		if (c[n] != floor(c[n]) || c[n] < -offset ||
+			c[n] >= ((1 << OCTCELL3D_MAXLEVEL) >> shift) - offset)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_TEXT_REPRESENTATION),
+					 errmsg("Invalid OctCell3D: cell numbers must be integers between %d and %d at level %ld",
+						-offset, ((1 << OCTCELL3D_MAXLEVEL) >> shift) - offset - 1,
+						level)));
+	}
+
+	result = (OctCell3D *) palloc(sizeof(OctCell3D));
+	result->id = octcell3D_make((uint32) ((int32) c[0] + offset) << shift,
+		(uint32) ((int32) c[1] + offset) << shift,
+		(uint32) ((int32) c[2] + offset) << shift, (int) level);
+	PG_RETURN_OCTCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_in);
+
+/* Level and cell numbers at this level of the cell */
+static int
+octcell3D_numbers(uint64 id, int32 *i, int32 *j, int32 *k)
+{
+	int			level = octcell3D_id_level(id);
+	int			shift = OCTCELL3D_MAXLEVEL - level;
+	int32		offset = VOXELSET3D_OFFSET >> shift;
+	uint32		x,
+				y,
+				z;
+
+	octcell3D_cells(id, &x, &y, &z);
+	*i = (int32) (x >> shift) - offset;
+	*j = (int32) (y >> shift) - offset;
+	*k = (int32) (z >> shift) - offset;
+	return level;
+}
+
+/*
+ * octcell3D_out: Convert internal OctCell3D representation to character
+ * string
+ *
+ * Output format:
+ *		"l:(i,j,k)"
+ */
+Datum
+octcell3D_out(PG_FUNCTION_ARGS)
+{
+	OctCell3D  *cell = PG_GETARG_OCTCELL3D_P(0);
+	int32		i,
+				j,
+				k;
+	int			level = octcell3D_numbers(cell->id, &i, &j, &k);
+
+	PG_RETURN_CSTRING(psprintf("%d:(%d,%d,%d)", level, i, j, k));
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_out);
+
+/*
+ * octcell3D_recv: Convert external binary representation to OctCell3D
+ *
+ * External representation is the int8 identifier of the cell.
+ */
+Datum
+octcell3D_recv(PG_FUNCTION_ARGS)
+{
+	StringInfo	buf = (StringInfo) PG_GETARG_POINTER(0);
+	OctCell3D  *result = (OctCell3D *) palloc(sizeof(OctCell3D));
+
+	result->id = (uint64) pq_getmsgint64(buf);
+	if (!octcell3D_id_valid(result->id))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("Invalid identifier in external \"OctCell3D\" value")));
+	PG_RETURN_OCTCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_recv);
+
+/*
+ * octcell3D_send: Convert OctCell3D to binary representation
+ */
+Datum
+octcell3D_send(PG_FUNCTION_ARGS)
+{
+	OctCell3D  *cell = PG_GETARG_OCTCELL3D_P(0);
+	StringInfoData buf;
+
+	pq_begintypsend(&buf);
+	pq_sendint64(&buf, (int64) cell->id);
+	PG_RETURN_BYTEA_P(pq_endtypsend(&buf));
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_send);
+
+/*
+ * octcell3D_point3D: Cell of the level in argument 2 containing the point
+ * in the grid of voxels of the size in argument 1
+ */
+Datum
+octcell3D_point3D(PG_FUNCTION_ARGS)
+{
+	Point3D    *point = PG_GETARG_POINT3D_P(0);
+	double		size = PG_GETARG_FLOAT8(1);
+	int32		level = PG_GETARG_INT32(2);
+	Point3D		origin = {0.0, 0.0, 0.0};
+	OctCell3D  *result = (OctCell3D *) palloc(sizeof(OctCell3D));
+	int32		i,
+				j,
+				k;
+
+	voxelset3D_check_grid(size, &origin);
+	octcell3D_check_level(level);
+	if (!voxelset3D_cell(point->x, 0.0, size, &i) ||
+		!voxelset3D_cell(point->y, 0.0, size, &j) ||
+		!voxelset3D_cell(point->z, 0.0, size, &k))
+		ereport(ERROR,
+				(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+				 errmsg("The point is out of the range of the voxel grid")));
+	result->id = octcell3D_make((uint32) (i + VOXELSET3D_OFFSET),
+		(uint32) (j + VOXELSET3D_OFFSET), (uint32) (k + VOXELSET3D_OFFSET),
+		level);
+	PG_RETURN_OCTCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_point3D);
+
+/*
+ * octcell3D_voxelcell3D: Cell of the maximum level of the voxel
+ */
+Datum
+octcell3D_voxelcell3D(PG_FUNCTION_ARGS)
+{
+	VoxelCell3D *cell = PG_GETARG_VOXELCELL3D_P(0);
+	OctCell3D  *result = (OctCell3D *) palloc(sizeof(OctCell3D));
+
+	result->id = (cell->key << 1) | 1;
+	PG_RETURN_OCTCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_voxelcell3D);
+
+/*
+ * octcell3D_from_id: Cell of the identifier
+ */
+Datum
+octcell3D_from_id(PG_FUNCTION_ARGS)
+{
+	uint64		id = (uint64) PG_GETARG_INT64(0);
+	OctCell3D  *result;
+
+	if (!octcell3D_id_valid(id))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("Invalid OctCell3D identifier: " INT64_FORMAT,
+					(int64) id)));
+	result = (OctCell3D *) palloc(sizeof(OctCell3D));
+	result->id = id;
+	PG_RETURN_OCTCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_from_id);
+
+/*
+ * octcell3D_id: Identifier of the cell as an int8. The identifiers of the
+ * cells of the upper half of the grid along z, which are at least 2^63,
+ * are thus negative.
+ */
+Datum
+octcell3D_id(PG_FUNCTION_ARGS)
+{
+	OctCell3D  *cell = PG_GETARG_OCTCELL3D_P(0);
+
+	PG_RETURN_INT64((int64) cell->id);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_id);
+
+/*
+ * octcell3D_level: Level of the cell
+ */
+Datum
+octcell3D_level(PG_FUNCTION_ARGS)
+{
+	OctCell3D  *cell = PG_GETARG_OCTCELL3D_P(0);
+
+	PG_RETURN_INT32(octcell3D_id_level(cell->id));
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_level);
+
+/*
+ * octcell3D_voxel: Box of the cell in the grid of voxels of the size in
+ * argument 1
+ */
+Datum
+octcell3D_voxel(PG_FUNCTION_ARGS)
+{
+	OctCell3D  *cell = PG_GETARG_OCTCELL3D_P(0);
+	double		size = PG_GETARG_FLOAT8(1);
+	Point3D		origin = {0.0, 0.0, 0.0};
+	Box3D	   *result = (Box3D *) palloc(sizeof(Box3D));
+
+	voxelset3D_check_grid(size, &origin);
+	octcell3D_box(cell->id, size, result);
+	PG_RETURN_BOX3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_voxel);
+
+/*
+ * octcell3D_parent: Ancestor of the cell at the level in argument 1, which
+ * defaults to the level of the cell minus one
+ */
+Datum
+octcell3D_parent(PG_FUNCTION_ARGS)
+{
+	OctCell3D  *cell = PG_GETARG_OCTCELL3D_P(0);
+	int			level = octcell3D_id_level(cell->id);
+	int32		parent = (PG_NARGS() > 1) ? PG_GETARG_INT32(1) : level - 1;
+	OctCell3D  *result;
+
+	if (parent < 0 || parent > level)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+				 errmsg("The level of the parent must be between 0 and the level %d of the cell",
+					level)));
+	result = (OctCell3D *) palloc(sizeof(OctCell3D));
+	result->id = octcell3D_id_parent(cell->id, parent);
+	PG_RETURN_OCTCELL3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_parent);
+
+/*
+ * Next of the identifiers computed in the first call of a set-returning
+ * function, returned as a cell
+ */
+static Datum
+octcells3D_next(FuncCallContext *funcctx)
+{
+	uint64	   *ids = (uint64 *) funcctx->user_fctx;
+	OctCell3D  *cell = (OctCell3D *) palloc(sizeof(OctCell3D));
+
+	cell->id = ids[funcctx->call_cntr];
+	return OctCell3DPGetDatum(cell);
+}
+
+/*
+ * octcell3D_children: Cells of the next level in the cell, in their order
+ */
+Datum
+octcell3D_children(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		uint64		id = PG_GETARG_OCTCELL3D_P(0)->id;
+		uint64		lsb = octcell3D_lsb(id);
+		uint64	   *ids;
+		int			n;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+		ids = (uint64 *) palloc(sizeof(uint64) * 8);
+		funcctx->max_calls = 0;
+		if (octcell3D_id_level(id) < OCTCELL3D_MAXLEVEL)
+		{
+			for (n = 0; n < 8; n++)
+				ids[n] = id - lsb + (lsb >> 3) + n * (lsb >> 2);
+			funcctx->max_calls = 8;
+		}
+		funcctx->user_fctx = ids;
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	if (funcctx->call_cntr < funcctx->max_calls)
+		SRF_RETURN_NEXT(funcctx, octcells3D_next(funcctx));
+	SRF_RETURN_DONE(funcctx);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_children);
+
+/*
+ * octcell3D_neighbours: Cells of the same level that share a face, an edge,
+ * or a vertex with the cell, at most 26 of them at the boundary of the grid
+ */
+Datum
+octcell3D_neighbours(PG_FUNCTION_ARGS)
+{
+	FuncCallContext *funcctx;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		uint64		id = PG_GETARG_OCTCELL3D_P(0)->id;
+		int			level = octcell3D_id_level(id);
+		uint32		x,
+					y,
+					z,
+					side = octcell3D_cells(id, &x, &y, &z);
+		int64		limit = (int64) 1 << OCTCELL3D_MAXLEVEL;
+		uint64	   *ids;
+		int			n = 0,
+					dx,
+					dy,
+					dz;
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+		ids = (uint64 *) palloc(sizeof(uint64) * 26);
+		for (dz = -1; dz <= 1; dz++)
+		{
+			for (dy = -1; dy <= 1; dy++)
+			{
+				for (dx = -1; dx <= 1; dx++)
+				{
+					int64		nx = (int64) x + dx * (int64) side,
+								ny = (int64) y + dy * (int64) side,
+								nz = (int64) z + dz * (int64) side;
+
+					if ((dx == 0 && dy == 0 && dz == 0) ||
+						nx < 0 || nx >= limit || ny < 0 || ny >= limit ||
+						nz < 0 || nz >= limit)
+						continue;
+					ids[n++] = octcell3D_make((uint32) nx, (uint32) ny,
+						(uint32) nz, level);
+				}
+			}
+		}
+		funcctx->max_calls = n;
+		funcctx->user_fctx = ids;
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	if (funcctx->call_cntr < funcctx->max_calls)
+		SRF_RETURN_NEXT(funcctx, octcells3D_next(funcctx));
+	SRF_RETURN_DONE(funcctx);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_neighbours);
+
+/*
+ * Relative position of the cell of the box and the geometry
+ */
+static int
+octcells3D_classify(Box3D *cell, Oid type, void *geom)
+{
+	if (type == box3d_oid())
+	{
+		Box3D	   *box = (Box3D *) geom;
+
+		/* The cells contain their low faces but not their high ones */
+		if (cell->high.x <= box->low.x || cell->low.x > box->high.x ||
+			cell->high.y <= box->low.y || cell->low.y > box->high.y ||
+			cell->high.z <= box->low.z || cell->low.z > box->high.z)
+			return OCTCELL3D_OUTSIDE;
+		if (box->low.x <= cell->low.x && cell->high.x <= box->high.x &&
+			box->low.y <= cell->low.y && cell->high.y <= box->high.y &&
+			box->low.z <= cell->low.z && cell->high.z <= box->high.z)
+			return OCTCELL3D_INSIDE;
+		return OCTCELL3D_PARTIAL;
+	}
+	else if (type == poly3d_oid())
+	{
+		Polygon3D  *poly = (Polygon3D *) geom;
+
+		/* A polygon is planar and thus never contains a cell */
+		if (cell->high.x <= poly->boundbox.low.x ||
+			cell->low.x > poly->boundbox.high.x ||
+			cell->high.y <= poly->boundbox.low.y ||
+			cell->low.y > poly->boundbox.high.y ||
+			cell->high.z <= poly->boundbox.low.z ||
+			cell->low.z > poly->boundbox.high.z ||
+			!overlap_box3D_poly3D_internal(cell, poly))
+			return OCTCELL3D_OUTSIDE;
+		return OCTCELL3D_PARTIAL;
+	}
+	else if (type == path3d_oid())
+	{
+		Path3D	   *path = (Path3D *) geom;
+
+		if (cell->high.x <= path->boundbox.low.x ||
+			cell->low.x > path->boundbox.high.x ||
+			cell->high.y <= path->boundbox.low.y ||
+			cell->low.y > path->boundbox.high.y ||
+			cell->high.z <= path->boundbox.low.z ||
+			cell->low.z > path->boundbox.high.z ||
+			!inter_box3D_path3D(cell, path))
+			return OCTCELL3D_OUTSIDE;
+		return OCTCELL3D_PARTIAL;
+	}
+	else
+	{
+		Sphere	   *sphere = (Sphere *) geom;
+		double		near = 0.0,
+					far = 0.0,
+					c[3],
+					l[3],
+					h[3],
+					r2 = sphere->radius * sphere->radius;
+		int			i;
+
+		c[0] = sphere->center.x;
+		c[1] = sphere->center.y;
+		c[2] = sphere->center.z;
+		l[0] = cell->low.x;
+		l[1] = cell->low.y;
+		l[2] = cell->low.z;
+		h[0] = cell->high.x;
+		h[1] = cell->high.y;
+		h[2] = cell->high.z;
+		for (i = 0; i < 3; i++)
+		{
+			double		d = (c[i] < l[i]) ? l[i] - c[i] :
+							(c[i] > h[i]) ? c[i] - h[i] : 0.0,
+						e = Max(fabs(c[i] - l[i]), fabs(c[i] - h[i]));
+
+			near += d * d;
+			far += e * e;
+		}
+		if (near > r2)
+			return OCTCELL3D_OUTSIDE;
+		if (far <= r2)
+			return OCTCELL3D_INSIDE;
+		return OCTCELL3D_PARTIAL;
+	}
+}
+
+/*
+ * Relative position of the cell and the geometry, a cell outside the
+ * geometry but within the margin of it being considered as crossing its
+ * boundary
+ */
+static int
+octcells3D_classify_margin(uint64 id, double size, double margin, Oid type,
+	void *geom)
+{
+	Box3D		box;
+	int			result;
+
+	octcell3D_box(id, size, &box);
+	result = octcells3D_classify(&box, type, geom);
+	if (result == OCTCELL3D_OUTSIDE && margin > 0.0)
+	{
+		box.low.x -= margin;
+		box.low.y -= margin;
+		box.low.z -= margin;
+		box.high.x += margin;
+		box.high.y += margin;
+		box.high.z += margin;
+		if (octcells3D_classify(&box, type, geom) != OCTCELL3D_OUTSIDE)
+			result = OCTCELL3D_PARTIAL;
+	}
+	return result;
+}
+
+/*
+ * Cover the geometry with at most maxcells cells of level at most maxlevel.
+ * The octree is descended level by level from its root, the cells inside
+ * the geometry being kept and those crossing its boundary being split,
+ * as long as the cells of the next level do not exceed maxcells. Since a
+ * cell is split only if it is not inside the geometry, no eight cells of
+ * the result are the children of a cell, and the cover is the smallest
+ * for its cells at the levels reached.
+ *
+ * The cover includes the cells within the margin of the geometry. If
+ * markinside is true, which requires maxlevel to be below
+ * OCTCELL3D_MAXLEVEL so that the lowest bit of the identifiers is free,
+ * the identifiers of the cells inside the geometry have this bit set.
+ */
+uint64 *
+octcells3D_cover(Oid type, void *geom, double size, int maxlevel,
+	int maxcells, double margin, bool markinside, int *ncells)
+{
+	uint64	   *result = (uint64 *) palloc(sizeof(uint64) * maxcells);
+	uint64	   *partial = (uint64 *) palloc(sizeof(uint64));
+	uint64	   *children;
+	int			nresult = 0,
+				npartial = 0,
+				level = 0,
+				i,
+				n;
+
+	Assert(!markinside || maxlevel < OCTCELL3D_MAXLEVEL);
+	partial[0] = octcell3D_lsb_for_level(0);
+	switch (octcells3D_classify_margin(partial[0], size, margin, type, geom))
+	{
+		case OCTCELL3D_INSIDE:
+			result[nresult++] = partial[0] | (markinside ? 1 : 0);
+			break;
+		case OCTCELL3D_PARTIAL:
+			npartial = 1;
+			break;
+	}
+
+	while (level < maxlevel && npartial > 0)
+	{
+		int			ninside = 0,
+					nchildren = 0;
+
+		/* Classify the children, those inside first, then the others */
+		children = (uint64 *) palloc(sizeof(uint64) * 8 * npartial * 2);
+		for (i = 0; i < npartial; i++)
+		{
+			uint64		lsb = octcell3D_lsb(partial[i]);
+
+			for (n = 0; n < 8; n++)
+			{
+				uint64		child = partial[i] - lsb + (lsb >> 3) + n * (lsb >> 2);
+
+				switch (octcells3D_classify_margin(child, size, margin, type,
+						geom))
+				{
+					case OCTCELL3D_INSIDE:
+						children[ninside++] = child | (markinside ? 1 : 0);
+						break;
+					case OCTCELL3D_PARTIAL:
+						children[8 * npartial + nchildren++] = child;
+						break;
+				}
+			}
+		}
+		if (nresult + ninside + nchildren > maxcells)
+		{
+			pfree(children);
+			break;
+		}
+		memcpy(&result[nresult], children, sizeof(uint64) * ninside);
+		nresult += ninside;
+		pfree(partial);
+		partial = (uint64 *) palloc(sizeof(uint64) * Max(nchildren, 1));
+		memcpy(partial, &children[8 * npartial], sizeof(uint64) * nchildren);
+		npartial = nchildren;
+		pfree(children);
+		level++;
+	}
+	/* The cells that were not split cover the boundary of the geometry */
+	memcpy(&result[nresult], partial, sizeof(uint64) * npartial);
+	nresult += npartial;
+	pfree(partial);
+
+	qsort(result, nresult, sizeof(uint64), sfc3D_range_cmp);
+	*ncells = nresult;
+	return result;
+}
+
+/*
+ * Return the cells covering the geometry in argument 0 in the grid of
+ * voxels of the size in argument 1, of level at most the one in argument 2
+ * and at most as many as in argument 3
+ */
+static Datum
+octcells3D_internal(FunctionCallInfo fcinfo, Oid type)
+{
+	FuncCallContext *funcctx;
+
+	if (SRF_IS_FIRSTCALL())
+	{
+		MemoryContext oldcontext;
+		double		size = PG_GETARG_FLOAT8(1);
+		int32		maxlevel = PG_GETARG_INT32(2);
+		int32		maxcells = PG_GETARG_INT32(3);
+		Point3D		origin = {0.0, 0.0, 0.0};
+		void	   *geom;
+		int			ncells;
+
+		voxelset3D_check_grid(size, &origin);
+		octcell3D_check_level(maxlevel);
+		if (maxcells < 8)
+			ereport(ERROR,
+					(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+					 errmsg("The maximum number of cells must be at least 8")));
+
+		funcctx = SRF_FIRSTCALL_INIT();
+		oldcontext = MemoryContextSwitchTo(funcctx->multi_call_memory_ctx);
+		if (type == poly3d_oid())
+			geom = PG_GETARG_POLYGON3D_P(0);
+		else
+			geom = PG_GETARG_POINTER(0);
+		funcctx->user_fctx = octcells3D_cover(type, geom, size, maxlevel,
+			maxcells, 0.0, false, &ncells);
+		funcctx->max_calls = ncells;
+		MemoryContextSwitchTo(oldcontext);
+	}
+
+	funcctx = SRF_PERCALL_SETUP();
+	if (funcctx->call_cntr < funcctx->max_calls)
+		SRF_RETURN_NEXT(funcctx, octcells3D_next(funcctx));
+	SRF_RETURN_DONE(funcctx);
+}
+
+/*
+ * octcells3D_box3D: Cells covering the box
+ */
+Datum
+octcells3D_box3D(PG_FUNCTION_ARGS)
+{
+	return octcells3D_internal(fcinfo, box3d_oid());
+}
+
+PG_FUNCTION_INFO_V1(octcells3D_box3D);
+
+/*
+ * octcells3D_sphere: Cells covering the sphere
+ */
+Datum
+octcells3D_sphere(PG_FUNCTION_ARGS)
+{
+	return octcells3D_internal(fcinfo, InvalidOid);
+}
+
+PG_FUNCTION_INFO_V1(octcells3D_sphere);
+
+/*
+ * octcells3D_poly3D: Cells covering the polygon
+ */
+Datum
+octcells3D_poly3D(PG_FUNCTION_ARGS)
+{
+	return octcells3D_internal(fcinfo, poly3d_oid());
+}
+
+PG_FUNCTION_INFO_V1(octcells3D_poly3D);
+
+/*
+ * octcell3D_contains: Does the first cell contain the second one, that is,
+ * is the second cell the first one or one of its descendants
+ */
+Datum
+octcell3D_contains(PG_FUNCTION_ARGS)
+{
+	uint64		id1 = PG_GETARG_OCTCELL3D_P(0)->id,
+				id2 = PG_GETARG_OCTCELL3D_P(1)->id;
+
+	PG_RETURN_BOOL(octcell3D_range_min(id1) <= id2 &&
+		id2 <= octcell3D_range_max(id1));
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_contains);
+
+/*
+ * octcell3D_contained: Is the first cell contained in the second one
+ */
+Datum
+octcell3D_contained(PG_FUNCTION_ARGS)
+{
+	uint64		id1 = PG_GETARG_OCTCELL3D_P(0)->id,
+				id2 = PG_GETARG_OCTCELL3D_P(1)->id;
+
+	PG_RETURN_BOOL(octcell3D_range_min(id2) <= id1 &&
+		id1 <= octcell3D_range_max(id2));
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_contained);
+
+/*
+ * Comparison of octree cells, in the order of their identifiers, in which
+ * the descendants of a cell follow each other around it
+ */
+static inline int
+octcell3D_cmp_internal(OctCell3D *a, OctCell3D *b)
+{
+	return (a->id < b->id) ? -1 : (a->id > b->id) ? 1 : 0;
+}
+
+Datum
+octcell3D_lt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(octcell3D_cmp_internal(PG_GETARG_OCTCELL3D_P(0),
+		PG_GETARG_OCTCELL3D_P(1)) < 0);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_lt);
+
+Datum
+octcell3D_le(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(octcell3D_cmp_internal(PG_GETARG_OCTCELL3D_P(0),
+		PG_GETARG_OCTCELL3D_P(1)) <= 0);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_le);
+
+Datum
+octcell3D_eq(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(octcell3D_cmp_internal(PG_GETARG_OCTCELL3D_P(0),
+		PG_GETARG_OCTCELL3D_P(1)) == 0);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_eq);
+
+Datum
+octcell3D_ne(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(octcell3D_cmp_internal(PG_GETARG_OCTCELL3D_P(0),
+		PG_GETARG_OCTCELL3D_P(1)) != 0);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_ne);
+
+Datum
+octcell3D_ge(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(octcell3D_cmp_internal(PG_GETARG_OCTCELL3D_P(0),
+		PG_GETARG_OCTCELL3D_P(1)) >= 0);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_ge);
+
+Datum
+octcell3D_gt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(octcell3D_cmp_internal(PG_GETARG_OCTCELL3D_P(0),
+		PG_GETARG_OCTCELL3D_P(1)) > 0);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_gt);
+
+Datum
+octcell3D_cmp(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_INT32(octcell3D_cmp_internal(PG_GETARG_OCTCELL3D_P(0),
+		PG_GETARG_OCTCELL3D_P(1)));
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_cmp);
+
+/*
+ * octcell3D_hash: Hash of the identifier of the cell
+ */
+Datum
+octcell3D_hash(PG_FUNCTION_ARGS)
+{
+	OctCell3D  *cell = PG_GETARG_OCTCELL3D_P(0);
+
+	return hash_any((unsigned char *) &cell->id, sizeof(uint64));
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_hash);
+
+/*
+ * GIN support for containment. A cell is indexed by its identifier and by
+ * the identifiers of its ancestors shifted right by one bit, whose lowest
+ * bit is then at a position 3 * n + 2 that is never that of an identifier.
+ * A cell contains q if it is q or an ancestor of q, i.e., if one of the
+ * identifiers of q and its ancestors is a key of the cell, and it is
+ * contained in q if it is q or a descendant of q, i.e., if the identifier
+ * of q or the shifted one is a key of the cell. The answer is exact.
+ */
+Datum
+octcell3D_gin_extract_value(PG_FUNCTION_ARGS)
+{
+	uint64		id = PG_GETARG_OCTCELL3D_P(0)->id;
+	int32	   *nkeys = (int32 *) PG_GETARG_POINTER(1);
+	int			level = octcell3D_id_level(id),
+				l;
+	Datum	   *keys = (Datum *) palloc(sizeof(Datum) * (level + 1));
+
+	keys[0] = Int64GetDatum((int64) id);
+	for (l = 0; l < level; l++)
+		keys[l + 1] = Int64GetDatum((int64) (octcell3D_id_parent(id, l) >> 1));
+	*nkeys = level + 1;
+	PG_RETURN_POINTER(keys);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_gin_extract_value);
+
+Datum
+octcell3D_gin_extract_query(PG_FUNCTION_ARGS)
+{
+	uint64		id = PG_GETARG_OCTCELL3D_P(0)->id;
+	int32	   *nkeys = (int32 *) PG_GETARG_POINTER(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	int			level = octcell3D_id_level(id),
+				l;
+	Datum	   *keys = (Datum *) palloc(sizeof(Datum) * (level + 1));
+
+	switch (strategy)
+	{
+		case RTContainsStrategyNumber:
+			for (l = 0; l <= level; l++)
+				keys[l] = Int64GetDatum((int64) octcell3D_id_parent(id, l));
+			*nkeys = level + 1;
+			break;
+		case RTContainedByStrategyNumber:
+			keys[0] = Int64GetDatum((int64) id);
+			*nkeys = 1;
+			if (level < OCTCELL3D_MAXLEVEL)
+				keys[(*nkeys)++] = Int64GetDatum((int64) (id >> 1));
+			break;
+		default:
+			elog(ERROR, "unrecognized strategy number: %d", strategy);
+	}
+	PG_RETURN_POINTER(keys);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_gin_extract_query);
+
+Datum
+octcell3D_gin_consistent(PG_FUNCTION_ARGS)
+{
+	bool	   *check = (bool *) PG_GETARG_POINTER(0);
+	int32		nkeys = PG_GETARG_INT32(3);
+	bool	   *recheck = (bool *) PG_GETARG_POINTER(5);
+	int32		i;
+
+	*recheck = false;
+	for (i = 0; i < nkeys; i++)
+	{
+		if (check[i])
+			PG_RETURN_BOOL(true);
+	}
+	PG_RETURN_BOOL(false);
+}
+
+PG_FUNCTION_INFO_V1(octcell3D_gin_consistent);
+
+/*****************************************************************************
+ * Partition cells
+ *****************************************************************************/
+
+/*
+ * Cell number, offset by VOXELSET3D_OFFSET, of the coordinate in the grid
+ * of voxels of the size, clamped to the grid so that the geometries beyond
+ * its border are routed to the cells along it
+ */
+static inline uint32
+partitioncell3D_number(double coord, double size)
+{
+	double		c = floor(coord / size) + VOXELSET3D_OFFSET;
+
+	/* Written so that NaN is clamped to cell 0 */
+	if (!(c > 0.0))
+		return 0;
+	if (c > MORTON3D_MAXCELL)
+		return MORTON3D_MAXCELL;
+	return (uint32) c;
+}
+
+static void
+partitioncell3D_numbers(const Box3D *box, double size, uint32 *lo, uint32 *hi)
+{
+	lo[0] = partitioncell3D_number(box->low.x, size);
+	lo[1] = partitioncell3D_number(box->low.y, size);
+	lo[2] = partitioncell3D_number(box->low.z, size);
+	hi[0] = partitioncell3D_number(box->high.x, size);
+	hi[1] = partitioncell3D_number(box->high.y, size);
+	hi[2] = partitioncell3D_number(box->high.z, size);
+}
+
+/*
+ * Identifier of the smallest cell of level at most the given one in the
+ * grid of voxels of the size that contains the box, which is the partition
+ * key of the geometries whose bounding box it is
+ */
+uint64
+partitioncell3D_id(const Box3D *box, double size, int level)
+{
+	uint32		lo[3],
+				hi[3];
+	int			shift;
+
+	partitioncell3D_numbers(box, size, lo, hi);
+	for (; level > 0; level--)
+	{
+		shift = OCTCELL3D_MAXLEVEL - level;
+		if (lo[0] >> shift == hi[0] >> shift &&
+			lo[1] >> shift == hi[1] >> shift &&
+			lo[2] >> shift == hi[2] >> shift)
+			break;
+	}
+	return octcell3D_make(lo[0], lo[1], lo[2], level);
+}
+
+/*
+ * Partition keys of the geometries whose bounding box intersects the box
+ * up to EPSILON, i.e., the cells of the level intersecting it and their
+ * ancestors, in ascending order, or NULL if there are more than maxkeys
+ */
+uint64 *
+partitioncell3D_keys(const Box3D *box, double size, int level, int maxkeys,
+	int *nkeys)
+{
+	Box3D		window = *box;
+	uint32		lo[3],
+				hi[3],
+				x,
+				y,
+				z;
+	double		count = 0.0;
+	uint64	   *result;
+	int			l,
+				shift,
+				n = 0;
+
+	window.low.x -= EPSILON;
+	window.low.y -= EPSILON;
+	window.low.z -= EPSILON;
+	window.high.x += EPSILON;
+	window.high.y += EPSILON;
+	window.high.z += EPSILON;
+	partitioncell3D_numbers(&window, size, lo, hi);
+	for (l = 0; l <= level; l++)
+	{
+		shift = OCTCELL3D_MAXLEVEL - l;
+		count += ((double) (hi[0] >> shift) - (lo[0] >> shift) + 1) *
+			((double) (hi[1] >> shift) - (lo[1] >> shift) + 1) *
+			((double) (hi[2] >> shift) - (lo[2] >> shift) + 1);
+	}
+	if (count > maxkeys)
+		return NULL;
+
+	result = (uint64 *) palloc(sizeof(uint64) * (int) count);
+	for (l = 0; l <= level; l++)
+	{
+		shift = OCTCELL3D_MAXLEVEL - l;
+		for (x = lo[0] >> shift; x <= hi[0] >> shift; x++)
+			for (y = lo[1] >> shift; y <= hi[1] >> shift; y++)
+				for (z = lo[2] >> shift; z <= hi[2] >> shift; z++)
+					result[n++] = octcell3D_make(x << shift, y << shift,
+						z << shift, l);
+	}
+	qsort(result, n, sizeof(uint64), sfc3D_range_cmp);
+	*nkeys = n;
+	return result;
+}
+
+/*
+ * Return the partition key of the geometry with the bounding box in the
+ * grid of voxels of the size in argument 1 at the level in argument 2
+ */
+static Datum
+partitioncell3D_internal(FunctionCallInfo fcinfo, Box3D *box)
+{
+	double		size = PG_GETARG_FLOAT8(1);
+	int32		level = PG_GETARG_INT32(2);
+	Point3D		origin = {0.0, 0.0, 0.0};
+
+	voxelset3D_check_grid(size, &origin);
+	octcell3D_check_level(level);
+	PG_RETURN_INT64((int64) partitioncell3D_id(box, size, level));
+}
+
+/*
+ * partitioncell3D_point3D: Partition key of the point
+ */
+Datum
+partitioncell3D_point3D(PG_FUNCTION_ARGS)
+{
+	return partitioncell3D_internal(fcinfo,
+		point3D_bbox(PG_GETARG_POINT3D_P(0)));
+}
+
+PG_FUNCTION_INFO_V1(partitioncell3D_point3D);
+
+/*
+ * partitioncell3D_lseg3D: Partition key of the segment
+ */
+Datum
+partitioncell3D_lseg3D(PG_FUNCTION_ARGS)
+{
+	return partitioncell3D_internal(fcinfo,
+		lseg3D_bbox(PG_GETARG_LSEG3D_P(0)));
+}
+
+PG_FUNCTION_INFO_V1(partitioncell3D_lseg3D);
+
+/*
+ * partitioncell3D_box3D: Partition key of the box
+ */
+Datum
+partitioncell3D_box3D(PG_FUNCTION_ARGS)
+{
+	return partitioncell3D_internal(fcinfo, PG_GETARG_BOX3D_P(0));
+}
+
+PG_FUNCTION_INFO_V1(partitioncell3D_box3D);
+
+/*
+ * partitioncell3D_path3D: Partition key of the path
+ */
+Datum
+partitioncell3D_path3D(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+
+	return partitioncell3D_internal(fcinfo, &path->boundbox);
+}
+
+PG_FUNCTION_INFO_V1(partitioncell3D_path3D);
+
+/*
+ * partitioncell3D_poly3D: Partition key of the polygon
+ */
+Datum
+partitioncell3D_poly3D(PG_FUNCTION_ARGS)
+{
+	return partitioncell3D_internal(fcinfo,
+		poly3D_bbox(PG_GETARG_POLYGON3D_P(0)));
+}
+
+PG_FUNCTION_INFO_V1(partitioncell3D_poly3D);
+
+/*
+ * partitioncell3D_sphere: Partition key of the sphere
+ */
+Datum
+partitioncell3D_sphere(PG_FUNCTION_ARGS)
+{
+	return partitioncell3D_internal(fcinfo,
+		sphere_bbox(PG_GETARG_SPHERE_P(0)));
+}
+
+PG_FUNCTION_INFO_V1(partitioncell3D_sphere);
+
+/*
+ * partitioncell3D_pointpatch3D: Partition key of the patch
+ */
+Datum
+partitioncell3D_pointpatch3D(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = DatumGetPointPatch3DPHeader(PG_GETARG_DATUM(0));
+
+	return partitioncell3D_internal(fcinfo, &patch->boundbox);
+}
+
+PG_FUNCTION_INFO_V1(partitioncell3D_pointpatch3D);
+
+/*
+ * partitioncells3D: Partition keys, in the grid of voxels of the size in
+ * argument 1 at the level in argument 2, of the geometries whose bounding
+ * box intersects the box in argument 0
+ */
+Datum
+partitioncells3D(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	double		size = PG_GETARG_FLOAT8(1);
+	int32		level = PG_GETARG_INT32(2);
+	Point3D		origin = {0.0, 0.0, 0.0};
+	Datum	   *keys;
+	uint64	   *ids;
+	int			nkeys,
+				i;
+
+	voxelset3D_check_grid(size, &origin);
+	octcell3D_check_level(level);
+	ids = partitioncell3D_keys(box, size, level, PARTITIONCELL3D_MAXKEYS,
+		&nkeys);
+	if (ids == NULL)
+		ereport(ERROR,
+				(errcode(ERRCODE_PROGRAM_LIMIT_EXCEEDED),
+				 errmsg("The box intersects more than %d partition cells",
+					PARTITIONCELL3D_MAXKEYS),
+				 errhint("Use a lower level.")));
+
+	keys = (Datum *) palloc(sizeof(Datum) * nkeys);
+	for (i = 0; i < nkeys; i++)
+		keys[i] = Int64GetDatum((int64) ids[i]);
+	PG_RETURN_ARRAYTYPE_P(construct_array(keys, nkeys, INT8OID,
+		sizeof(int64), FLOAT8PASSBYVAL, 'd'));
+}
+
+PG_FUNCTION_INFO_V1(partitioncells3D);
+
+/*****************************************************************************/
@@ -0,0 +1,643 @@
+/*****************************************************************************
+ *
+ * geo3D_wkb.c
+ *	  Well-Known Binary input and output for 3D geometries
+ *
+ * The 3D types are exchanged with PostGIS, GDAL and similar tools as ISO
+ * WKB, which PostGIS reads with ST_GeomFromWKB:
+ *	Point3D:					PointZ
+ *	Lseg3D, Line3D:				LineStringZ with the two points
+ *	Box3D:						MultiPointZ with the low and high corners
+ *	Path3D:						LineStringZ, where a closed path repeats its
+ *								first point at the end
+ *	Polygon3D:					PolygonZ with a single ring
+ *	Sphere:						PointZM with the radius as measure
+ *	PointPatch3D:				MultiPointZ
+ * The output is written in the byte order of the host so that the
+ * coordinates are copied as a block. The input accepts both byte orders as
+ * well as the extended WKB of PostGIS, whose SRID is ignored.
+ *
+ * Portions Copyright (c) 2017, Esteban Zimanyi, Université Libre de Bruxelles
+ * Portions Copyright (c) 1996-2017, PostgreSQL Global Development Group
+ * Portions Copyright (c) 1994, Regents of the University of California
+ *
+ *****************************************************************************/
+
+#include <postgres.h>
+
+#include <math.h>
+#include <limits.h>
+#include <float.h>
+
+#include <utils/builtins.h>
+#include "geo3D_decls.h"
+
+/* Byte order markers */
+#define WKB_XDR				0		/* big endian */
+#define WKB_NDR				1		/* little endian */
+
+#ifdef WORDS_BIGENDIAN
+#define WKB_NATIVE			WKB_XDR
+#else
+#define WKB_NATIVE			WKB_NDR
+#endif
+
+/* Geometry types */
+#define WKB_POINT			1
+#define WKB_LINESTRING		2
+#define WKB_POLYGON			3
+#define WKB_MULTIPOINT		4
+
+/* ISO dimension offsets and PostGIS extended WKB flags */
+#define WKB_ISO_Z			1000
+#define WKB_ISO_M			2000
+#define WKB_ISO_ZM			3000
+#define EWKB_Z_FLAG			0x80000000
+#define EWKB_M_FLAG			0x40000000
+#define EWKB_SRID_FLAG		0x20000000
+
+/* Sizes of the parts of a WKB value */
+#define WKB_HDRSZ			(1 + sizeof(uint32))
+#define WKB_POINTZ_SIZE		(WKB_HDRSZ + sizeof(Point3D))
+
+typedef struct
+{
+	const char *data;			/* next byte to read */
+	const char *end;
+	bool		swap;			/* byte order differs from the host */
+	const char *type_name;		/* for error messages */
+} WKBReader;
+
+/*****************************************************************************
+ * Reading WKB
+ *****************************************************************************/
+
+static void
+wkb_error(WKBReader *r, const char *msg)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+			 errmsg("Invalid WKB value for type %s: %s", r->type_name, msg)));
+}
+
+static void
+wkb_check_size(WKBReader *r, Size size)
+{
+	if ((Size) (r->end - r->data) < size)
+		wkb_error(r, "value is truncated");
+}
+
+static uint32
+wkb_read_uint32(WKBReader *r)
+{
+	uint32		result;
+
+	wkb_check_size(r, sizeof(uint32));
+	memcpy(&result, r->data, sizeof(uint32));
+	r->data += sizeof(uint32);
+	if (r->swap)
+		result = ((result & 0x000000ff) << 24) | ((result & 0x0000ff00) << 8) |
+			((result & 0x00ff0000) >> 8) | ((result & 0xff000000) >> 24);
+	return result;
+}
+
+/*
+ * Read npts points at r into points. The coordinates are copied as a block
+ * and byte-swapped afterwards if needed.
+ */
+static void
+wkb_read_points(WKBReader *r, Point3D *points, int npts)
+{
+	Size		size = sizeof(Point3D) * npts;
+
+	wkb_check_size(r, size);
+	memcpy(points, r->data, size);
+	r->data += size;
+	if (r->swap)
+	{
+		uint64	   *coords = (uint64 *) points;
+		int			i;
+
+		for (i = 0; i < 3 * npts; i++)
+			coords[i] = geo3D_bswap64(coords[i]);
+	}
+}
+
+static double
+wkb_read_double(WKBReader *r)
+{
+	uint64		result;
+	double		d;
+
+	wkb_check_size(r, sizeof(double));
+	memcpy(&result, r->data, sizeof(double));
+	r->data += sizeof(double);
+	if (r->swap)
+		result = geo3D_bswap64(result);
+	memcpy(&d, &result, sizeof(double));
+	return d;
+}
+
+/*
+ * Read the byte order and the type of a geometry at r and verify that it
+ * is the expected one. Both the ISO and the extended WKB type codes are
+ * accepted.
+ */
+static void
+wkb_read_header(WKBReader *r, uint32 expected, bool hasm)
+{
+	uint32		type;
+	uint32		basetype;
+	bool		typez,
+				typem;
+
+	wkb_check_size(r, 1);
+	if (*r->data != WKB_XDR && *r->data != WKB_NDR)
+		wkb_error(r, "invalid byte order");
+	r->swap = (*r->data != WKB_NATIVE);
+	r->data++;
+
+	type = wkb_read_uint32(r);
+	if (type & (EWKB_Z_FLAG | EWKB_M_FLAG | EWKB_SRID_FLAG))
+	{
+		typez = (type & EWKB_Z_FLAG) != 0;
+		typem = (type & EWKB_M_FLAG) != 0;
+		if (type & EWKB_SRID_FLAG)
+			(void) wkb_read_uint32(r);
+		basetype = type & 0x0fffffff;
+	}
+	else
+	{
+		typez = (type / 1000 == 1 || type / 1000 == 3);
+		typem = (type / 1000 == 2 || type / 1000 == 3);
+		basetype = type % 1000;
+	}
+
+	if (basetype != expected)
+		wkb_error(r, "unexpected geometry type");
+	if (!typez || typem != hasm)
+		wkb_error(r, hasm ? "geometry must have Z and M coordinates" :
+			"geometry must have Z and no M coordinates");
+}
+
+static int
+wkb_read_npts(WKBReader *r, int minpts, int maxpts)
+{
+	uint32		npts = wkb_read_uint32(r);
+
+	if (npts < (uint32) minpts || npts > (uint32) maxpts)
+		wkb_error(r, "invalid number of points");
+	/* Avoid allocating memory for points that are not there */
+	wkb_check_size(r, sizeof(Point3D) * (Size) npts);
+	return (int) npts;
+}
+
+static void
+wkb_reader_init(WKBReader *r, bytea *wkb, const char *type_name)
+{
+	r->data = VARDATA_ANY(wkb);
+	r->end = r->data + VARSIZE_ANY_EXHDR(wkb);
+	r->swap = false;
+	r->type_name = type_name;
+}
+
+static void
+wkb_reader_end(WKBReader *r)
+{
+	if (r->data != r->end)
+		wkb_error(r, "unexpected data after the geometry");
+}
+
+/*****************************************************************************
+ * Writing WKB
+ *****************************************************************************/
+
+static bytea *
+wkb_alloc(Size size, char **p)
+{
+	bytea	   *result = (bytea *) palloc(VARHDRSZ + size);
+
+	SET_VARSIZE(result, VARHDRSZ + size);
+	*p = VARDATA(result);
+	return result;
+}
+
+static char *
+wkb_write_uint32(char *p, uint32 value)
+{
+	memcpy(p, &value, sizeof(uint32));
+	return p + sizeof(uint32);
+}
+
+static char *
+wkb_write_header(char *p, uint32 type)
+{
+	*p++ = WKB_NATIVE;
+	return wkb_write_uint32(p, type);
+}
+
+static char *
+wkb_write_points(char *p, Point3D *points, int npts)
+{
+	memcpy(p, points, sizeof(Point3D) * npts);
+	return p + sizeof(Point3D) * npts;
+}
+
+/* Write the points as a LineStringZ, repeating the first one if closed */
+static bytea *
+wkb_linestring(Point3D *points, int npts, bool closed)
+{
+	char	   *p;
+	bytea	   *result = wkb_alloc(WKB_HDRSZ + sizeof(uint32) +
+		sizeof(Point3D) * (npts + (closed ? 1 : 0)), &p);
+
+	p = wkb_write_header(p, WKB_ISO_Z + WKB_LINESTRING);
+	p = wkb_write_uint32(p, npts + (closed ? 1 : 0));
+	p = wkb_write_points(p, points, npts);
+	if (closed)
+		wkb_write_points(p, points, 1);
+	return result;
+}
+
+/* Write the points as a MultiPointZ */
+static bytea *
+wkb_multipoint(Point3D *points, int npts)
+{
+	char	   *p;
+	bytea	   *result = wkb_alloc(WKB_HDRSZ + sizeof(uint32) +
+		WKB_POINTZ_SIZE * npts, &p);
+	int			i;
+
+	p = wkb_write_header(p, WKB_ISO_Z + WKB_MULTIPOINT);
+	p = wkb_write_uint32(p, npts);
+	for (i = 0; i < npts; i++)
+	{
+		p = wkb_write_header(p, WKB_ISO_Z + WKB_POINT);
+		p = wkb_write_points(p, &points[i], 1);
+	}
+	return result;
+}
+
+/* Read a MultiPointZ into a palloc'd array of points */
+static Point3D *
+wkb_read_multipoint(WKBReader *r, int minpts, int maxpts, int *npts)
+{
+	Point3D    *result;
+	int			i;
+
+	wkb_read_header(r, WKB_MULTIPOINT, false);
+	*npts = wkb_read_npts(r, minpts, maxpts);
+	result = (Point3D *) palloc(sizeof(Point3D) * Max(*npts, 1));
+	for (i = 0; i < *npts; i++)
+	{
+		wkb_read_header(r, WKB_POINT, false);
+		wkb_read_points(r, &result[i], 1);
+	}
+	return result;
+}
+
+/*****************************************************************************
+ * Point3D
+ *****************************************************************************/
+
+Datum
+point3D_asbinary(PG_FUNCTION_ARGS)
+{
+	Point3D    *point = PG_GETARG_POINT3D_P(0);
+	char	   *p;
+	bytea	   *result = wkb_alloc(WKB_POINTZ_SIZE, &p);
+
+	p = wkb_write_header(p, WKB_ISO_Z + WKB_POINT);
+	wkb_write_points(p, point, 1);
+	PG_RETURN_BYTEA_P(result);
+}
+
+PG_FUNCTION_INFO_V1(point3D_asbinary);
+
+Datum
+point3D_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	Point3D    *result = (Point3D *) palloc(sizeof(Point3D));
+	WKBReader	r;
+
+	wkb_reader_init(&r, wkb, "point3D");
+	wkb_read_header(&r, WKB_POINT, false);
+	wkb_read_points(&r, result, 1);
+	wkb_reader_end(&r);
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_POINT3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(point3D_fromwkb);
+
+/*****************************************************************************
+ * Lseg3D and Line3D
+ *****************************************************************************/
+
+Datum
+lseg3D_asbinary(PG_FUNCTION_ARGS)
+{
+	Lseg3D	   *lseg = PG_GETARG_LSEG3D_P(0);
+
+	PG_RETURN_BYTEA_P(wkb_linestring(lseg->p, 2, false));
+}
+
+PG_FUNCTION_INFO_V1(lseg3D_asbinary);
+
+Datum
+lseg3D_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	Lseg3D	   *result = (Lseg3D *) palloc(sizeof(Lseg3D));
+	WKBReader	r;
+
+	wkb_reader_init(&r, wkb, "lseg3D");
+	wkb_read_header(&r, WKB_LINESTRING, false);
+	wkb_read_npts(&r, 2, 2);
+	wkb_read_points(&r, result->p, 2);
+	wkb_reader_end(&r);
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_LSEG3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(lseg3D_fromwkb);
+
+Datum
+line3D_asbinary(PG_FUNCTION_ARGS)
+{
+	Line3D	   *line = PG_GETARG_LINE3D_P(0);
+
+	PG_RETURN_BYTEA_P(wkb_linestring(line->p, 2, false));
+}
+
+PG_FUNCTION_INFO_V1(line3D_asbinary);
+
+Datum
+line3D_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	Line3D	   *result = (Line3D *) palloc(sizeof(Line3D));
+	WKBReader	r;
+
+	wkb_reader_init(&r, wkb, "line3D");
+	wkb_read_header(&r, WKB_LINESTRING, false);
+	wkb_read_npts(&r, 2, 2);
+	wkb_read_points(&r, result->p, 2);
+	wkb_reader_end(&r);
+	if (PT3Deq(result->p[0], result->p[1]))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("Invalid line3D specification: the two points cannot be equal")));
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_LINE3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(line3D_fromwkb);
+
+/*****************************************************************************
+ * Box3D
+ *****************************************************************************/
+
+Datum
+box3D_asbinary(PG_FUNCTION_ARGS)
+{
+	Box3D	   *box = PG_GETARG_BOX3D_P(0);
+	Point3D		corners[2];
+
+	corners[0] = box->low;
+	corners[1] = box->high;
+	PG_RETURN_BYTEA_P(wkb_multipoint(corners, 2));
+}
+
+PG_FUNCTION_INFO_V1(box3D_asbinary);
+
+Datum
+box3D_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	Box3D	   *result = (Box3D *) palloc(sizeof(Box3D));
+	Point3D    *corners;
+	int			npts;
+	WKBReader	r;
+
+	wkb_reader_init(&r, wkb, "box3D");
+	corners = wkb_read_multipoint(&r, 2, 2, &npts);
+	wkb_reader_end(&r);
+
+	/* The corners may be given in any order, as for the text input */
+	result->high.x = Max(corners[0].x, corners[1].x);
+	result->high.y = Max(corners[0].y, corners[1].y);
+	result->high.z = Max(corners[0].z, corners[1].z);
+	result->low.x = Min(corners[0].x, corners[1].x);
+	result->low.y = Min(corners[0].y, corners[1].y);
+	result->low.z = Min(corners[0].z, corners[1].z);
+	pfree(corners);
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_BOX3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(box3D_fromwkb);
+
+/*****************************************************************************
+ * Path3D
+ *****************************************************************************/
+
+Datum
+path3D_asbinary(PG_FUNCTION_ARGS)
+{
+	Path3D	   *path = PG_GETARG_PATH3D_P(0);
+	bytea	   *result = wkb_linestring(path->p, path->npts, path->closed);
+
+	PG_FREE_IF_COPY(path, 0);
+	PG_RETURN_BYTEA_P(result);
+}
+
+PG_FUNCTION_INFO_V1(path3D_asbinary);
+
+/*
+ * path3D_fromwkb: A LineStringZ whose last point repeats the first one
+ * yields a closed path if the remaining points are not collinear
+ */
+Datum
+path3D_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	Path3D	   *result;
+	WKBReader	r;
+	int			npts;
+	int			size;
+
+	wkb_reader_init(&r, wkb, "path3D");
+	wkb_read_header(&r, WKB_LINESTRING, false);
+	npts = wkb_read_npts(&r, 1,
+		(int) ((INT_MAX - offsetof(Path3D, p)) / sizeof(Point3D)) - 1);
+
+	size = offsetof(Path3D, p) + sizeof(Point3D) * npts;
+	result = (Path3D *) palloc0(size);
+	wkb_read_points(&r, result->p, npts);
+	wkb_reader_end(&r);
+
+	if (npts >= 4 && PT3Deq(result->p[0], result->p[npts - 1]) &&
+		plist_test3noncollinearpts(result->p, npts - 1))
+	{
+		npts--;
+		size -= sizeof(Point3D);
+		result->closed = 1;
+	}
+	SET_VARSIZE(result, size);
+	result->npts = npts;
+	path3D_make_bbox(result);
+
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_PATH3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(path3D_fromwkb);
+
+/*****************************************************************************
+ * Polygon3D
+ *****************************************************************************/
+
+Datum
+poly3D_asbinary(PG_FUNCTION_ARGS)
+{
+	Polygon3D  *poly = PG_GETARG_POLYGON3D_P(0);
+	char	   *p;
+	bytea	   *result = wkb_alloc(WKB_HDRSZ + 2 * sizeof(uint32) +
+		sizeof(Point3D) * (poly->npts + 1), &p);
+
+	p = wkb_write_header(p, WKB_ISO_Z + WKB_POLYGON);
+	p = wkb_write_uint32(p, 1);
+	p = wkb_write_uint32(p, poly->npts + 1);
+	p = wkb_write_points(p, poly->p, poly->npts);
+	wkb_write_points(p, poly->p, 1);
+
+	PG_FREE_IF_COPY(poly, 0);
+	PG_RETURN_BYTEA_P(result);
+}
+
+PG_FUNCTION_INFO_V1(poly3D_asbinary);
+
+Datum
+poly3D_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	Polygon3D  *result;
+	WKBReader	r;
+	int			npts;
+	int			size;
+
+	wkb_reader_init(&r, wkb, "polygon3D");
+	wkb_read_header(&r, WKB_POLYGON, false);
+	if (wkb_read_uint32(&r) != 1)
+		wkb_error(&r, "polygons with holes are not supported");
+	npts = wkb_read_npts(&r, 4,
+		(int) ((INT_MAX - offsetof(Polygon3D, p)) / sizeof(Point3D)));
+
+	size = offsetof(Polygon3D, p) + sizeof(Point3D) * npts;
+	result = (Polygon3D *) palloc0(size);
+	wkb_read_points(&r, result->p, npts);
+	wkb_reader_end(&r);
+
+	/* The ring of a WKB polygon repeats its first point */
+	if (!PT3Deq(result->p[0], result->p[npts - 1]))
+		wkb_error(&r, "the ring of the polygon is not closed");
+	npts--;
+	if (!plist_test3noncollinearpts(result->p, npts))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("Invalid polygon3D specification: a polygon requires at least 3 non collinear points")));
+
+	SET_VARSIZE(result, size - sizeof(Point3D));
+	result->npts = npts;
+	poly3D_make_bbox(result);
+
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_POLYGON3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(poly3D_fromwkb);
+
+/*****************************************************************************
+ * Sphere
+ *****************************************************************************/
+
+Datum
+sphere_asbinary(PG_FUNCTION_ARGS)
+{
+	Sphere	   *sphere = PG_GETARG_SPHERE_P(0);
+	char	   *p;
+	bytea	   *result = wkb_alloc(WKB_POINTZ_SIZE + sizeof(double), &p);
+
+	p = wkb_write_header(p, WKB_ISO_ZM + WKB_POINT);
+	p = wkb_write_points(p, &sphere->center, 1);
+	memcpy(p, &sphere->radius, sizeof(double));
+	PG_RETURN_BYTEA_P(result);
+}
+
+PG_FUNCTION_INFO_V1(sphere_asbinary);
+
+Datum
+sphere_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	Sphere	   *result = (Sphere *) palloc(sizeof(Sphere));
+	WKBReader	r;
+
+	wkb_reader_init(&r, wkb, "sphere");
+	wkb_read_header(&r, WKB_POINT, true);
+	wkb_read_points(&r, &result->center, 1);
+	result->radius = wkb_read_double(&r);
+	wkb_reader_end(&r);
+	if (FPlt(result->radius, 0) || isnan(result->radius))
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("Invalid sphere specification: the radius cannot be negative")));
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_SPHERE_P(result);
+}
+
+PG_FUNCTION_INFO_V1(sphere_fromwkb);
+
+/*****************************************************************************
+ * PointPatch3D
+ *****************************************************************************/
+
+Datum
+pointpatch3D_asbinary(PG_FUNCTION_ARGS)
+{
+	PointPatch3D *patch = PG_GETARG_POINTPATCH3D_P(0);
+	Point3D    *points = (Point3D *) palloc(sizeof(Point3D) * patch->npts);
+	bytea	   *result;
+
+	pointpatch3D_decode(patch, points);
+	result = wkb_multipoint(points, patch->npts);
+	pfree(points);
+	PG_FREE_IF_COPY(patch, 0);
+	PG_RETURN_BYTEA_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_asbinary);
+
+Datum
+pointpatch3D_fromwkb(PG_FUNCTION_ARGS)
+{
+	bytea	   *wkb = PG_GETARG_BYTEA_PP(0);
+	PointPatch3D *result;
+	Point3D    *points;
+	int			npts;
+	WKBReader	r;
+
+	wkb_reader_init(&r, wkb, "pointpatch3D");
+	points = wkb_read_multipoint(&r, 1, POINTPATCH3D_MAXPTS, &npts);
+	wkb_reader_end(&r);
+	result = pointpatch3D_make(points, npts, 0.0);
+	pfree(points);
+	PG_FREE_IF_COPY(wkb, 0);
+	PG_RETURN_POINTPATCH3D_P(result);
+}
+
+PG_FUNCTION_INFO_V1(pointpatch3D_fromwkb);
+
+/*****************************************************************************/